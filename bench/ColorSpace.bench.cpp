@@ -0,0 +1,75 @@
+#include "bench.h"
+
+#include "RaychelMath/ColorSpace.h"
+
+namespace {
+
+    using namespace Raychel;
+    using Bench::default_elements;
+
+    template <typename T>
+    std::vector<basic_color<T>> random_colors(std::size_t count)
+    {
+        return Bench::random_tuples<basic_color<T>>(count, 0, 1);
+    }
+
+    template <template <typename> typename Out>
+    Bench::Kernel scalar_kernel(auto type, auto convert)
+    {
+        using T = typename decltype(type)::type;
+        return [c = random_colors<T>(default_elements), out = std::vector<Out<T>>(default_elements), convert]() mutable {
+            for (std::size_t i{0}; i != c.size(); ++i) {
+                out[i] = convert(c[i]);
+            }
+            Bench::do_not_optimize(out.data());
+        };
+    }
+
+    template <template <typename> typename Out>
+    Bench::Kernel span_kernel(auto type, auto convert)
+    {
+        using T = typename decltype(type)::type;
+        return [c = random_colors<T>(default_elements), out = std::vector<Out<T>>(default_elements), convert]() mutable {
+            convert(std::span<const basic_color<T>>{c}, std::span<Out<T>>{out});
+            Bench::do_not_optimize(out.data());
+        };
+    }
+
+    //The span overloads are templates of T, which the generic lambdas forward from the span types
+    constexpr auto to_xyz = [](const auto& src, auto&&... dst) { return xyz_from_color(src, dst...); };
+    constexpr auto to_lab = [](const auto& src, auto&&... dst) { return lab_from_color(src, dst...); };
+    constexpr auto to_hsv = [](const auto& src, auto&&... dst) { return hsv_from_color(src, dst...); };
+    constexpr auto to_hsl = [](const auto& src, auto&&... dst) { return hsl_from_color(src, dst...); };
+    constexpr auto to_ycocg = [](const auto& src, auto&&... dst) { return ycocg_from_color(src, dst...); };
+
+    RAYCHEL_FLOATING_BENCHMARK("xyz_from_color scalar", default_elements, [](auto type) { return scalar_kernel<basic_xyz>(type, to_xyz); });
+    RAYCHEL_FLOATING_BENCHMARK("xyz_from_color span", default_elements, [](auto type) { return span_kernel<basic_xyz>(type, to_xyz); });
+    RAYCHEL_FLOATING_BENCHMARK("lab_from_color scalar", default_elements, [](auto type) { return scalar_kernel<basic_lab>(type, to_lab); });
+    RAYCHEL_FLOATING_BENCHMARK("lab_from_color span", default_elements, [](auto type) { return span_kernel<basic_lab>(type, to_lab); });
+    RAYCHEL_FLOATING_BENCHMARK("hsv_from_color scalar", default_elements, [](auto type) { return scalar_kernel<basic_hsv>(type, to_hsv); });
+    RAYCHEL_FLOATING_BENCHMARK("hsv_from_color span", default_elements, [](auto type) { return span_kernel<basic_hsv>(type, to_hsv); });
+    RAYCHEL_FLOATING_BENCHMARK("hsl_from_color scalar", default_elements, [](auto type) { return scalar_kernel<basic_hsl>(type, to_hsl); });
+    RAYCHEL_FLOATING_BENCHMARK("hsl_from_color span", default_elements, [](auto type) { return span_kernel<basic_hsl>(type, to_hsl); });
+    RAYCHEL_FLOATING_BENCHMARK("ycocg_from_color scalar", default_elements, [](auto type) { return scalar_kernel<basic_ycocg>(type, to_ycocg); });
+    RAYCHEL_FLOATING_BENCHMARK("ycocg_from_color span", default_elements, [](auto type) { return span_kernel<basic_ycocg>(type, to_ycocg); });
+
+    //Back to RGB, starting from converted colors so the inputs stay in range
+    RAYCHEL_FLOATING_BENCHMARK("color_from_lab span", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        std::vector<basic_lab<T>> lab(default_elements);
+        lab_from_color<T>(random_colors<T>(default_elements), lab);
+        return [lab = std::move(lab), out = std::vector<basic_color<T>>(default_elements)]() mutable {
+            color_from_lab<T>(lab, out);
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    RAYCHEL_FLOATING_BENCHMARK("color_from_hsv span", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        std::vector<basic_hsv<T>> hsv(default_elements);
+        hsv_from_color<T>(random_colors<T>(default_elements), hsv);
+        return [hsv = std::move(hsv), out = std::vector<basic_color<T>>(default_elements)]() mutable {
+            color_from_hsv<T>(hsv, out);
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+} // namespace
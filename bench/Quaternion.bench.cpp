@@ -0,0 +1,99 @@
+#include "bench.h"
+
+#include "RaychelMath/Quaternion.h"
+#include "RaychelMath/Transform.h"
+#include "RaychelMath/UnitQuaternion.h"
+
+namespace {
+
+    using namespace Raychel;
+    using Bench::default_elements;
+
+    template <typename T>
+    std::vector<basic_quaternion<T>> random_rotations(std::size_t count, std::uint32_t seed)
+    {
+        const auto axes = Bench::random_tuples<basic_vec3<T>>(count, 0.1, 1, seed);
+        const auto angles = Bench::random_values<T>(count, -3, 3, seed + 1);
+
+        std::vector<basic_quaternion<T>> res(count);
+        for (std::size_t i{0}; i != count; ++i) {
+            res[i] = rotate_around(axes[i], angles[i]);
+        }
+        return res;
+    }
+
+    RAYCHEL_FLOATING_BENCHMARK("quaternion compose", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [a = random_rotations<T>(default_elements, 1),
+                b = random_rotations<T>(default_elements, 2),
+                out = std::vector<basic_quaternion<T>>(default_elements)]() mutable {
+            for (std::size_t i{0}; i != a.size(); ++i) {
+                out[i] = a[i] * b[i];
+            }
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    RAYCHEL_FLOATING_BENCHMARK("quaternion rotate vec3", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [q = random_rotations<T>(default_elements, 1),
+                v = Bench::random_tuples<basic_vec3<T>>(default_elements, -10, 10),
+                out = std::vector<basic_vec3<T>>(default_elements)]() mutable {
+            for (std::size_t i{0}; i != v.size(); ++i) {
+                out[i] = v[i] * q[i];
+            }
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    RAYCHEL_FLOATING_BENCHMARK("unit quaternion rotate vec3", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        std::vector<basic_unit_quaternion<T>> q;
+        for (const auto& raw : random_rotations<T>(default_elements, 1)) {
+            q.emplace_back(raw);
+        }
+        return [q = std::move(q),
+                v = Bench::random_tuples<basic_vec3<T>>(default_elements, -10, 10),
+                out = std::vector<basic_vec3<T>>(default_elements)]() mutable {
+            for (std::size_t i{0}; i != v.size(); ++i) {
+                out[i] = v[i] * q[i];
+            }
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    template <typename T>
+    basic_transform<T> bench_transform()
+    {
+        return basic_transform<T>{basic_vec3<T>{1, -2, 3}, rotate_around(basic_vec3<T>{1, 1, 0}, T(0.5))};
+    }
+
+    RAYCHEL_FLOATING_BENCHMARK("transform apply", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [t = bench_transform<T>(),
+                v = Bench::random_tuples<basic_vec3<T>>(default_elements, -10, 10),
+                out = std::vector<basic_vec3<T>>(default_elements)]() mutable {
+            for (std::size_t i{0}; i != v.size(); ++i) {
+                out[i] = apply(t, v[i]);
+            }
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    RAYCHEL_FLOATING_BENCHMARK("compiled transform apply", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [t = basic_compiled_transform<T>{bench_transform<T>()},
+                v = Bench::random_tuples<basic_vec3<T>>(default_elements, -10, 10),
+                out = std::vector<basic_vec3<T>>(default_elements)]() mutable {
+            for (std::size_t i{0}; i != v.size(); ++i) {
+                out[i] = apply(t, v[i]);
+            }
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    RAYCHEL_FLOATING_BENCHMARK("compiled transform apply_points", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [t = basic_compiled_transform<T>{bench_transform<T>()},
+                v = Bench::random_tuples<basic_vec3<T>>(default_elements, -10, 10),
+                out = std::vector<basic_vec3<T>>(default_elements)]() mutable {
+            apply_points<T>(t, v, out);
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+} // namespace
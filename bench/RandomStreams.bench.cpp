@@ -0,0 +1,68 @@
+#include "bench.h"
+
+#include "RaychelMath/RandomStreams.h"
+#include "RaychelMath/vector.h"
+
+namespace {
+
+    using namespace Raychel;
+    using Bench::default_elements;
+
+    template <std::size_t W>
+    Bench::Kernel fill_kernel()
+    {
+        return [streams = RandomStreams<W>{1}, out = std::vector<float>(default_elements)]() mutable {
+            streams.fill(std::span<float>{out});
+            Bench::do_not_optimize(out.data());
+        };
+    }
+
+    //Drawing one number at a time through a callable, the way the vector.h samplers do
+    template <typename Generator>
+    void draw(Generator&& rng, std::vector<float>& out)
+    {
+        for (auto& x : out) {
+            x = rng();
+        }
+        Bench::do_not_optimize(out.data());
+    }
+
+    RAYCHEL_BENCHMARK("streams scalar Xoshiro128PlusPlus", default_elements, []() -> Bench::Kernel {
+        return [engine = Xoshiro128PlusPlus{1}, out = std::vector<float>(default_elements)]() mutable {
+            draw(uniform_real_generator<float>(engine), out);
+        };
+    });
+
+    RAYCHEL_BENCHMARK("streams RandomStreams<4> fill", default_elements, fill_kernel<4>);
+    RAYCHEL_BENCHMARK("streams RandomStreams<8> fill", default_elements, fill_kernel<8>);
+
+    RAYCHEL_BENCHMARK("streams BufferedUniformReal draw", default_elements, []() -> Bench::Kernel {
+        return [rng = BufferedUniformReal<float>{1}, out = std::vector<float>(default_elements)]() mutable {
+            draw(rng.generator(), out);
+        };
+    });
+
+    //Three draws per sample
+    RAYCHEL_BENCHMARK("hemisphere sample Xoshiro128PlusPlus", default_elements, []() -> Bench::Kernel {
+        return [engine = Xoshiro128PlusPlus{1}, out = std::vector<basic_vec3<float>>(default_elements)]() mutable {
+            const basic_vec3<float> normal{0, 1, 0};
+            const auto rng = uniform_real_generator<float>(engine);
+            for (auto& v : out) {
+                v = get_random_direction_on_hemisphere(normal, rng);
+            }
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    RAYCHEL_BENCHMARK("hemisphere sample BufferedUniformReal", default_elements, []() -> Bench::Kernel {
+        return [buffered = BufferedUniformReal<float>{1}, out = std::vector<basic_vec3<float>>(default_elements)]() mutable {
+            const basic_vec3<float> normal{0, 1, 0};
+            const auto rng = buffered.generator();
+            for (auto& v : out) {
+                v = get_random_direction_on_hemisphere(normal, rng);
+            }
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+} // namespace
@@ -0,0 +1,29 @@
+#include "bench.h"
+
+#include "RaychelMath/Rotation.h"
+
+namespace {
+
+    using namespace Raychel;
+    using Bench::default_elements;
+
+    RAYCHEL_FLOATING_BENCHMARK("rotation_y apply_points", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [r = basic_rotation_y<T>{T(0.7)},
+                v = Bench::random_tuples<basic_vec3<T>>(default_elements, -10, 10),
+                out = std::vector<basic_vec3<T>>(default_elements)]() mutable {
+            apply_points<T>(r, v, out);
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    RAYCHEL_FLOATING_BENCHMARK("rotation_y apply_points SoA", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        const auto points = Bench::random_tuples<basic_vec3<T>>(default_elements, -10, 10);
+        return [r = basic_rotation_y<T>{T(0.7)},
+                v = TupleSoA<T, 3, Vec3Tag>{std::span<const basic_vec3<T>>{points}},
+                out = TupleSoA<T, 3, Vec3Tag>{default_elements}]() mutable {
+            apply_points(r, v, out);
+            Bench::do_not_optimize(out.lane(0).data());
+        };
+    });
+
+} // namespace
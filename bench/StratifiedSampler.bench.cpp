@@ -0,0 +1,28 @@
+#include "bench.h"
+
+#include "RaychelMath/StratifiedSampler.h"
+
+namespace {
+
+    using namespace Raychel;
+    using Bench::default_elements;
+
+    //8x8 samples per pixel, reseeded for every pixel like a renderer would
+    template <StratifiedPattern Pattern>
+    Bench::Kernel pixel_kernel()
+    {
+        return [sampler = StratifiedSampler{8, 8, Pattern}, out = std::vector<basic_vec2<float>>(default_elements)]() mutable {
+            const auto count = sampler.sample_count();
+            for (std::uint32_t pixel{0}; pixel != out.size() / count; ++pixel) {
+                sampler.seed(pixel, 0);
+                sampler.fill(std::span<basic_vec2<float>>{out}.subspan(pixel * count, count));
+            }
+            Bench::do_not_optimize(out.data());
+        };
+    }
+
+    RAYCHEL_BENCHMARK("stratified sampler stratified", default_elements, pixel_kernel<StratifiedPattern::stratified>);
+    RAYCHEL_BENCHMARK("stratified sampler jittered", default_elements, pixel_kernel<StratifiedPattern::jittered>);
+    RAYCHEL_BENCHMARK("stratified sampler correlated_multi_jittered", default_elements, pixel_kernel<StratifiedPattern::correlated_multi_jittered>);
+
+} // namespace
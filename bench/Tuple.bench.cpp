@@ -0,0 +1,116 @@
+#include "bench.h"
+
+#include "RaychelMath/Tuple.h"
+#include "RaychelMath/vec3.h"
+#include "RaychelMath/vec3a.h"
+
+namespace {
+
+    using namespace Raychel;
+    using Bench::default_elements;
+
+    RAYCHEL_FLOATING_BENCHMARK("Tuple<T, 4> add", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [a = Bench::random_tuples<Tuple<T, 4>>(default_elements, -10, 10, 1),
+                b = Bench::random_tuples<Tuple<T, 4>>(default_elements, -10, 10, 2),
+                out = std::vector<Tuple<T, 4>>(default_elements)]() mutable {
+            for (std::size_t i{0}; i != a.size(); ++i) {
+                out[i] = a[i] + b[i];
+            }
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    RAYCHEL_FLOATING_BENCHMARK("vec3 add", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [a = Bench::random_tuples<basic_vec3<T>>(default_elements, -10, 10, 1),
+                b = Bench::random_tuples<basic_vec3<T>>(default_elements, -10, 10, 2),
+                out = std::vector<basic_vec3<T>>(default_elements)]() mutable {
+            for (std::size_t i{0}; i != a.size(); ++i) {
+                out[i] = a[i] + b[i];
+            }
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    RAYCHEL_FLOATING_BENCHMARK("vec3 scale", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [a = Bench::random_tuples<basic_vec3<T>>(default_elements, -10, 10),
+                out = std::vector<basic_vec3<T>>(default_elements)]() mutable {
+            for (std::size_t i{0}; i != a.size(); ++i) {
+                out[i] = a[i] * T(1.5);
+            }
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    RAYCHEL_FLOATING_BENCHMARK("vec3 dot", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [a = Bench::random_tuples<basic_vec3<T>>(default_elements, -10, 10, 1),
+                b = Bench::random_tuples<basic_vec3<T>>(default_elements, -10, 10, 2)] {
+            T sum{};
+            for (std::size_t i{0}; i != a.size(); ++i) {
+                sum += dot(a[i], b[i]);
+            }
+            Bench::do_not_optimize(sum);
+        };
+    });
+
+    RAYCHEL_FLOATING_BENCHMARK("vec3 cross", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [a = Bench::random_tuples<basic_vec3<T>>(default_elements, -10, 10, 1),
+                b = Bench::random_tuples<basic_vec3<T>>(default_elements, -10, 10, 2),
+                out = std::vector<basic_vec3<T>>(default_elements)]() mutable {
+            for (std::size_t i{0}; i != a.size(); ++i) {
+                out[i] = cross(a[i], b[i]);
+            }
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    RAYCHEL_FLOATING_BENCHMARK("vec3 normalize", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [a = Bench::random_tuples<basic_vec3<T>>(default_elements, 1, 10),
+                out = std::vector<basic_vec3<T>>(default_elements)]() mutable {
+            for (std::size_t i{0}; i != a.size(); ++i) {
+                out[i] = normalize(a[i]);
+            }
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    template <typename T>
+    std::vector<basic_vec3a<T>> random_vec3a(std::size_t count, double min, double max, std::uint32_t seed)
+    {
+        const auto v = Bench::random_tuples<basic_vec3<T>>(count, min, max, seed);
+        std::vector<basic_vec3a<T>> res(count);
+        std::transform(v.begin(), v.end(), res.begin(), [](const auto& x) { return vec3a_from_vec3(x); });
+        return res;
+    }
+
+    RAYCHEL_FLOATING_BENCHMARK("vec3a dot", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [a = random_vec3a<T>(default_elements, -10, 10, 1), b = random_vec3a<T>(default_elements, -10, 10, 2)] {
+            T sum{};
+            for (std::size_t i{0}; i != a.size(); ++i) {
+                sum += dot(a[i], b[i]);
+            }
+            Bench::do_not_optimize(sum);
+        };
+    });
+
+    RAYCHEL_FLOATING_BENCHMARK("vec3a cross", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [a = random_vec3a<T>(default_elements, -10, 10, 1),
+                b = random_vec3a<T>(default_elements, -10, 10, 2),
+                out = std::vector<basic_vec3a<T>>(default_elements)]() mutable {
+            for (std::size_t i{0}; i != a.size(); ++i) {
+                out[i] = cross(a[i], b[i]);
+            }
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    RAYCHEL_FLOATING_BENCHMARK("vec3a normalize", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [a = random_vec3a<T>(default_elements, 1, 10, 0xC0FFEEU),
+                out = std::vector<basic_vec3a<T>>(default_elements)]() mutable {
+            for (std::size_t i{0}; i != a.size(); ++i) {
+                out[i] = normalize(a[i]);
+            }
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+} // namespace
@@ -0,0 +1,206 @@
+/**
+* \file bench.h
+* \author Weckyy702 (weckyy702@gmail.com)
+* \brief Minimal micro-benchmark harness for RaychelMath
+* \date 2026-10-16
+*
+* MIT License
+* Copyright (c) [2026] [Weckyy702 (weckyy702@gmail.com | https://github.com/Weckyy702)]
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+#ifndef RAYCHELMATH_BENCH_H
+#define RAYCHELMATH_BENCH_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Raychel::Bench {
+
+    /**
+    * \brief Prevent the compiler from optimizing away the computation of value
+    */
+    template <typename T>
+    inline void do_not_optimize(const T& value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const void* sink{};
+        sink = &value;
+#endif
+    }
+
+    /**
+    * \brief Prevent the compiler from assuming anything about memory, e.g. that an output buffer is never read
+    */
+    inline void clobber_memory()
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : : "memory");
+#else
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+    }
+
+    //Number of elements most kernels process per call. Small enough that the working set stays in L1/L2
+    constexpr std::size_t default_elements = 1024;
+
+    //A kernel processes Benchmark::elements elements each time it is called
+    using Kernel = std::function<void()>;
+
+    //The setup function runs once, outside of the timed region, and returns the kernel to be timed
+    using Setup = std::function<Kernel()>;
+
+    struct Benchmark
+    {
+        std::string name;
+        std::size_t elements{};
+        Setup setup;
+    };
+
+    struct Result
+    {
+        std::string name;
+        std::size_t elements{};
+        std::size_t iterations{};
+        double ns_per_op{};
+        double elements_per_second{};
+    };
+
+    inline std::vector<Benchmark>& registry()
+    {
+        static std::vector<Benchmark> benchmarks;
+        return benchmarks;
+    }
+
+    inline bool register_benchmark(std::string name, std::size_t elements, Setup setup)
+    {
+        registry().push_back(Benchmark{std::move(name), elements, std::move(setup)});
+        return true;
+    }
+
+    /**
+    * \brief Register one benchmark per floating point type. setup is called with a std::type_identity of the type
+    */
+    template <typename F>
+    bool register_floating_benchmark(std::string_view name, std::size_t elements, F setup)
+    {
+        const auto add = [&]<typename T>(std::type_identity<T> type, std::string_view type_name) {
+            register_benchmark(std::string{name} + '<' + std::string{type_name} + '>', elements, [=] { return setup(type); });
+        };
+        add(std::type_identity<float>{}, "float");
+        add(std::type_identity<double>{}, "double");
+        add(std::type_identity<long double>{}, "long double");
+        return true;
+    }
+
+    /**
+    * \brief Time a benchmark. The iteration count is doubled until one run takes at least min_time,
+    * the reported time is the median of several runs of that length
+    */
+    inline Result run(const Benchmark& benchmark, std::chrono::nanoseconds min_time)
+    {
+        using clock = std::chrono::steady_clock;
+        constexpr std::size_t repetitions = 5;
+
+        const auto kernel = benchmark.setup();
+
+        const auto time = [&](std::size_t iterations) {
+            const auto start = clock::now();
+            for (std::size_t i{0}; i != iterations; ++i) {
+                kernel();
+            }
+            clobber_memory();
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start);
+        };
+
+        std::size_t iterations{1};
+        while (time(iterations) < min_time / repetitions) {
+            iterations *= 2;
+        }
+
+        std::vector<double> ns_per_op;
+        for (std::size_t i{0}; i != repetitions; ++i) {
+            const auto ns = static_cast<double>(time(iterations).count());
+            ns_per_op.push_back(ns / static_cast<double>(iterations * benchmark.elements));
+        }
+        std::nth_element(ns_per_op.begin(), ns_per_op.begin() + repetitions / 2, ns_per_op.end());
+        const auto median = ns_per_op[repetitions / 2];
+
+        return Result{benchmark.name, benchmark.elements, iterations, median, median > 0 ? 1e9 / median : 0};
+    }
+
+    /**
+    * \brief Deterministic input data so results are comparable between runs
+    */
+    template <typename T>
+    std::vector<T> random_values(std::size_t count, T min, T max, std::uint32_t seed = 0xC0FFEEU)
+    {
+        std::mt19937 rng{seed};
+        std::uniform_real_distribution<double> dist{static_cast<double>(min), static_cast<double>(max)};
+
+        std::vector<T> values(count);
+        std::generate(values.begin(), values.end(), [&] { return static_cast<T>(dist(rng)); });
+        return values;
+    }
+
+    template <typename Tuple_>
+    std::vector<Tuple_> random_tuples(std::size_t count, double min, double max, std::uint32_t seed = 0xC0FFEEU)
+    {
+        using T = std::tuple_element_t<0, Tuple_>;
+        std::mt19937 rng{seed};
+        std::uniform_real_distribution<double> dist{min, max};
+
+        std::vector<Tuple_> values(count);
+        for (auto& v : values) {
+            for (std::size_t i{0}; i != std::tuple_size_v<Tuple_>; ++i) {
+                v[i] = static_cast<T>(dist(rng));
+            }
+        }
+        return values;
+    }
+
+} // namespace Raychel::Bench
+
+#define RAYCHEL_BENCH_CONCAT_IMPL(a, b) a##b
+#define RAYCHEL_BENCH_CONCAT(a, b) RAYCHEL_BENCH_CONCAT_IMPL(a, b)
+
+//Register a benchmark for float, double and long double. The setup lambda receives a std::type_identity<T>
+#define RAYCHEL_FLOATING_BENCHMARK(name, elements, ...)                                                                          \
+    static const bool RAYCHEL_BENCH_CONCAT(raychel_benchmark_registered_, __LINE__) =                                            \
+        ::Raychel::Bench::register_floating_benchmark(name, elements, __VA_ARGS__)
+
+//Register a single benchmark
+#define RAYCHEL_BENCHMARK(name, elements, ...)                                                                                   \
+    static const bool RAYCHEL_BENCH_CONCAT(raychel_benchmark_registered_, __LINE__) =                                            \
+        ::Raychel::Bench::register_benchmark(name, elements, __VA_ARGS__)
+
+#endif //!RAYCHELMATH_BENCH_H
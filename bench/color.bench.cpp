@@ -0,0 +1,89 @@
+#include "bench.h"
+
+#include "RaychelMath/color.h"
+
+namespace {
+
+    using namespace Raychel;
+    using Bench::default_elements;
+
+    template <typename T>
+    std::vector<basic_color<T>> random_colors(std::size_t count)
+    {
+        return Bench::random_tuples<basic_color<T>>(count, 0, 1);
+    }
+
+    RAYCHEL_FLOATING_BENCHMARK("convert_color float->u8", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [c = random_colors<T>(default_elements), out = std::vector<basic_color<std::uint8_t>>(default_elements)]() mutable {
+            for (std::size_t i{0}; i != c.size(); ++i) {
+                out[i] = convert_color<std::uint8_t>(c[i]);
+            }
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    RAYCHEL_FLOATING_BENCHMARK("convert_color u8->float", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        std::vector<basic_color<std::uint8_t>> c;
+        for (const auto& color : random_colors<T>(default_elements)) {
+            c.push_back(convert_color<std::uint8_t>(color));
+        }
+        return [c = std::move(c), out = std::vector<basic_color<T>>(default_elements)]() mutable {
+            for (std::size_t i{0}; i != c.size(); ++i) {
+                out[i] = convert_color<T>(c[i]);
+            }
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    //convert_colors only supports float and double channels, so these are registered per type
+    template <typename From, typename To>
+    Bench::Kernel convert_colors_kernel()
+    {
+        std::vector<basic_color<From>> c;
+        for (const auto& color : random_colors<float>(default_elements)) {
+            c.push_back(convert_color<From>(color));
+        }
+        return [c = std::move(c), out = std::vector<basic_color<To>>(default_elements)]() mutable {
+            convert_colors<To, From>(c, out);
+            Bench::do_not_optimize(out.data());
+        };
+    }
+
+    RAYCHEL_BENCHMARK("convert_colors float->u8", default_elements, convert_colors_kernel<float, std::uint8_t>);
+    RAYCHEL_BENCHMARK("convert_colors double->u8", default_elements, convert_colors_kernel<double, std::uint8_t>);
+    RAYCHEL_BENCHMARK("convert_colors u8->float", default_elements, convert_colors_kernel<std::uint8_t, float>);
+    RAYCHEL_BENCHMARK("convert_colors float->u16", default_elements, convert_colors_kernel<float, std::uint16_t>);
+    RAYCHEL_BENCHMARK("convert_colors u16->u8", default_elements, convert_colors_kernel<std::uint16_t, std::uint8_t>);
+
+    RAYCHEL_BENCHMARK("pack_rgba8 float", default_elements, []() -> Bench::Kernel {
+        return [c = random_colors<float>(default_elements), out = std::vector<std::uint8_t>(default_elements * 4)]() mutable {
+            pack_rgba8<float>(c, out);
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    RAYCHEL_FLOATING_BENCHMARK("color_from_temperature", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        std::vector<std::uint32_t> temperatures(default_elements);
+        for (std::size_t i{0}; i != temperatures.size(); ++i) {
+            temperatures[i] = 1'000 + static_cast<std::uint32_t>((i * 39'000) / temperatures.size());
+        }
+        return [temperatures = std::move(temperatures), out = std::vector<basic_color<T>>(default_elements)]() mutable {
+            for (std::size_t i{0}; i != temperatures.size(); ++i) {
+                out[i] = color_from_temperature<T>(temperatures[i]);
+            }
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    RAYCHEL_FLOATING_BENCHMARK("color_from_temperature_lut", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        std::vector<T> temperatures(default_elements);
+        for (std::size_t i{0}; i != temperatures.size(); ++i) {
+            temperatures[i] = T(1'000) + ((static_cast<T>(i) * T(39'000)) / static_cast<T>(temperatures.size()));
+        }
+        return [temperatures = std::move(temperatures), out = std::vector<basic_color<T>>(default_elements)]() mutable {
+            color_from_temperature_lut<T>(temperatures, out);
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+} // namespace
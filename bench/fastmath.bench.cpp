@@ -0,0 +1,40 @@
+#include "bench.h"
+
+#include "RaychelMath/fastmath.h"
+
+namespace {
+
+    using namespace Raychel;
+    using Bench::default_elements;
+
+    template <typename T, typename F>
+    Bench::Kernel unary_kernel(std::vector<T> in, F f)
+    {
+        return [in = std::move(in), out = std::vector<T>(default_elements), f]() mutable {
+            for (std::size_t i{0}; i != in.size(); ++i) {
+                out[i] = f(in[i]);
+            }
+            Bench::do_not_optimize(out.data());
+        };
+    }
+
+#define RAYCHEL_FASTMATH_BENCHMARK(name, min, max, ...)                                                                          \
+    RAYCHEL_FLOATING_BENCHMARK(name, default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {                  \
+        return unary_kernel(Bench::random_values<T>(default_elements, min, max), __VA_ARGS__);                                   \
+    })
+
+    RAYCHEL_FASTMATH_BENCHMARK("std::sqrt", 0, 100, [](auto x) { return std::sqrt(x); });
+    RAYCHEL_FASTMATH_BENCHMARK("fast_sqrt low", 0, 100, [](auto x) { return fast_sqrt<FastMathPrecision::low>(x); });
+    RAYCHEL_FASTMATH_BENCHMARK("std::sin", -10, 10, [](auto x) { return std::sin(x); });
+    RAYCHEL_FASTMATH_BENCHMARK("fast_sin low", -10, 10, [](auto x) { return fast_sin<FastMathPrecision::low>(x); });
+    RAYCHEL_FASTMATH_BENCHMARK("fast_sin high", -10, 10, [](auto x) { return fast_sin(x); });
+    RAYCHEL_FASTMATH_BENCHMARK("std::exp", -50, 50, [](auto x) { return std::exp(x); });
+    RAYCHEL_FASTMATH_BENCHMARK("fast_exp low", -50, 50, [](auto x) { return fast_exp<FastMathPrecision::low>(x); });
+    RAYCHEL_FASTMATH_BENCHMARK("fast_exp high", -50, 50, [](auto x) { return fast_exp(x); });
+    RAYCHEL_FASTMATH_BENCHMARK("std::log", 0.001, 1000, [](auto x) { return std::log(x); });
+    RAYCHEL_FASTMATH_BENCHMARK("fast_log low", 0.001, 1000, [](auto x) { return fast_log<FastMathPrecision::low>(x); });
+    RAYCHEL_FASTMATH_BENCHMARK("fast_log high", 0.001, 1000, [](auto x) { return fast_log(x); });
+
+#undef RAYCHEL_FASTMATH_BENCHMARK
+
+} // namespace
@@ -0,0 +1,96 @@
+#include "bench.h"
+
+#include "RaychelMath/hdr_encoding.h"
+
+namespace {
+
+    using namespace Raychel;
+    using Bench::default_elements;
+    using color = basic_color<float>;
+
+    //The overloaded encoders can't be passed around directly, so every format gets a small wrapper
+#define RAYCHEL_HDR_FORMAT(format)                                                                                             \
+    struct format##_format                                                                                                     \
+    {                                                                                                                          \
+        static constexpr std::string_view name = #format;                                                                      \
+                                                                                                                               \
+        static std::uint32_t encode(const color& c) noexcept                                                                   \
+        {                                                                                                                      \
+            return encode_##format(c);                                                                                         \
+        }                                                                                                                      \
+        static void encode(std::span<const color> src, std::span<std::uint32_t> dst) noexcept                                  \
+        {                                                                                                                      \
+            encode_##format(src, dst);                                                                                         \
+        }                                                                                                                      \
+        static color decode(std::uint32_t v) noexcept                                                                          \
+        {                                                                                                                      \
+            return decode_##format(v);                                                                                         \
+        }                                                                                                                      \
+        static void decode(std::span<const std::uint32_t> src, std::span<color> dst) noexcept                                  \
+        {                                                                                                                      \
+            decode_##format(src, dst);                                                                                         \
+        }                                                                                                                      \
+    };
+
+    RAYCHEL_HDR_FORMAT(rgbe)
+    RAYCHEL_HDR_FORMAT(rgb9e5)
+    RAYCHEL_HDR_FORMAT(r11g11b10f)
+
+#undef RAYCHEL_HDR_FORMAT
+
+    std::vector<color> random_colors()
+    {
+        return Bench::random_tuples<color>(default_elements, 0, 100, 1);
+    }
+
+    template <typename Format>
+    std::vector<std::uint32_t> random_encoded()
+    {
+        std::vector<std::uint32_t> res(default_elements);
+        Format::encode(random_colors(), res);
+        return res;
+    }
+
+    template <typename Format>
+    bool register_format()
+    {
+        const auto name = [](std::string_view op, std::string_view kind) {
+            return "hdr " + std::string{op} + '_' + std::string{Format::name} + ' ' + std::string{kind};
+        };
+
+        Bench::register_benchmark(name("encode", "scalar"), default_elements, []() -> Bench::Kernel {
+            return [src = random_colors(), dst = std::vector<std::uint32_t>(default_elements)]() mutable {
+                for (std::size_t i{0}; i != src.size(); ++i) {
+                    dst[i] = Format::encode(src[i]);
+                }
+                Bench::do_not_optimize(dst.data());
+            };
+        });
+        Bench::register_benchmark(name("encode", "span"), default_elements, []() -> Bench::Kernel {
+            return [src = random_colors(), dst = std::vector<std::uint32_t>(default_elements)]() mutable {
+                Format::encode(src, dst);
+                Bench::do_not_optimize(dst.data());
+            };
+        });
+        Bench::register_benchmark(name("decode", "scalar"), default_elements, []() -> Bench::Kernel {
+            return [src = random_encoded<Format>(), dst = std::vector<color>(default_elements)]() mutable {
+                for (std::size_t i{0}; i != src.size(); ++i) {
+                    dst[i] = Format::decode(src[i]);
+                }
+                Bench::do_not_optimize(dst.data());
+            };
+        });
+        Bench::register_benchmark(name("decode", "span"), default_elements, []() -> Bench::Kernel {
+            return [src = random_encoded<Format>(), dst = std::vector<color>(default_elements)]() mutable {
+                Format::decode(src, dst);
+                Bench::do_not_optimize(dst.data());
+            };
+        });
+        return true;
+    }
+
+    const bool rgbe_registered = register_format<rgbe_format>();
+    const bool rgb9e5_registered = register_format<rgb9e5_format>();
+    const bool r11g11b10f_registered = register_format<r11g11b10f_format>();
+
+} // namespace
@@ -0,0 +1,35 @@
+#include "bench.h"
+
+#include "RaychelMath/low_discrepancy.h"
+#include "RaychelMath/random.h"
+
+namespace {
+
+    using namespace Raychel;
+    using Bench::default_elements;
+
+    template <typename Sequence>
+    Bench::Kernel fill_2d_kernel()
+    {
+        return [out = std::vector<basic_vec2<float>>(default_elements)]() mutable {
+            fill(Sequence{}, 0, 0, std::span<basic_vec2<float>>{out});
+            Bench::do_not_optimize(out.data());
+        };
+    }
+
+    //White noise for comparison
+    RAYCHEL_BENCHMARK("low discrepancy 2D Xoshiro128PlusPlus", default_elements, []() -> Bench::Kernel {
+        return [engine = Xoshiro128PlusPlus{1}, out = std::vector<basic_vec2<float>>(default_elements)]() mutable {
+            for (auto& p : out) {
+                p = basic_vec2<float>{uniform_real<float>(engine), uniform_real<float>(engine)};
+            }
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    RAYCHEL_BENCHMARK("low discrepancy 2D Sobol", default_elements, fill_2d_kernel<Sobol>);
+    RAYCHEL_BENCHMARK("low discrepancy 2D OwenScrambledSobol", default_elements, fill_2d_kernel<OwenScrambledSobol>);
+    RAYCHEL_BENCHMARK("low discrepancy 2D Halton", default_elements, fill_2d_kernel<Halton>);
+    RAYCHEL_BENCHMARK("low discrepancy 2D R2", default_elements, fill_2d_kernel<R2>);
+
+} // namespace
@@ -0,0 +1,103 @@
+#include "bench.h"
+
+#include "RaychelMath/simd.h"
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+namespace {
+
+    constexpr std::string_view simd_backend()
+    {
+#if defined(RAYCHELMATH_SIMD_AVX2)
+        return "AVX2";
+#elif defined(RAYCHELMATH_SIMD_SSE2)
+        return "SSE2";
+#elif defined(RAYCHELMATH_SIMD_NEON)
+        return "NEON";
+#else
+        return "NONE";
+#endif
+    }
+
+    void print_usage(const char* program)
+    {
+        std::cout << "Usage: " << program << " [--json] [--filter <substring>] [--min-time <milliseconds>]\n";
+    }
+
+    void print_json_string(std::ostream& os, std::string_view s)
+    {
+        os << '"';
+        for (const char c : s) {
+            if (c == '"' || c == '\\') {
+                os << '\\';
+            }
+            os << c;
+        }
+        os << '"';
+    }
+
+    void print_table(const std::vector<Raychel::Bench::Result>& results)
+    {
+        std::cout << "SIMD backend: " << simd_backend() << '\n';
+        std::cout << std::left << std::setw(56) << "benchmark" << std::right << std::setw(14) << "ns/op" << std::setw(18)
+                  << "elements/s" << '\n';
+        for (const auto& result : results) {
+            std::cout << std::left << std::setw(56) << result.name << std::right << std::fixed << std::setprecision(3)
+                      << std::setw(14) << result.ns_per_op << std::scientific << std::setprecision(3) << std::setw(18)
+                      << result.elements_per_second << std::defaultfloat << '\n';
+        }
+    }
+
+    void print_json(const std::vector<Raychel::Bench::Result>& results)
+    {
+        std::cout << "{\n  \"context\": {\"simd_backend\": \"" << simd_backend() << "\"},\n  \"benchmarks\": [";
+        for (std::size_t i{0}; i != results.size(); ++i) {
+            const auto& result = results[i];
+            std::cout << (i == 0 ? "\n" : ",\n") << "    {\"name\": ";
+            print_json_string(std::cout, result.name);
+            std::cout << ", \"elements\": " << result.elements << ", \"iterations\": " << result.iterations
+                      << ", \"ns_per_op\": " << std::setprecision(6) << result.ns_per_op
+                      << ", \"elements_per_second\": " << result.elements_per_second << '}';
+        }
+        std::cout << "\n  ]\n}\n";
+    }
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    bool json{false};
+    std::string_view filter;
+    std::chrono::milliseconds min_time{250};
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg{argv[i]};
+        if (arg == "--json") {
+            json = true;
+        } else if (arg == "--filter" && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (arg == "--min-time" && i + 1 < argc) {
+            min_time = std::chrono::milliseconds{std::strtol(argv[++i], nullptr, 10)};
+        } else {
+            print_usage(argv[0]);
+            return arg == "--help" ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+
+    std::vector<Raychel::Bench::Result> results;
+    for (const auto& benchmark : Raychel::Bench::registry()) {
+        if (benchmark.name.find(filter) == std::string::npos) {
+            continue;
+        }
+        results.push_back(Raychel::Bench::run(benchmark, min_time));
+    }
+
+    if (json) {
+        print_json(results);
+    } else {
+        print_table(results);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,36 @@
+#include "bench.h"
+
+#include "RaychelMath/random.h"
+
+namespace {
+
+    using namespace Raychel;
+    using Bench::default_elements;
+
+    template <typename Engine>
+    Bench::Kernel uniform_real_kernel()
+    {
+        return [engine = Engine{1U}, out = std::vector<float>(default_elements)]() mutable {
+            for (auto& x : out) {
+                x = uniform_real<float>(engine);
+            }
+            Bench::do_not_optimize(out.data());
+        };
+    }
+
+    //What people use without this header
+    RAYCHEL_BENCHMARK("uniform float std::mt19937", default_elements, []() -> Bench::Kernel {
+        return [engine = std::mt19937{1U}, dist = std::uniform_real_distribution<float>{}, out = std::vector<float>(default_elements)]() mutable {
+            for (auto& x : out) {
+                x = dist(engine);
+            }
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    RAYCHEL_BENCHMARK("uniform float SplitMix64", default_elements, uniform_real_kernel<SplitMix64>);
+    RAYCHEL_BENCHMARK("uniform float Xoshiro256PlusPlus", default_elements, uniform_real_kernel<Xoshiro256PlusPlus>);
+    RAYCHEL_BENCHMARK("uniform float Xoroshiro128Plus", default_elements, uniform_real_kernel<Xoroshiro128Plus>);
+    RAYCHEL_BENCHMARK("uniform float PCG32", default_elements, uniform_real_kernel<PCG32>);
+
+} // namespace
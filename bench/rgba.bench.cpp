@@ -0,0 +1,63 @@
+#include "bench.h"
+
+#include "RaychelMath/rgba.h"
+
+namespace {
+
+    using namespace Raychel;
+    using Bench::default_elements;
+
+    template <typename T>
+    std::vector<basic_rgba<T>> random_rgba(std::size_t count, std::uint32_t seed)
+    {
+        const auto colors = Bench::random_tuples<basic_color<T>>(count, 0, 1, seed);
+        const auto alphas = Bench::random_values<T>(count, 0, 1, seed + 1);
+
+        std::vector<basic_rgba<T>> res(count);
+        for (std::size_t i{0}; i != count; ++i) {
+            res[i] = premultiply(colors[i], alphas[i]);
+        }
+        return res;
+    }
+
+    RAYCHEL_FLOATING_BENCHMARK("rgba composite_over", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [src = random_rgba<T>(default_elements, 1), dst = random_rgba<T>(default_elements, 3)]() mutable {
+            composite_over<T>(src, dst);
+            Bench::do_not_optimize(dst.data());
+        };
+    });
+
+    //The same blend with colors and a parallel alpha buffer, as done before basic_rgba existed
+    RAYCHEL_FLOATING_BENCHMARK("color + alpha buffer over", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [src = Bench::random_tuples<basic_color<T>>(default_elements, 0, 1, 1),
+                src_alpha = Bench::random_values<T>(default_elements, 0, 1, 2),
+                dst = Bench::random_tuples<basic_color<T>>(default_elements, 0, 1, 3),
+                dst_alpha = Bench::random_values<T>(default_elements, 0, 1, 4)]() mutable {
+            for (std::size_t i{0}; i != src.size(); ++i) {
+                const T coverage = T(1) - src_alpha[i];
+                dst[i] = src[i] + (dst[i] * coverage);
+                dst_alpha[i] = src_alpha[i] + (dst_alpha[i] * coverage);
+            }
+            Bench::do_not_optimize(dst.data());
+            Bench::do_not_optimize(dst_alpha.data());
+        };
+    });
+
+    RAYCHEL_FLOATING_BENCHMARK("rgba over opaque background", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [src = random_rgba<T>(default_elements, 1), out = std::vector<basic_color<T>>(default_elements)]() mutable {
+            const basic_color<T> background{.2, .3, .4};
+            for (std::size_t i{0}; i != src.size(); ++i) {
+                out[i] = over(src[i], background);
+            }
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    RAYCHEL_BENCHMARK("rgba pack_rgba8 float", default_elements, []() -> Bench::Kernel {
+        return [src = random_rgba<float>(default_elements, 1), out = std::vector<std::uint8_t>(default_elements * 4)]() mutable {
+            pack_rgba8<float>(src, out);
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+} // namespace
@@ -0,0 +1,92 @@
+#include "bench.h"
+
+#include "RaychelMath/sampling.h"
+#include "RaychelMath/vector.h"
+
+namespace {
+
+    using namespace Raychel;
+    using Bench::default_elements;
+
+    //Feeds precomputed numbers to the rng based functions, so all kernels see the same inputs
+    template <typename T>
+    struct ReplayRNG
+    {
+        const T* values;
+        std::size_t* index;
+
+        T operator()() const noexcept
+        {
+            return values[(*index)++];
+        }
+    };
+
+    RAYCHEL_FLOATING_BENCHMARK("sampling get_random_direction_on_hemisphere", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [u = Bench::random_values<T>(2 * default_elements, 0, 1), out = std::vector<basic_vec3<T>>(default_elements)]() mutable {
+            const basic_vec3<T> normal{.3, .9, -.2};
+            std::size_t index{0};
+            const ReplayRNG<T> rng{u.data(), &index};
+            for (auto& v : out) {
+                v = get_random_direction_on_hemisphere(normal, rng);
+            }
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    RAYCHEL_FLOATING_BENCHMARK("sampling sample_uniform_hemisphere", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [u = Bench::random_tuples<basic_vec2<T>>(default_elements, 0, 1), out = std::vector<basic_vec3<T>>(default_elements)]() mutable {
+            const SamplingFrame<T> frame{basic_vec3<T>{.3, .9, -.2}};
+            for (std::size_t i{0}; i != u.size(); ++i) {
+                out[i] = sample_uniform_hemisphere(frame, u[i]);
+            }
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    RAYCHEL_FLOATING_BENCHMARK("sampling sample_uniform_hemisphere batch", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [u = Bench::random_tuples<basic_vec2<T>>(default_elements, 0, 1), out = std::vector<basic_vec3<T>>(default_elements)]() mutable {
+            const SamplingFrame<T> frame{basic_vec3<T>{.3, .9, -.2}};
+            sample_uniform_hemisphere(frame, std::span<const basic_vec2<T>>{u}, std::span<basic_vec3<T>>{out});
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    RAYCHEL_FLOATING_BENCHMARK("sampling sample_cosine_hemisphere", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [u = Bench::random_tuples<basic_vec2<T>>(default_elements, 0, 1), out = std::vector<basic_vec3<T>>(default_elements)]() mutable {
+            const SamplingFrame<T> frame{basic_vec3<T>{.3, .9, -.2}};
+            for (std::size_t i{0}; i != u.size(); ++i) {
+                out[i] = sample_cosine_hemisphere(frame, u[i]);
+            }
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    RAYCHEL_FLOATING_BENCHMARK("sampling sample_cosine_hemisphere batch", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [u = Bench::random_tuples<basic_vec2<T>>(default_elements, 0, 1), out = std::vector<basic_vec3<T>>(default_elements)]() mutable {
+            const SamplingFrame<T> frame{basic_vec3<T>{.3, .9, -.2}};
+            sample_cosine_hemisphere(frame, std::span<const basic_vec2<T>>{u}, std::span<basic_vec3<T>>{out});
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    RAYCHEL_FLOATING_BENCHMARK("sampling get_random_direction_on_cone_angle", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [u = Bench::random_values<T>(2 * default_elements, 0, 1), out = std::vector<basic_vec3<T>>(default_elements)]() mutable {
+            const basic_vec3<T> normal{.3, .9, -.2};
+            std::size_t index{0};
+            const ReplayRNG<T> rng{u.data(), &index};
+            for (auto& v : out) {
+                v = get_random_direction_on_cone_angle(normal, T(0.3), rng);
+            }
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    RAYCHEL_FLOATING_BENCHMARK("sampling sample_uniform_cone batch", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [u = Bench::random_tuples<basic_vec2<T>>(default_elements, 0, 1), out = std::vector<basic_vec3<T>>(default_elements)]() mutable {
+            const SamplingFrame<T> frame{basic_vec3<T>{.3, .9, -.2}};
+            sample_uniform_cone(frame, std::span<const basic_vec2<T>>{u}, std::cos(T(0.3)), std::span<basic_vec3<T>>{out});
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+} // namespace
@@ -0,0 +1,89 @@
+#include "bench.h"
+
+#include "RaychelMath/srgb.h"
+
+namespace {
+
+    using namespace Raychel;
+    using Bench::default_elements;
+
+    template <typename T>
+    std::vector<basic_color<T>> random_colors(std::size_t count)
+    {
+        return Bench::random_tuples<basic_color<T>>(count, 0, 1);
+    }
+
+    RAYCHEL_FLOATING_BENCHMARK("linear_to_srgb", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [c = random_colors<T>(default_elements), out = std::vector<basic_color<T>>(default_elements)]() mutable {
+            for (std::size_t i{0}; i != c.size(); ++i) {
+                out[i] = linear_to_srgb(c[i]);
+            }
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    RAYCHEL_FLOATING_BENCHMARK("fast_linear_to_srgb", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [c = random_colors<T>(default_elements), out = std::vector<basic_color<T>>(default_elements)]() mutable {
+            fast_linear_to_srgb<T>(c, out);
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    RAYCHEL_FLOATING_BENCHMARK("srgb_to_linear", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [c = random_colors<T>(default_elements), out = std::vector<basic_color<T>>(default_elements)]() mutable {
+            for (std::size_t i{0}; i != c.size(); ++i) {
+                out[i] = srgb_to_linear(c[i]);
+            }
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    RAYCHEL_FLOATING_BENCHMARK("fast_srgb_to_linear", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [c = random_colors<T>(default_elements), out = std::vector<basic_color<T>>(default_elements)]() mutable {
+            fast_srgb_to_linear<T>(c, out);
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    RAYCHEL_FLOATING_BENCHMARK("srgb8_to_linear", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        std::vector<basic_color<std::uint8_t>> c;
+        for (const auto& color : random_colors<float>(default_elements)) {
+            c.push_back(convert_color<std::uint8_t>(color));
+        }
+        return [c = std::move(c), out = std::vector<basic_color<T>>(default_elements)]() mutable {
+            srgb8_to_linear<T>(c, out);
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    //The usual framebuffer output: exact encoding, then quantization in a second pass
+    RAYCHEL_FLOATING_BENCHMARK("linear_to_srgb + pack_rgba8", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        if constexpr (details::ColorChannel<T>) {
+            return [c = random_colors<T>(default_elements), encoded = std::vector<basic_color<T>>(default_elements),
+                    out = std::vector<std::uint8_t>(default_elements * 4)]() mutable {
+                for (std::size_t i{0}; i != c.size(); ++i) {
+                    encoded[i] = linear_to_srgb(c[i]);
+                }
+                pack_rgba8<T>(encoded, out);
+                Bench::do_not_optimize(out.data());
+            };
+        } else {
+            return [c = random_colors<T>(default_elements), out = std::vector<std::uint8_t>(default_elements * 4)]() mutable {
+                for (std::size_t i{0}; i != c.size(); ++i) {
+                    const auto encoded = convert_color<std::uint8_t>(linear_to_srgb(c[i]));
+                    std::copy_n(&encoded[0], 3, &out[i * 4]);
+                    out[(i * 4) + 3] = 255;
+                }
+                Bench::do_not_optimize(out.data());
+            };
+        }
+    });
+
+    RAYCHEL_FLOATING_BENCHMARK("pack_srgba8", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [c = random_colors<T>(default_elements), out = std::vector<std::uint8_t>(default_elements * 4)]() mutable {
+            pack_srgba8<T>(c, out);
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+} // namespace
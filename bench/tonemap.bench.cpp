@@ -0,0 +1,70 @@
+#include "bench.h"
+
+#include "RaychelMath/tonemap.h"
+
+namespace {
+
+    using namespace Raychel;
+    using Bench::default_elements;
+
+    template <typename T>
+    std::vector<basic_color<T>> random_hdr_colors(std::size_t count)
+    {
+        return Bench::random_tuples<basic_color<T>>(count, 0, 16);
+    }
+
+    template <template <typename> typename Operator>
+    Bench::Kernel scalar_kernel(auto type)
+    {
+        using T = typename decltype(type)::type;
+        return [c = random_hdr_colors<T>(default_elements), out = std::vector<basic_color<T>>(default_elements)]() mutable {
+            const Operator<T> op{};
+            for (std::size_t i{0}; i != c.size(); ++i) {
+                out[i] = op(c[i]);
+            }
+            Bench::do_not_optimize(out.data());
+        };
+    }
+
+    template <template <typename> typename Operator>
+    Bench::Kernel span_kernel(auto type)
+    {
+        using T = typename decltype(type)::type;
+        return [c = random_hdr_colors<T>(default_elements), out = std::vector<basic_color<T>>(default_elements)]() mutable {
+            tonemap<T>(Operator<T>{}, c, out);
+            Bench::do_not_optimize(out.data());
+        };
+    }
+
+    RAYCHEL_FLOATING_BENCHMARK("reinhard scalar", default_elements, [](auto type) { return scalar_kernel<basic_reinhard>(type); });
+    RAYCHEL_FLOATING_BENCHMARK("reinhard span", default_elements, [](auto type) { return span_kernel<basic_reinhard>(type); });
+    RAYCHEL_FLOATING_BENCHMARK("reinhard_extended span", default_elements, [](auto type) { return span_kernel<basic_reinhard_extended>(type); });
+    RAYCHEL_FLOATING_BENCHMARK("aces scalar", default_elements, [](auto type) { return scalar_kernel<basic_aces>(type); });
+    RAYCHEL_FLOATING_BENCHMARK("aces span", default_elements, [](auto type) { return span_kernel<basic_aces>(type); });
+    RAYCHEL_FLOATING_BENCHMARK("uncharted2 span", default_elements, [](auto type) { return span_kernel<basic_uncharted2>(type); });
+    RAYCHEL_FLOATING_BENCHMARK("agx scalar", default_elements, [](auto type) { return scalar_kernel<basic_agx>(type); });
+    RAYCHEL_FLOATING_BENCHMARK("agx span", default_elements, [](auto type) { return span_kernel<basic_agx>(type); });
+
+    //Tone mapping, encoding and packing as three passes over the framebuffer
+    RAYCHEL_FLOATING_BENCHMARK("aces + srgb + rgba8, three passes", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [c = random_hdr_colors<T>(default_elements), mapped = std::vector<basic_color<T>>(default_elements),
+                encoded = std::vector<basic_color<T>>(default_elements), out = std::vector<std::uint8_t>(default_elements * 4)]() mutable {
+            tonemap<T>(basic_aces<T>{}, c, mapped);
+            fast_linear_to_srgb<T>(mapped, encoded);
+            for (std::size_t i{0}; i != encoded.size(); ++i) {
+                const auto rgb = convert_color<std::uint8_t>(encoded[i]);
+                std::copy_n(&rgb[0], 3, &out[i * 4]);
+                out[(i * 4) + 3] = 255;
+            }
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    RAYCHEL_FLOATING_BENCHMARK("tonemap_pack_srgba8 aces", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [c = random_hdr_colors<T>(default_elements), out = std::vector<std::uint8_t>(default_elements * 4)]() mutable {
+            tonemap_pack_srgba8<T>(basic_aces<T>{}, c, out);
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+} // namespace
@@ -0,0 +1,63 @@
+#include "bench.h"
+
+#include "RaychelMath/equivalent.h"
+#include "RaychelMath/vector.h"
+
+namespace {
+
+    using namespace Raychel;
+    using Bench::default_elements;
+
+    //Cheap deterministic RNG so the samplers dominate the measurement
+    template <typename T>
+    struct BenchRNG
+    {
+        std::uint32_t* state;
+
+        T operator()() const noexcept
+        {
+            *state = (*state * 1'664'525U) + 1'013'904'223U;
+            return static_cast<T>(*state >> 8U) * (T(1) / T(1U << 24U));
+        }
+    };
+
+    RAYCHEL_FLOATING_BENCHMARK("get_random_direction_on_hemisphere", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [n = Bench::random_tuples<basic_vec3<T>>(default_elements, 0.1, 1),
+                out = std::vector<basic_vec3<T>>(default_elements),
+                state = std::uint32_t{1}]() mutable {
+            const BenchRNG<T> rng{&state};
+            for (std::size_t i{0}; i != n.size(); ++i) {
+                out[i] = get_random_direction_on_hemisphere(n[i], rng);
+            }
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    RAYCHEL_FLOATING_BENCHMARK("get_random_direction_on_cone_angle", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        return [n = Bench::random_tuples<basic_vec3<T>>(default_elements, 0.1, 1),
+                out = std::vector<basic_vec3<T>>(default_elements),
+                state = std::uint32_t{1}]() mutable {
+            const BenchRNG<T> rng{&state};
+            for (std::size_t i{0}; i != n.size(); ++i) {
+                out[i] = get_random_direction_on_cone_angle(n[i], T(0.3), rng);
+            }
+            Bench::do_not_optimize(out.data());
+        };
+    });
+
+    RAYCHEL_FLOATING_BENCHMARK("equivalent", default_elements, []<typename T>(std::type_identity<T>) -> Bench::Kernel {
+        auto a = Bench::random_values<T>(default_elements, -10, 10);
+        auto b = a;
+        for (std::size_t i{0}; i < b.size(); i += 2) {
+            b[i] = std::nextafter(b[i], T(100));
+        }
+        return [a = std::move(a), b = std::move(b)] {
+            std::size_t count{};
+            for (std::size_t i{0}; i != a.size(); ++i) {
+                count += equivalent(a[i], b[i]) ? 1 : 0;
+            }
+            Bench::do_not_optimize(count);
+        };
+    });
+
+} // namespace
@@ -0,0 +1,483 @@
+/**
+* \file ColorSpace.h
+* \author Weckyy702 (weckyy702@gmail.com)
+* \brief Conversions between RGB and the XYZ, HSV, HSL, Lab and YCoCg color spaces
+* \date 2026-10-16
+*
+* MIT License
+* Copyright (c) [2026] [Weckyy702 (weckyy702@gmail.com | https://github.com/Weckyy702)]
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+#ifndef RAYCHELMATH_COLORSPACE_H
+#define RAYCHELMATH_COLORSPACE_H
+
+#include "Matrix.h"
+#include "PacketTuple.h"
+#include "TupleBase.h"
+#include "color.h"
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <span>
+
+/**
+* Conversions from and to RGB colors. XYZ and Lab expect linear sRGB colors (decode with srgb_to_linear first) and use
+* the D65 white point, so the Y channel of XYZ is the luminance of the color. HSV, HSL and YCoCg are plain models of
+* the RGB cube and work on linear as well as encoded colors.
+*
+* Hues are stored as fractions of a full turn in [0, 1), saturations, values and lightnesses in [0, 1] and the Lab
+* lightness in [0, 100].
+*
+* Every conversion takes scalar colors or packets of colors (e.g. basic_color_packet<T, W>), and has a span version
+* that converts whole buffers with packets.
+*/
+
+namespace Raychel {
+
+//Each color space is a Tuple<T, 3, Tag> with its own named accessors
+#define RAYCHELMATH_COLOR_SPACE(name, Name, c0, c1, c2)                                                                       \
+    struct Name##Tag                                                                                                           \
+    {};                                                                                                                        \
+                                                                                                                               \
+    template <Arithmetic T>                                                                                                    \
+    struct Name##Base : public TupleBase<T, 3>                                                                                 \
+    {                                                                                                                          \
+        using Base = TupleBase<T, 3>;                                                                                          \
+        using Base::Base, Base::data_, Base::get;                                                                              \
+                                                                                                                               \
+        constexpr auto& c0()                                                                                                   \
+        {                                                                                                                      \
+            return data_[0];                                                                                                   \
+        }                                                                                                                      \
+                                                                                                                               \
+        [[nodiscard]] constexpr const auto& c0() const                                                                         \
+        {                                                                                                                      \
+            return data_[0];                                                                                                   \
+        }                                                                                                                      \
+                                                                                                                               \
+        constexpr auto& c1()                                                                                                   \
+        {                                                                                                                      \
+            return data_[1];                                                                                                   \
+        }                                                                                                                      \
+                                                                                                                               \
+        [[nodiscard]] constexpr const auto& c1() const                                                                         \
+        {                                                                                                                      \
+            return data_[1];                                                                                                   \
+        }                                                                                                                      \
+                                                                                                                               \
+        constexpr auto& c2()                                                                                                   \
+        {                                                                                                                      \
+            return data_[2];                                                                                                   \
+        }                                                                                                                      \
+                                                                                                                               \
+        [[nodiscard]] constexpr const auto& c2() const                                                                         \
+        {                                                                                                                      \
+            return data_[2];                                                                                                   \
+        }                                                                                                                      \
+    };                                                                                                                         \
+                                                                                                                               \
+    template <Arithmetic T>                                                                                                    \
+    struct TupleTraits<T, 3, Name##Tag>                                                                                        \
+    {                                                                                                                          \
+        using Base = Name##Base<T>;                                                                                            \
+    };                                                                                                                         \
+                                                                                                                               \
+    template <Arithmetic T>                                                                                                    \
+    using basic_##name = Tuple<T, 3, Name##Tag>;
+
+    RAYCHELMATH_COLOR_SPACE(xyz, XYZ, x, y, z)
+    RAYCHELMATH_COLOR_SPACE(hsv, HSV, h, s, v)
+    RAYCHELMATH_COLOR_SPACE(hsl, HSL, h, s, l)
+    RAYCHELMATH_COLOR_SPACE(lab, Lab, l, a, b)
+    RAYCHELMATH_COLOR_SPACE(ycocg, YCoCg, y, co, cg)
+
+#undef RAYCHELMATH_COLOR_SPACE
+
+    namespace details::color_space {
+
+        //Row-major, from http://www.brucelindbloom.com/index.html?Eqn_RGB_XYZ_Matrix.html. The inverse is exact in double
+        constexpr std::array<double, 9> xyz_from_color{
+            0.4124564, 0.3575761, 0.1804375, //
+            0.2126729, 0.7151522, 0.0721750, //
+            0.0193339, 0.1191920, 0.9503041};
+
+        constexpr std::array<double, 9> color_from_xyz{
+            3.2404548360214083,    -1.5371388501025751,  -0.49853154686848089, //
+            -0.96926638987565372,  1.8760109288424913,   0.041556082346673524, //
+            0.055643419604213658,  -0.20402585426769815, 1.0572251624579287};
+
+        constexpr std::array<double, 9> ycocg_from_color{
+            .25, .5, .25, //
+            .5, 0, -.5,   //
+            -.25, .5, -.25};
+
+        constexpr std::array<double, 9> color_from_ycocg{
+            1, 1, -1, //
+            1, 0, 1,  //
+            1, -1, -1};
+
+        //XYZ of RGB white, so white maps to Lab (100, 0, 0) exactly
+        constexpr std::array<double, 3> white{
+            xyz_from_color[0] + xyz_from_color[1] + xyz_from_color[2],
+            xyz_from_color[3] + xyz_from_color[4] + xyz_from_color[5],
+            xyz_from_color[6] + xyz_from_color[7] + xyz_from_color[8]};
+
+        //CIE Lab constants, f(t) is linear below delta^3
+        constexpr double lab_delta = 6.0 / 29.0;
+        constexpr double lab_delta_cubed = lab_delta * lab_delta * lab_delta;
+        constexpr double lab_slope = 1.0 / (3.0 * lab_delta * lab_delta);
+        constexpr double lab_offset = 4.0 / 29.0;
+
+        template <std::floating_point T>
+        constexpr basic_mat3<T> to_mat3(const std::array<double, 9>& m) noexcept
+        {
+            return mat3_from_rows(
+                basic_vec3<T>{static_cast<T>(m[0]), static_cast<T>(m[1]), static_cast<T>(m[2])},
+                basic_vec3<T>{static_cast<T>(m[3]), static_cast<T>(m[4]), static_cast<T>(m[5])},
+                basic_vec3<T>{static_cast<T>(m[6]), static_cast<T>(m[7]), static_cast<T>(m[8])});
+        }
+
+        template <typename Out, Channel V, typename In>
+        constexpr Out transform(const std::array<double, 9>& m, const In& in) noexcept
+        {
+            using T = channel_scalar_t<V>;
+            const auto row = [&](std::size_t i) {
+                return (static_cast<T>(m[3 * i]) * in[0]) + (static_cast<T>(m[(3 * i) + 1]) * in[1]) +
+                       (static_cast<T>(m[(3 * i) + 2]) * in[2]);
+            };
+            return Out{row(0), row(1), row(2)};
+        }
+
+        //Starting point for cbrt within 4% for positive x (Kahan): the exponent bits divided by 3 plus a bias
+        template <std::floating_point T>
+        constexpr T cbrt_guess(T x) noexcept
+        {
+            if constexpr (std::is_same_v<T, float>) {
+                return std::bit_cast<T>((std::bit_cast<std::uint32_t>(x) / 3U) + 0x2A5137A0U);
+            } else {
+                //the refinement makes up for the precision, and 32 bit integer division by 3 vectorizes unlike 64 bit
+                return static_cast<T>(cbrt_guess(static_cast<float>(x)));
+            }
+        }
+
+        template <std::floating_point T, std::size_t W>
+        constexpr basic_packet<T, W> cbrt_guess(const basic_packet<T, W>& x) noexcept
+        {
+            basic_packet<T, W> res;
+            for (std::size_t i{0}; i != W; ++i) {
+                res[i] = cbrt_guess(x[i]);
+            }
+            return res;
+        }
+
+        //Cube root of positive x, refined from the guess with Halley's method (cubic convergence). Unlike std::cbrt
+        //this is constexpr and vectorizes for packets
+        template <Channel V>
+        constexpr V cbrt(const V& x) noexcept
+        {
+            using T = channel_scalar_t<V>;
+            constexpr int iterations = std::is_same_v<T, float> ? 2 : 3;
+
+            V y = cbrt_guess(x);
+            for (int i{0}; i != iterations; ++i) {
+                const V y3 = y * y * y;
+                y = y * (y3 + (x * T(2))) / ((y3 * T(2)) + x);
+            }
+            return y;
+        }
+
+        template <Channel V>
+        constexpr V abs(const V& x) noexcept
+        {
+            return max_value(x, -x);
+        }
+
+        //x / y, or 0 where y is not positive
+        template <Channel V>
+        constexpr V safe_divide(const V& x, const V& y) noexcept
+        {
+            using T = channel_scalar_t<V>;
+            return select_value(y > T(0), x / select_value(y > T(0), y, V(T(1))), V(T(0)));
+        }
+
+        template <Channel V>
+        constexpr V lab_f(const V& t) noexcept
+        {
+            using T = channel_scalar_t<V>;
+            const V cube_root = cbrt(max_value(t, V(static_cast<T>(lab_delta_cubed))));
+            const V linear = (t * static_cast<T>(lab_slope)) + static_cast<T>(lab_offset);
+            return select_value(t > static_cast<T>(lab_delta_cubed), cube_root, linear);
+        }
+
+        template <Channel V>
+        constexpr V lab_f_inverse(const V& t) noexcept
+        {
+            using T = channel_scalar_t<V>;
+            const V linear = (t - static_cast<T>(lab_offset)) * static_cast<T>(1.0 / lab_slope);
+            return select_value(t > static_cast<T>(lab_delta), t * t * t, linear);
+        }
+
+        //Hue in [0, 1) of a color with the largest channel mx and the range d = mx - mn
+        template <Channel V>
+        constexpr V hue(const basic_color<V>& c, const V& mx, const V& d) noexcept
+        {
+            using T = channel_scalar_t<V>;
+            const V safe_d = select_value(d > T(0), d, V(T(1)));
+            const V red = (c.g() - c.b()) / safe_d;
+            const V green = ((c.b() - c.r()) / safe_d) + T(2);
+            const V blue = ((c.r() - c.g()) / safe_d) + T(4);
+
+            const V h = select_value(mx == c.r(), red, select_value(mx == c.g(), green, blue)) / T(6);
+            return select_value(h < T(0), h + T(1), h);
+        }
+
+        //Shared by the HSV and HSL conversions: k = (n + h * period) mod period for h in [0, 1)
+        template <Channel V>
+        constexpr V hue_sector(const V& h, channel_scalar_t<V> n, channel_scalar_t<V> period) noexcept
+        {
+            const V k = (h * period) + n;
+            return select_value(k >= period, k - period, k);
+        }
+
+        template <typename Out, typename In, typename F>
+        void convert(std::span<const In> src, std::span<Out> dst, F&& f)
+        {
+            RAYCHEL_ASSERT(dst.size() >= src.size());
+            constexpr std::size_t W = 4;
+
+            std::size_t i{0};
+            for (; i + W <= src.size(); i += W) {
+                store_packet(f(load_packet<W>(src.subspan(i).template first<W>())), dst.subspan(i).template first<W>());
+            }
+            for (; i != src.size(); ++i) {
+                dst[i] = f(src[i]);
+            }
+        }
+
+    } // namespace details::color_space
+
+    /**
+    * \brief Matrices between linear sRGB and CIE XYZ (D65) and between RGB and YCoCg
+    *
+    * They hold the same coefficients as the conversions below. Those also take packet channels, so they read the
+    * coefficients from details::color_space instead of going through basic_mat3.
+    */
+    template <std::floating_point T>
+    inline constexpr basic_mat3<T> xyz_from_color_matrix = details::color_space::to_mat3<T>(details::color_space::xyz_from_color);
+
+    template <std::floating_point T>
+    inline constexpr basic_mat3<T> color_from_xyz_matrix = details::color_space::to_mat3<T>(details::color_space::color_from_xyz);
+
+    template <std::floating_point T>
+    inline constexpr basic_mat3<T> ycocg_from_color_matrix =
+        details::color_space::to_mat3<T>(details::color_space::ycocg_from_color);
+
+    template <std::floating_point T>
+    inline constexpr basic_mat3<T> color_from_ycocg_matrix =
+        details::color_space::to_mat3<T>(details::color_space::color_from_ycocg);
+
+    /**
+    * \brief Convert a linear sRGB color to CIE XYZ
+    */
+    template <details::Channel V>
+    constexpr basic_xyz<V> xyz_from_color(const basic_color<V>& c) noexcept
+    {
+        return details::color_space::transform<basic_xyz<V>, V>(details::color_space::xyz_from_color, c);
+    }
+
+    /**
+    * \brief Convert a CIE XYZ color to linear sRGB. Colors outside of the sRGB gamut get negative channels
+    */
+    template <details::Channel V>
+    constexpr basic_color<V> color_from_xyz(const basic_xyz<V>& c) noexcept
+    {
+        return details::color_space::transform<basic_color<V>, V>(details::color_space::color_from_xyz, c);
+    }
+
+    /**
+    * \brief Convert a CIE XYZ color to CIE Lab
+    */
+    template <details::Channel V>
+    constexpr basic_lab<V> lab_from_xyz(const basic_xyz<V>& c) noexcept
+    {
+        using namespace details::color_space;
+        using T = details::channel_scalar_t<V>;
+
+        const V fx = lab_f(c.x() * static_cast<T>(1.0 / white[0]));
+        const V fy = lab_f(c.y() * static_cast<T>(1.0 / white[1]));
+        const V fz = lab_f(c.z() * static_cast<T>(1.0 / white[2]));
+
+        return basic_lab<V>{(fy * T(116)) - T(16), (fx - fy) * T(500), (fy - fz) * T(200)};
+    }
+
+    /**
+    * \brief Convert a CIE Lab color to CIE XYZ
+    */
+    template <details::Channel V>
+    constexpr basic_xyz<V> xyz_from_lab(const basic_lab<V>& c) noexcept
+    {
+        using namespace details::color_space;
+        using T = details::channel_scalar_t<V>;
+
+        const V fy = (c.l() + T(16)) / T(116);
+        const V fx = fy + (c.a() / T(500));
+        const V fz = fy - (c.b() / T(200));
+
+        return basic_xyz<V>{
+            lab_f_inverse(fx) * static_cast<T>(white[0]),
+            lab_f_inverse(fy) * static_cast<T>(white[1]),
+            lab_f_inverse(fz) * static_cast<T>(white[2])};
+    }
+
+    /**
+    * \brief Convert a linear sRGB color to CIE Lab
+    */
+    template <details::Channel V>
+    constexpr basic_lab<V> lab_from_color(const basic_color<V>& c) noexcept
+    {
+        return lab_from_xyz(xyz_from_color(c));
+    }
+
+    /**
+    * \brief Convert a CIE Lab color to linear sRGB
+    */
+    template <details::Channel V>
+    constexpr basic_color<V> color_from_lab(const basic_lab<V>& c) noexcept
+    {
+        return color_from_xyz(xyz_from_lab(c));
+    }
+
+    /**
+    * \brief Convert an RGB color to HSV. Grey colors get hue 0 and black gets saturation 0
+    */
+    template <details::Channel V>
+    constexpr basic_hsv<V> hsv_from_color(const basic_color<V>& c) noexcept
+    {
+        using namespace details;
+
+        const V mx = max_value(c.r(), max_value(c.g(), c.b()));
+        const V mn = min_value(c.r(), min_value(c.g(), c.b()));
+        const V d = mx - mn;
+
+        return basic_hsv<V>{color_space::hue(c, mx, d), color_space::safe_divide(d, mx), mx};
+    }
+
+    /**
+    * \brief Convert an HSV color to RGB
+    */
+    template <details::Channel V>
+    constexpr basic_color<V> color_from_hsv(const basic_hsv<V>& c) noexcept
+    {
+        using namespace details;
+        using T = channel_scalar_t<V>;
+
+        const V chroma = c.v() * c.s();
+        const auto channel = [&](T n) {
+            const V k = color_space::hue_sector(c.h(), n, T(6));
+            const V t = max_value(V(T(0)), min_value(min_value(k, T(4) - k), V(T(1))));
+            return c.v() - (chroma * t);
+        };
+
+        return basic_color<V>{channel(5), channel(3), channel(1)};
+    }
+
+    /**
+    * \brief Convert an RGB color to HSL. Grey colors get hue 0 and saturation 0
+    */
+    template <details::Channel V>
+    constexpr basic_hsl<V> hsl_from_color(const basic_color<V>& c) noexcept
+    {
+        using namespace details;
+        using T = channel_scalar_t<V>;
+
+        const V mx = max_value(c.r(), max_value(c.g(), c.b()));
+        const V mn = min_value(c.r(), min_value(c.g(), c.b()));
+        const V d = mx - mn;
+        const V sum = mx + mn;
+
+        return basic_hsl<V>{color_space::hue(c, mx, d), color_space::safe_divide(d, T(1) - color_space::abs(sum - T(1))), sum * T(.5)};
+    }
+
+    /**
+    * \brief Convert an HSL color to RGB
+    */
+    template <details::Channel V>
+    constexpr basic_color<V> color_from_hsl(const basic_hsl<V>& c) noexcept
+    {
+        using namespace details;
+        using T = channel_scalar_t<V>;
+
+        const V a = c.s() * min_value(c.l(), T(1) - c.l());
+        const auto channel = [&](T n) {
+            const V k = color_space::hue_sector(c.h(), n, T(12));
+            const V t = max_value(V(T(-1)), min_value(min_value(k - T(3), T(9) - k), V(T(1))));
+            return c.l() - (a * t);
+        };
+
+        return basic_color<V>{channel(0), channel(8), channel(4)};
+    }
+
+    /**
+    * \brief Convert an RGB color to YCoCg. The inverse only needs additions, which makes it cheap to decode
+    */
+    template <details::Channel V>
+    constexpr basic_ycocg<V> ycocg_from_color(const basic_color<V>& c) noexcept
+    {
+        return details::color_space::transform<basic_ycocg<V>, V>(details::color_space::ycocg_from_color, c);
+    }
+
+    /**
+    * \brief Convert a YCoCg color to RGB
+    */
+    template <details::Channel V>
+    constexpr basic_color<V> color_from_ycocg(const basic_ycocg<V>& c) noexcept
+    {
+        return basic_color<V>{c.y() + c.co() - c.cg(), c.y() + c.cg(), c.y() - c.co() - c.cg()};
+    }
+
+    //Span versions, dst must hold at least src.size() colors
+
+#define RAYCHELMATH_COLOR_SPACE_SPAN(function, Out, In)                                                                       \
+    template <std::floating_point T>                                                                                           \
+    void function(std::span<const In<T>> src, std::span<Out<T>> dst)                                                           \
+    {                                                                                                                          \
+        details::color_space::convert(src, dst, [](const auto& c) { return function(c); });                                   \
+    }
+
+    RAYCHELMATH_COLOR_SPACE_SPAN(xyz_from_color, basic_xyz, basic_color)
+    RAYCHELMATH_COLOR_SPACE_SPAN(color_from_xyz, basic_color, basic_xyz)
+    RAYCHELMATH_COLOR_SPACE_SPAN(lab_from_xyz, basic_lab, basic_xyz)
+    RAYCHELMATH_COLOR_SPACE_SPAN(xyz_from_lab, basic_xyz, basic_lab)
+    RAYCHELMATH_COLOR_SPACE_SPAN(lab_from_color, basic_lab, basic_color)
+    RAYCHELMATH_COLOR_SPACE_SPAN(color_from_lab, basic_color, basic_lab)
+    RAYCHELMATH_COLOR_SPACE_SPAN(hsv_from_color, basic_hsv, basic_color)
+    RAYCHELMATH_COLOR_SPACE_SPAN(color_from_hsv, basic_color, basic_hsv)
+    RAYCHELMATH_COLOR_SPACE_SPAN(hsl_from_color, basic_hsl, basic_color)
+    RAYCHELMATH_COLOR_SPACE_SPAN(color_from_hsl, basic_color, basic_hsl)
+    RAYCHELMATH_COLOR_SPACE_SPAN(ycocg_from_color, basic_ycocg, basic_color)
+    RAYCHELMATH_COLOR_SPACE_SPAN(color_from_ycocg, basic_color, basic_ycocg)
+
+#undef RAYCHELMATH_COLOR_SPACE_SPAN
+
+} // namespace Raychel
+
+#endif //!RAYCHELMATH_COLORSPACE_H
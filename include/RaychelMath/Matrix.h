@@ -0,0 +1,377 @@
+/**
+* \file Matrix.h
+* \author Weckyy702 (weckyy702@gmail.com)
+* \brief 3x3 and 4x4 matrices built on Tuple
+* \date 2026-10-16
+*
+* MIT License
+* Copyright (c) [2026] [Weckyy702 (weckyy702@gmail.com | https://github.com/Weckyy702)]
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+#ifndef RAYCHELMATH_MATRIX_H
+#define RAYCHELMATH_MATRIX_H
+
+#include "Quaternion.h"
+#include "Tuple.h"
+#include "vec3.h"
+
+#include <cstddef>
+
+namespace Raychel {
+
+    struct Mat3Tag
+    {};
+
+    struct Mat4Tag
+    {};
+
+    /**
+    * \brief Storage for a 3x3 matrix. The elements are stored column-major, so every column is a contiguous basic_vec3
+    */
+    template <Arithmetic T>
+    struct Mat3Base : public TupleBase<T, 9>
+    {
+        using Base = TupleBase<T, 9>;
+
+        using Base::Base, Base::data_;
+
+        constexpr Mat3Base() : Base{1, 0, 0, 0, 1, 0, 0, 0, 1} //Identity matrix
+        {}
+
+        constexpr T& operator()(std::size_t row, std::size_t col)
+        {
+            return (*this)[(col * 3) + row];
+        }
+
+        constexpr const T& operator()(std::size_t row, std::size_t col) const
+        {
+            return (*this)[(col * 3) + row];
+        }
+
+        constexpr basic_vec3<T> column(std::size_t i) const
+        {
+            return basic_vec3<T>{data_[(i * 3)], data_[(i * 3) + 1], data_[(i * 3) + 2]};
+        }
+
+        constexpr basic_vec3<T> row(std::size_t i) const
+        {
+            return basic_vec3<T>{data_[i], data_[i + 3], data_[i + 6]};
+        }
+    };
+
+    /**
+    * \brief Storage for a 4x4 matrix. The elements are stored column-major, so every column is a contiguous Tuple<T, 4>
+    */
+    template <Arithmetic T>
+    struct Mat4Base : public TupleBase<T, 16>
+    {
+        using Base = TupleBase<T, 16>;
+
+        using Base::Base, Base::data_;
+
+        constexpr Mat4Base() : Base{1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1} //Identity matrix
+        {}
+
+        constexpr T& operator()(std::size_t row, std::size_t col)
+        {
+            return (*this)[(col * 4) + row];
+        }
+
+        constexpr const T& operator()(std::size_t row, std::size_t col) const
+        {
+            return (*this)[(col * 4) + row];
+        }
+
+        constexpr Tuple<T, 4> column(std::size_t i) const
+        {
+            return Tuple<T, 4>{data_[(i * 4)], data_[(i * 4) + 1], data_[(i * 4) + 2], data_[(i * 4) + 3]};
+        }
+
+        constexpr Tuple<T, 4> row(std::size_t i) const
+        {
+            return Tuple<T, 4>{data_[i], data_[i + 4], data_[i + 8], data_[i + 12]};
+        }
+    };
+
+    template <Arithmetic T>
+    struct TupleTraits<T, 9, Mat3Tag>
+    {
+        using Base = Mat3Base<T>;
+    };
+
+    template <Arithmetic T>
+    struct TupleTraits<T, 16, Mat4Tag>
+    {
+        using Base = Mat4Base<T>;
+    };
+
+    template <Arithmetic T>
+    using basic_mat3 = Tuple<T, 9, Mat3Tag>;
+
+    template <Arithmetic T>
+    using basic_mat4 = Tuple<T, 16, Mat4Tag>;
+
+    template <Arithmetic T>
+    constexpr basic_mat3<T> mat3_from_columns(const basic_vec3<T>& c0, const basic_vec3<T>& c1, const basic_vec3<T>& c2)
+    {
+        return basic_mat3<T>{c0[0], c0[1], c0[2], c1[0], c1[1], c1[2], c2[0], c2[1], c2[2]};
+    }
+
+    template <Arithmetic T>
+    constexpr basic_mat3<T> mat3_from_rows(const basic_vec3<T>& r0, const basic_vec3<T>& r1, const basic_vec3<T>& r2)
+    {
+        return basic_mat3<T>{r0[0], r1[0], r2[0], r0[1], r1[1], r2[1], r0[2], r1[2], r2[2]};
+    }
+
+    template <Arithmetic T>
+    constexpr basic_mat4<T>
+    mat4_from_columns(const Tuple<T, 4>& c0, const Tuple<T, 4>& c1, const Tuple<T, 4>& c2, const Tuple<T, 4>& c3)
+    {
+        basic_mat4<T> res;
+        for (std::size_t i{0}; i != 4; ++i) {
+            res(i, 0) = c0[i];
+            res(i, 1) = c1[i];
+            res(i, 2) = c2[i];
+            res(i, 3) = c3[i];
+        }
+        return res;
+    }
+
+    /**
+    * \brief Build an affine 4x4 matrix from a 3x3 linear part and a translation
+    */
+    template <Arithmetic T>
+    constexpr basic_mat4<T> mat4_from_affine(const basic_mat3<T>& linear, const basic_vec3<T>& translation)
+    {
+        basic_mat4<T> res;
+        for (std::size_t col{0}; col != 3; ++col) {
+            for (std::size_t row{0}; row != 3; ++row) {
+                res(row, col) = linear(row, col);
+            }
+            res(col, 3) = translation[col];
+        }
+        return res;
+    }
+
+    template <Arithmetic T>
+    constexpr basic_mat3<T> linear_part(const basic_mat4<T>& m)
+    {
+        basic_mat3<T> res;
+        for (std::size_t col{0}; col != 3; ++col) {
+            for (std::size_t row{0}; row != 3; ++row) {
+                res(row, col) = m(row, col);
+            }
+        }
+        return res;
+    }
+
+    template <Arithmetic T>
+    constexpr basic_vec3<T> translation_part(const basic_mat4<T>& m)
+    {
+        return basic_vec3<T>{m(0, 3), m(1, 3), m(2, 3)};
+    }
+
+    /**
+    * \brief Get the rotation matrix equivalent to v * q
+    *
+    * q does not need to be normalized. The result is the same as for normalize(q), but without a square root
+    */
+    template <Arithmetic T>
+    constexpr basic_mat3<T> mat3_from_quaternion(const basic_quaternion<T>& q)
+    {
+        RAYCHEL_ASSERT(q != (basic_quaternion<T>{0, 0, 0, 0}));
+        const auto s = T(2) / mag_sq(q);
+
+        const auto w = q[0];
+        const auto x = q[1];
+        const auto y = q[2];
+        const auto z = q[3];
+
+        const auto xx = x * x * s;
+        const auto yy = y * y * s;
+        const auto zz = z * z * s;
+        const auto xy = x * y * s;
+        const auto xz = x * z * s;
+        const auto yz = y * z * s;
+        const auto wx = w * x * s;
+        const auto wy = w * y * s;
+        const auto wz = w * z * s;
+
+        // clang-format off
+        return mat3_from_rows(
+            basic_vec3<T>{1 - (yy + zz), xy - wz,       xz + wy},
+            basic_vec3<T>{xy + wz,       1 - (xx + zz), yz - wx},
+            basic_vec3<T>{xz - wy,       yz + wx,       1 - (xx + yy)});
+        // clang-format on
+    }
+
+    template <Arithmetic T>
+    constexpr basic_mat3<T> transpose(const basic_mat3<T>& m)
+    {
+        return mat3_from_rows(m.column(0), m.column(1), m.column(2));
+    }
+
+    template <Arithmetic T>
+    constexpr basic_mat4<T> transpose(const basic_mat4<T>& m)
+    {
+        basic_mat4<T> res;
+        for (std::size_t col{0}; col != 4; ++col) {
+            for (std::size_t row{0}; row != 4; ++row) {
+                res(row, col) = m(col, row);
+            }
+        }
+        return res;
+    }
+
+    template <Arithmetic T>
+    constexpr basic_vec3<T> operator*(const basic_mat3<T>& m, const basic_vec3<T>& v)
+    {
+        return (m.column(0) * v[0]) + (m.column(1) * v[1]) + (m.column(2) * v[2]);
+    }
+
+    template <Arithmetic T>
+    constexpr Tuple<T, 4> operator*(const basic_mat4<T>& m, const Tuple<T, 4>& v)
+    {
+        return (m.column(0) * v[0]) + (m.column(1) * v[1]) + (m.column(2) * v[2]) + (m.column(3) * v[3]);
+    }
+
+    template <Arithmetic T>
+    constexpr basic_mat3<T> operator*(const basic_mat3<T>& a, const basic_mat3<T>& b)
+    {
+        return mat3_from_columns(a * b.column(0), a * b.column(1), a * b.column(2));
+    }
+
+    template <Arithmetic T>
+    constexpr basic_mat4<T> operator*(const basic_mat4<T>& a, const basic_mat4<T>& b)
+    {
+        return mat4_from_columns(a * b.column(0), a * b.column(1), a * b.column(2), a * b.column(3));
+    }
+
+    template <Arithmetic T>
+    constexpr basic_mat3<T>& operator*=(basic_mat3<T>& a, const basic_mat3<T>& b)
+    {
+        a = a * b;
+        return a;
+    }
+
+    template <Arithmetic T>
+    constexpr basic_mat4<T>& operator*=(basic_mat4<T>& a, const basic_mat4<T>& b)
+    {
+        a = a * b;
+        return a;
+    }
+
+    /**
+    * \brief Transform a point by an affine matrix (implicit w = 1). The last row of m is ignored
+    */
+    template <Arithmetic T>
+    constexpr basic_vec3<T> transform_point(const basic_mat4<T>& m, const basic_vec3<T>& p)
+    {
+        // clang-format off
+        return basic_vec3<T>{
+            (m(0, 0) * p[0]) + (m(0, 1) * p[1]) + (m(0, 2) * p[2]) + m(0, 3),
+            (m(1, 0) * p[0]) + (m(1, 1) * p[1]) + (m(1, 2) * p[2]) + m(1, 3),
+            (m(2, 0) * p[0]) + (m(2, 1) * p[1]) + (m(2, 2) * p[2]) + m(2, 3)
+        };
+        // clang-format on
+    }
+
+    /**
+    * \brief Transform a direction by an affine matrix (implicit w = 0). The translation is ignored
+    */
+    template <Arithmetic T>
+    constexpr basic_vec3<T> transform_direction(const basic_mat4<T>& m, const basic_vec3<T>& d)
+    {
+        // clang-format off
+        return basic_vec3<T>{
+            (m(0, 0) * d[0]) + (m(0, 1) * d[1]) + (m(0, 2) * d[2]),
+            (m(1, 0) * d[0]) + (m(1, 1) * d[1]) + (m(1, 2) * d[2]),
+            (m(2, 0) * d[0]) + (m(2, 1) * d[1]) + (m(2, 2) * d[2])
+        };
+        // clang-format on
+    }
+
+    template <Arithmetic T>
+    constexpr T determinant(const basic_mat3<T>& m)
+    {
+        return dot(m.column(0), cross(m.column(1), m.column(2)));
+    }
+
+    template <Arithmetic T>
+    constexpr T determinant(const basic_mat4<T>& m)
+    {
+        //Laplace expansion using the 2x2 minors of the lower two rows
+        const auto s0 = (m(2, 0) * m(3, 1)) - (m(2, 1) * m(3, 0));
+        const auto s1 = (m(2, 0) * m(3, 2)) - (m(2, 2) * m(3, 0));
+        const auto s2 = (m(2, 0) * m(3, 3)) - (m(2, 3) * m(3, 0));
+        const auto s3 = (m(2, 1) * m(3, 2)) - (m(2, 2) * m(3, 1));
+        const auto s4 = (m(2, 1) * m(3, 3)) - (m(2, 3) * m(3, 1));
+        const auto s5 = (m(2, 2) * m(3, 3)) - (m(2, 3) * m(3, 2));
+
+        const auto c0 = (m(1, 1) * s5) - (m(1, 2) * s4) + (m(1, 3) * s3);
+        const auto c1 = (m(1, 0) * s5) - (m(1, 2) * s2) + (m(1, 3) * s1);
+        const auto c2 = (m(1, 0) * s4) - (m(1, 1) * s2) + (m(1, 3) * s0);
+        const auto c3 = (m(1, 0) * s3) - (m(1, 1) * s1) + (m(1, 2) * s0);
+
+        return (m(0, 0) * c0) - (m(0, 1) * c1) + (m(0, 2) * c2) - (m(0, 3) * c3);
+    }
+
+    template <std::floating_point T>
+    constexpr basic_mat3<T> inverse(const basic_mat3<T>& m)
+    {
+        const auto c0 = m.column(0);
+        const auto c1 = m.column(1);
+        const auto c2 = m.column(2);
+
+        //The rows of the inverse are the cross products of the columns, divided by the determinant
+        const auto r0 = cross(c1, c2);
+        const auto r1 = cross(c2, c0);
+        const auto r2 = cross(c0, c1);
+
+        const auto det = dot(c0, r0);
+        RAYCHEL_ASSERT(det != 0);
+        const auto inv_det = T(1) / det;
+
+        return mat3_from_rows(r0 * inv_det, r1 * inv_det, r2 * inv_det);
+    }
+
+    /**
+    * \brief Invert an affine matrix (last row must be 0 0 0 1). Only inverts the 3x3 linear part
+    */
+    template <std::floating_point T>
+    constexpr basic_mat4<T> affine_inverse(const basic_mat4<T>& m)
+    {
+        const auto linear_inverse = inverse(linear_part(m));
+        return mat4_from_affine(linear_inverse, -(linear_inverse * translation_part(m)));
+    }
+
+    /**
+    * \brief Invert a rigid transformation (rotation + translation). The linear part must be orthonormal, so it is just transposed
+    */
+    template <Arithmetic T>
+    constexpr basic_mat4<T> rigid_inverse(const basic_mat4<T>& m)
+    {
+        const auto linear_inverse = transpose(linear_part(m));
+        return mat4_from_affine(linear_inverse, -(linear_inverse * translation_part(m)));
+    }
+
+} // namespace Raychel
+
+#endif //!RAYCHELMATH_MATRIX_H
@@ -0,0 +1,466 @@
+/**
+* \file Packet.h
+* \author Weckyy702 (weckyy702@gmail.com)
+* \brief Fixed-width SIMD packets of floating point values
+* \date 2026-10-16
+*
+* MIT License
+* Copyright (c) [2026] [Weckyy702 (weckyy702@gmail.com | https://github.com/Weckyy702)]
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+#ifndef RAYCHELMATH_PACKET_H
+#define RAYCHELMATH_PACKET_H
+
+#include "RaychelCore/Raychel_assert.h"
+#include "concepts.h"
+#include "simd.h"
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <type_traits>
+
+namespace Raychel {
+
+    namespace details {
+        template <std::floating_point T>
+        struct PacketMaskLane
+        {
+            //Masks use lanes of the same width as the values so they map onto the same registers
+            using type = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+        };
+
+        template <std::floating_point T>
+        using packet_mask_lane_t = typename PacketMaskLane<T>::type;
+
+        template <std::size_t W>
+        constexpr bool is_valid_packet_width = (W >= 2U) && (W <= 16U) && std::has_single_bit(W);
+    } // namespace details
+
+    /**
+    * \brief Result of a lane-wise comparison of two packets. Every lane is either all zeroes or all ones
+    *
+    * \tparam T value type of the packets that were compared
+    * \tparam W number of lanes
+    */
+    template <std::floating_point T, std::size_t W>
+        requires(details::is_valid_packet_width<W>)
+    struct basic_packet_mask
+    {
+        using lane_type = details::packet_mask_lane_t<T>;
+
+        static constexpr auto width = W;
+        static constexpr lane_type true_value = ~lane_type{0};
+
+        constexpr basic_packet_mask() = default;
+
+        //NOLINTNEXTLINE(google-explicit-constructor): broadcasting a bool is intended
+        constexpr basic_packet_mask(bool value)
+        {
+            lanes.fill(value ? true_value : 0);
+        }
+
+        [[nodiscard]] constexpr bool operator[](std::size_t i) const
+        {
+            if (!std::is_constant_evaluated()) {
+                RAYCHEL_ASSERT(i < W);
+            }
+            return lanes[i] != 0;
+        }
+
+        constexpr void set(std::size_t i, bool value)
+        {
+            lanes[i] = value ? true_value : 0;
+        }
+
+        friend constexpr basic_packet_mask operator&(const basic_packet_mask& a, const basic_packet_mask& b)
+        {
+            basic_packet_mask res;
+            for (std::size_t i{0}; i != W; ++i) {
+                res.lanes[i] = a.lanes[i] & b.lanes[i];
+            }
+            return res;
+        }
+
+        friend constexpr basic_packet_mask operator|(const basic_packet_mask& a, const basic_packet_mask& b)
+        {
+            basic_packet_mask res;
+            for (std::size_t i{0}; i != W; ++i) {
+                res.lanes[i] = a.lanes[i] | b.lanes[i];
+            }
+            return res;
+        }
+
+        friend constexpr basic_packet_mask operator^(const basic_packet_mask& a, const basic_packet_mask& b)
+        {
+            basic_packet_mask res;
+            for (std::size_t i{0}; i != W; ++i) {
+                res.lanes[i] = a.lanes[i] ^ b.lanes[i];
+            }
+            return res;
+        }
+
+        friend constexpr basic_packet_mask operator!(const basic_packet_mask& a)
+        {
+            basic_packet_mask res;
+            for (std::size_t i{0}; i != W; ++i) {
+                res.lanes[i] = ~a.lanes[i];
+            }
+            return res;
+        }
+
+        friend constexpr bool operator==(const basic_packet_mask& a, const basic_packet_mask& b) = default;
+
+        alignas(sizeof(lane_type) * W) std::array<lane_type, W> lanes{};
+    };
+
+    template <std::floating_point T, std::size_t W>
+    [[nodiscard]] constexpr bool any(const basic_packet_mask<T, W>& m)
+    {
+        for (std::size_t i{0}; i != W; ++i) {
+            if (m.lanes[i] != 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <std::floating_point T, std::size_t W>
+    [[nodiscard]] constexpr bool all(const basic_packet_mask<T, W>& m)
+    {
+        for (std::size_t i{0}; i != W; ++i) {
+            if (m.lanes[i] == 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <std::floating_point T, std::size_t W>
+    [[nodiscard]] constexpr bool none(const basic_packet_mask<T, W>& m)
+    {
+        return !any(m);
+    }
+
+    /**
+    * \brief Fixed-width packet of W floating point values. Sized and aligned to fill one SSE/AVX/NEON register (or a few)
+    *
+    * Packets satisfy the Arithmetic concept, so they can be used as the component type of every Tuple
+    * (e.g. basic_vec3<basic_packet<float, 4>> holds four vectors at once). Comparisons yield a basic_packet_mask.
+    *
+    * \tparam T value type
+    * \tparam W number of lanes
+    */
+    template <std::floating_point T, std::size_t W>
+        requires(details::is_valid_packet_width<W>)
+    struct basic_packet
+    {
+        using value_type = T;
+        using mask_type = basic_packet_mask<T, W>;
+
+        static constexpr auto width = W;
+
+        constexpr basic_packet() = default;
+
+        //NOLINTNEXTLINE(google-explicit-constructor): broadcasting a scalar is intended
+        constexpr basic_packet(T value)
+        {
+            lanes.fill(value);
+        }
+
+        template <std::convertible_to<T>... Us>
+            requires(sizeof...(Us) == W)
+        constexpr explicit basic_packet(Us... us) : lanes{static_cast<T>(us)...}
+        {}
+
+        [[nodiscard]] static constexpr basic_packet load(const T* ptr)
+        {
+            basic_packet res;
+            for (std::size_t i{0}; i != W; ++i) {
+                res.lanes[i] = ptr[i];
+            }
+            return res;
+        }
+
+        constexpr void store(T* ptr) const
+        {
+            for (std::size_t i{0}; i != W; ++i) {
+                ptr[i] = lanes[i];
+            }
+        }
+
+        constexpr T& operator[](std::size_t i)
+        {
+            if (!std::is_constant_evaluated()) {
+                RAYCHEL_ASSERT(i < W);
+            }
+            return lanes[i];
+        }
+
+        constexpr const T& operator[](std::size_t i) const
+        {
+            if (!std::is_constant_evaluated()) {
+                RAYCHEL_ASSERT(i < W);
+            }
+            return lanes[i];
+        }
+
+        constexpr basic_packet& operator+=(const basic_packet& x)
+        {
+            if constexpr (details::simd::accelerated<T, W>) {
+                if (!std::is_constant_evaluated()) {
+                    details::simd::add<T, W>(lanes.data(), x.lanes.data());
+                    return *this;
+                }
+            }
+            for (std::size_t i{0}; i != W; ++i) {
+                lanes[i] = lanes[i] + x.lanes[i];
+            }
+            return *this;
+        }
+
+        constexpr basic_packet& operator-=(const basic_packet& x)
+        {
+            if constexpr (details::simd::accelerated<T, W>) {
+                if (!std::is_constant_evaluated()) {
+                    details::simd::sub<T, W>(lanes.data(), x.lanes.data());
+                    return *this;
+                }
+            }
+            for (std::size_t i{0}; i != W; ++i) {
+                lanes[i] = lanes[i] - x.lanes[i];
+            }
+            return *this;
+        }
+
+        constexpr basic_packet& operator*=(const basic_packet& x)
+        {
+            if constexpr (details::simd::accelerated<T, W>) {
+                if (!std::is_constant_evaluated()) {
+                    details::simd::mul<T, W>(lanes.data(), x.lanes.data());
+                    return *this;
+                }
+            }
+            for (std::size_t i{0}; i != W; ++i) {
+                lanes[i] = lanes[i] * x.lanes[i];
+            }
+            return *this;
+        }
+
+        constexpr basic_packet& operator/=(const basic_packet& x)
+        {
+            if constexpr (details::simd::accelerated<T, W>) {
+                if (!std::is_constant_evaluated()) {
+                    details::simd::div<T, W>(lanes.data(), x.lanes.data());
+                    return *this;
+                }
+            }
+            for (std::size_t i{0}; i != W; ++i) {
+                lanes[i] = lanes[i] / x.lanes[i];
+            }
+            return *this;
+        }
+
+        //Hidden friends so scalars on either side are broadcast implicitly
+        friend constexpr basic_packet operator+(const basic_packet& a, const basic_packet& b)
+        {
+            auto res{a};
+            res += b;
+            return res;
+        }
+
+        friend constexpr basic_packet operator-(const basic_packet& a, const basic_packet& b)
+        {
+            auto res{a};
+            res -= b;
+            return res;
+        }
+
+        friend constexpr basic_packet operator*(const basic_packet& a, const basic_packet& b)
+        {
+            auto res{a};
+            res *= b;
+            return res;
+        }
+
+        friend constexpr basic_packet operator/(const basic_packet& a, const basic_packet& b)
+        {
+            auto res{a};
+            res /= b;
+            return res;
+        }
+
+        friend constexpr basic_packet operator-(const basic_packet& a)
+        {
+            basic_packet res;
+            for (std::size_t i{0}; i != W; ++i) {
+                res.lanes[i] = -a.lanes[i];
+            }
+            return res;
+        }
+
+#define RAYCHELMATH_PACKET_COMPARISON(op, comparison, lhs, rhs)                                                                 \
+    friend constexpr mask_type operator op(const basic_packet& a, const basic_packet& b)                                          \
+    {                                                                                                                            \
+        mask_type res;                                                                                                           \
+        if constexpr (details::simd::accelerated<T, W>) {                                                                        \
+            if (!std::is_constant_evaluated()) {                                                                                 \
+                std::array<T, W> bits;                                                                                           \
+                details::simd::compare<details::simd::Comparison::comparison, T, W>(bits.data(), lhs.lanes.data(), rhs.lanes.data()); \
+                res.lanes = std::bit_cast<decltype(res.lanes)>(bits);                                                            \
+                return res;                                                                                                      \
+            }                                                                                                                    \
+        }                                                                                                                        \
+        for (std::size_t i{0}; i != W; ++i) {                                                                                    \
+            res.lanes[i] = (a.lanes[i] op b.lanes[i]) ? mask_type::true_value : 0;                                               \
+        }                                                                                                                        \
+        return res;                                                                                                              \
+    }
+
+        //> and >= are < and <= with swapped operands
+        RAYCHELMATH_PACKET_COMPARISON(==, equal, a, b)
+        RAYCHELMATH_PACKET_COMPARISON(!=, not_equal, a, b)
+        RAYCHELMATH_PACKET_COMPARISON(<, less, a, b)
+        RAYCHELMATH_PACKET_COMPARISON(<=, less_equal, a, b)
+        RAYCHELMATH_PACKET_COMPARISON(>, less, b, a)
+        RAYCHELMATH_PACKET_COMPARISON(>=, less_equal, b, a)
+
+#undef RAYCHELMATH_PACKET_COMPARISON
+
+        alignas(sizeof(T) * W) std::array<T, W> lanes{};
+    };
+
+    /**
+    * \brief Lane-wise select: lanes where mask is set are taken from if_true, all other lanes from if_false
+    */
+    template <std::floating_point T, std::size_t W>
+    constexpr basic_packet<T, W>
+    select(const basic_packet_mask<T, W>& mask, const basic_packet<T, W>& if_true, const basic_packet<T, W>& if_false)
+    {
+        using lane_type = typename basic_packet_mask<T, W>::lane_type;
+
+        basic_packet<T, W> res;
+        for (std::size_t i{0}; i != W; ++i) {
+            if constexpr (sizeof(T) == sizeof(lane_type)) {
+                //a bitwise blend instead of a branch per lane, which compilers turn into and/andnot/or or a blend instruction
+                const auto bits = (std::bit_cast<lane_type>(if_true.lanes[i]) & mask.lanes[i]) |
+                                  (std::bit_cast<lane_type>(if_false.lanes[i]) & ~mask.lanes[i]);
+                res.lanes[i] = std::bit_cast<T>(bits);
+            } else {
+                res.lanes[i] = (mask.lanes[i] != 0) ? if_true.lanes[i] : if_false.lanes[i];
+            }
+        }
+        return res;
+    }
+
+    /**
+    * \brief Compile-time lane blend (like _mm_blend_ps): lane i is taken from b if bit i of Lanes is set, from a otherwise
+    */
+    template <std::uint32_t Lanes, std::floating_point T, std::size_t W>
+        requires(W >= 32U || (Lanes >> W) == 0U)
+    constexpr basic_packet<T, W> blend(const basic_packet<T, W>& a, const basic_packet<T, W>& b)
+    {
+        basic_packet<T, W> res;
+        for (std::size_t i{0}; i != W; ++i) {
+            res.lanes[i] = ((Lanes >> i) & 1U) != 0U ? b.lanes[i] : a.lanes[i];
+        }
+        return res;
+    }
+
+    template <std::floating_point T, std::size_t W>
+    constexpr basic_packet<T, W> min(const basic_packet<T, W>& a, const basic_packet<T, W>& b)
+    {
+        if constexpr (details::simd::accelerated<T, W>) {
+            if (!std::is_constant_evaluated()) {
+                //the vector min returns its second argument for NaN, same as the select below
+                auto res{b};
+                details::simd::min<T, W>(res.lanes.data(), a.lanes.data());
+                return res;
+            }
+        }
+        return select(b < a, b, a);
+    }
+
+    template <std::floating_point T, std::size_t W>
+    constexpr basic_packet<T, W> max(const basic_packet<T, W>& a, const basic_packet<T, W>& b)
+    {
+        if constexpr (details::simd::accelerated<T, W>) {
+            if (!std::is_constant_evaluated()) {
+                auto res{b};
+                details::simd::max<T, W>(res.lanes.data(), a.lanes.data());
+                return res;
+            }
+        }
+        return select(a < b, b, a);
+    }
+
+    template <std::floating_point T, std::size_t W>
+    constexpr basic_packet<T, W> abs(const basic_packet<T, W>& x)
+    {
+        return select(x < T(0), -x, x);
+    }
+
+    template <std::floating_point T, std::size_t W>
+    basic_packet<T, W> sqrt(const basic_packet<T, W>& x)
+    {
+        if constexpr (details::simd::accelerated<T, W>) {
+            auto res{x};
+            details::simd::sqrt<T, W>(res.lanes.data());
+            return res;
+        }
+        basic_packet<T, W> res;
+        for (std::size_t i{0}; i != W; ++i) {
+            res.lanes[i] = std::sqrt(x.lanes[i]);
+        }
+        return res;
+    }
+
+    template <std::floating_point T, std::size_t W>
+    constexpr T hsum(const basic_packet<T, W>& x)
+    {
+        T res{0};
+        for (std::size_t i{0}; i != W; ++i) {
+            res += x.lanes[i];
+        }
+        return res;
+    }
+
+    template <std::floating_point T, std::size_t W>
+    inline std::ostream& operator<<(std::ostream& os, const basic_packet<T, W>& obj)
+    {
+        os << '<';
+        for (std::size_t i{0}; i != W - 1; ++i) {
+            os << obj[i] << ' ';
+        }
+        return os << obj[W - 1] << '>';
+    }
+
+    template <std::floating_point T>
+    using basic_packet4 = basic_packet<T, 4>;
+
+    template <std::floating_point T>
+    using basic_packet8 = basic_packet<T, 8>;
+
+} // namespace Raychel
+
+#endif //!RAYCHELMATH_PACKET_H
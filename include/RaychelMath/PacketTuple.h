@@ -0,0 +1,342 @@
+/**
+* \file PacketTuple.h
+* \author Weckyy702 (weckyy702@gmail.com)
+* \brief Packet overloads for vectors, colors and quaternions
+* \date 2026-10-16
+*
+* MIT License
+* Copyright (c) [2026] [Weckyy702 (weckyy702@gmail.com | https://github.com/Weckyy702)]
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+#ifndef RAYCHELMATH_PACKET_TUPLE_H
+#define RAYCHELMATH_PACKET_TUPLE_H
+
+#include "Packet.h"
+#include "Quaternion.h"
+#include "TupleSoA.h"
+#include "color.h"
+#include "vec3.h"
+#include "vector.h"
+
+#include <span>
+#include <type_traits>
+
+namespace Raychel {
+
+    //Tuples of packets hold W independent values in every component (i.e. a "structure of packets")
+
+    template <std::floating_point T, std::size_t W>
+    using basic_vec3_packet = basic_vec3<basic_packet<T, W>>;
+
+    template <std::floating_point T, std::size_t W>
+    using basic_color_packet = basic_color<basic_packet<T, W>>;
+
+    template <std::floating_point T, std::size_t W>
+    using basic_quaternion_packet = basic_quaternion<basic_packet<T, W>>;
+
+    template <std::floating_point T>
+    using basic_vec3x4 = basic_vec3_packet<T, 4>;
+
+    template <std::floating_point T>
+    using basic_vec3x8 = basic_vec3_packet<T, 8>;
+
+    template <std::floating_point T>
+    using basic_colorx4 = basic_color_packet<T, 4>;
+
+    template <std::floating_point T>
+    using basic_colorx8 = basic_color_packet<T, 8>;
+
+    template <std::floating_point T>
+    using basic_quaternionx4 = basic_quaternion_packet<T, 4>;
+
+    template <std::floating_point T>
+    using basic_quaternionx8 = basic_quaternion_packet<T, 8>;
+
+    namespace details {
+
+        template <typename V, typename T>
+        struct is_channel_of : std::is_same<V, T>
+        {};
+
+        template <typename T, std::size_t W>
+        struct is_channel_of<basic_packet<T, W>, T> : std::true_type
+        {};
+
+        //Values that code written once for scalars and packets accepts: T or a packet of T
+        template <typename V, typename T>
+        concept ChannelOf = is_channel_of<V, T>::value;
+
+        template <typename V>
+        struct channel_scalar
+        {
+            using type = V;
+        };
+
+        template <typename T, std::size_t W>
+        struct channel_scalar<basic_packet<T, W>>
+        {
+            using type = T;
+        };
+
+        //Scalar type of a channel, T for both T and basic_packet<T, W>
+        template <typename V>
+        using channel_scalar_t = typename channel_scalar<V>::type;
+
+        template <typename V>
+        concept Channel = std::floating_point<channel_scalar_t<V>> && ChannelOf<V, channel_scalar_t<V>>;
+
+        //The helpers below have the same results for scalars and every lane of a packet
+        template <std::floating_point T>
+        constexpr T max_value(T a, T b) noexcept
+        {
+            return a < b ? b : a;
+        }
+
+        template <std::floating_point T, std::size_t W>
+        constexpr basic_packet<T, W> max_value(const basic_packet<T, W>& a, const basic_packet<T, W>& b) noexcept
+        {
+            return max(a, b);
+        }
+
+        template <std::floating_point T>
+        constexpr T min_value(T a, T b) noexcept
+        {
+            return b < a ? b : a;
+        }
+
+        template <std::floating_point T, std::size_t W>
+        constexpr basic_packet<T, W> min_value(const basic_packet<T, W>& a, const basic_packet<T, W>& b) noexcept
+        {
+            return min(a, b);
+        }
+
+        template <std::floating_point T>
+        constexpr T select_value(bool condition, T if_true, T if_false) noexcept
+        {
+            return condition ? if_true : if_false;
+        }
+
+        template <std::floating_point T, std::size_t W>
+        constexpr basic_packet<T, W>
+        select_value(const basic_packet_mask<T, W>& mask, const basic_packet<T, W>& if_true, const basic_packet<T, W>& if_false) noexcept
+        {
+            return select(mask, if_true, if_false);
+        }
+
+        //Apply a scalar function to every lane, e.g. for functions without a packet version
+        template <std::floating_point T, std::size_t W, typename F>
+        basic_packet<T, W> map_lanes(const basic_packet<T, W>& x, F&& f)
+        {
+            basic_packet<T, W> res;
+            for (std::size_t i{0}; i != W; ++i) {
+                res[i] = f(x[i]);
+            }
+            return res;
+        }
+
+    } // namespace details
+
+    /**
+    * \brief Gather W consecutive tuples into a tuple of packets
+    */
+    template <std::size_t W, std::floating_point T, std::size_t N, typename Tag>
+    constexpr Tuple<basic_packet<T, W>, N, Tag> load_packet(std::span<const Tuple<T, N, Tag>, W> values)
+    {
+        Tuple<basic_packet<T, W>, N, Tag> res;
+        for (std::size_t i{0}; i != N; ++i) {
+            for (std::size_t lane{0}; lane != W; ++lane) {
+                res[i][lane] = values[lane][i];
+            }
+        }
+        return res;
+    }
+
+    /**
+    * \brief Load W consecutive elements of a TupleSoA starting at index
+    */
+    template <std::size_t W, std::floating_point T, std::size_t N, typename Tag>
+    Tuple<basic_packet<T, W>, N, Tag> load_packet(const TupleSoA<T, N, Tag>& values, std::size_t index)
+    {
+        RAYCHEL_ASSERT(index + W <= values.size());
+        Tuple<basic_packet<T, W>, N, Tag> res;
+        for (std::size_t i{0}; i != N; ++i) {
+            res[i] = basic_packet<T, W>::load(values.lane(i).data() + index);
+        }
+        return res;
+    }
+
+    /**
+    * \brief Scatter a tuple of packets into W consecutive tuples
+    */
+    template <std::floating_point T, std::size_t W, std::size_t N, typename Tag>
+    constexpr void store_packet(const Tuple<basic_packet<T, W>, N, Tag>& x, std::span<Tuple<T, N, Tag>, W> out)
+    {
+        for (std::size_t i{0}; i != N; ++i) {
+            for (std::size_t lane{0}; lane != W; ++lane) {
+                out[lane][i] = x[i][lane];
+            }
+        }
+    }
+
+    template <std::floating_point T, std::size_t W, std::size_t N, typename Tag>
+    void store_packet(const Tuple<basic_packet<T, W>, N, Tag>& x, TupleSoA<T, N, Tag>& out, std::size_t index)
+    {
+        RAYCHEL_ASSERT(index + W <= out.size());
+        for (std::size_t i{0}; i != N; ++i) {
+            x[i].store(out.lane(i).data() + index);
+        }
+    }
+
+    /**
+    * \brief Extract a single lane of a tuple of packets
+    */
+    template <std::floating_point T, std::size_t W, std::size_t N, typename Tag>
+    constexpr Tuple<T, N, Tag> extract(const Tuple<basic_packet<T, W>, N, Tag>& x, std::size_t lane)
+    {
+        Tuple<T, N, Tag> res;
+        for (std::size_t i{0}; i != N; ++i) {
+            res[i] = x[i][lane];
+        }
+        return res;
+    }
+
+    template <std::floating_point T, std::size_t W, std::size_t N, typename Tag>
+    constexpr Tuple<basic_packet<T, W>, N, Tag>
+    select(const basic_packet_mask<T, W>& mask, const Tuple<basic_packet<T, W>, N, Tag>& if_true, const Tuple<basic_packet<T, W>, N, Tag>& if_false)
+    {
+        Tuple<basic_packet<T, W>, N, Tag> res;
+        for (std::size_t i{0}; i != N; ++i) {
+            res[i] = select(mask, if_true[i], if_false[i]);
+        }
+        return res;
+    }
+
+    template <std::uint32_t Lanes, std::floating_point T, std::size_t W, std::size_t N, typename Tag>
+    constexpr Tuple<basic_packet<T, W>, N, Tag>
+    blend(const Tuple<basic_packet<T, W>, N, Tag>& a, const Tuple<basic_packet<T, W>, N, Tag>& b)
+    {
+        Tuple<basic_packet<T, W>, N, Tag> res;
+        for (std::size_t i{0}; i != N; ++i) {
+            res[i] = blend<Lanes>(a[i], b[i]);
+        }
+        return res;
+    }
+
+    //packets are signed, but std::is_signed_v does not know that
+    template <std::floating_point T, std::size_t W, std::size_t N, typename Tag>
+    constexpr Tuple<basic_packet<T, W>, N, Tag> operator-(const Tuple<basic_packet<T, W>, N, Tag>& x)
+    {
+        Tuple<basic_packet<T, W>, N, Tag> res;
+        for (std::size_t i{0}; i != N; ++i) {
+            res[i] = -x[i];
+        }
+        return res;
+    }
+
+    template <std::floating_point T, std::size_t W>
+    basic_packet<T, W> mag(const basic_vec3_packet<T, W>& v) noexcept
+    {
+        return sqrt(mag_sq(v));
+    }
+
+    template <std::floating_point T, std::size_t W>
+    basic_packet<T, W> dist(const basic_vec3_packet<T, W>& a, const basic_vec3_packet<T, W>& b) noexcept
+    {
+        return mag(a - b);
+    }
+
+    template <std::floating_point T, std::size_t W>
+    basic_vec3_packet<T, W> normalize(const basic_vec3_packet<T, W>& v) noexcept
+    {
+        const auto inv_mag = basic_packet<T, W>{1} / mag(v);
+        return v * inv_mag;
+    }
+
+    template <std::floating_point T, std::size_t W>
+    constexpr basic_vec3_packet<T, W> lerp(const basic_vec3_packet<T, W>& a, const basic_vec3_packet<T, W>& b, T x) noexcept
+    {
+        const basic_packet<T, W> t{x};
+        return (b * t) + (a * (1 - t));
+    }
+
+    template <std::floating_point T, std::size_t W>
+    constexpr basic_vec3_packet<T, W> reflect(const basic_vec3_packet<T, W>& direction, const basic_vec3_packet<T, W>& normal) noexcept
+    {
+        return direction - (normal * (dot(direction, normal) * T(2)));
+    }
+
+    template <std::floating_point T, std::size_t W>
+    basic_packet<T, W> mag(const basic_quaternion_packet<T, W>& q)
+    {
+        return sqrt(mag_sq(q));
+    }
+
+    template <std::floating_point T, std::size_t W>
+    basic_quaternion_packet<T, W> normalize(const basic_quaternion_packet<T, W>& q)
+    {
+        const auto inv_mag = basic_packet<T, W>{1} / mag(q);
+        return q * inv_mag;
+    }
+
+    template <std::floating_point T, std::size_t W>
+    constexpr basic_quaternion_packet<T, W> conjugate(const basic_quaternion_packet<T, W>& q)
+    {
+        return basic_quaternion_packet<T, W>{q[0], -q[1], -q[2], -q[3]};
+    }
+
+    template <std::floating_point T, std::size_t W>
+    constexpr basic_quaternion_packet<T, W> inverse(const basic_quaternion_packet<T, W>& q)
+    {
+        return conjugate(q) * (basic_packet<T, W>{1} / mag_sq(q));
+    }
+
+    /**
+    * \brief Rotate W vectors by W quaternions at once. Same semantics as the scalar operator*(vec3, quaternion)
+    */
+    template <std::floating_point T, std::size_t W>
+    auto operator*(const basic_vec3_packet<T, W>& v, const basic_quaternion_packet<T, W>& _q)
+    {
+        const auto q = normalize(_q);
+
+        const auto r = q[1] * v[0] + q[2] * v[1] + q[3] * v[2];
+        const auto i = q[0] * v[0] + q[2] * v[2] - q[3] * v[1];
+        const auto j = q[0] * v[1] - q[1] * v[2] + q[3] * v[0];
+        const auto k = q[0] * v[2] + q[1] * v[1] - q[2] * v[0];
+
+        const auto x = r * q[1] + i * q[0] - j * q[3] + k * q[2];
+        const auto y = r * q[2] + i * q[3] + j * q[0] - k * q[1];
+        const auto z = r * q[3] - i * q[2] + j * q[1] + k * q[0];
+
+        return basic_vec3_packet<T, W>{x, y, z};
+    }
+
+    /**
+    * \brief Rotate W vectors by the same quaternion
+    */
+    template <std::floating_point T, std::size_t W>
+    auto operator*(const basic_vec3_packet<T, W>& v, const basic_quaternion<T>& q)
+    {
+        const auto n = normalize(q);
+        return v * basic_quaternion_packet<T, W>{n[0], n[1], n[2], n[3]};
+    }
+
+} // namespace Raychel
+
+#endif //!RAYCHELMATH_PACKET_TUPLE_H
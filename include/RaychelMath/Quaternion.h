@@ -44,7 +44,7 @@ namespace Raychel {
 
         using Base::Base, Base::data_;
 
-        QuaternionBase() : Base{1, 0, 0, 0} //Identity rotation
+        constexpr QuaternionBase() : Base{1, 0, 0, 0} //Identity rotation
         {}
 
         constexpr auto& r()
@@ -105,13 +105,14 @@ namespace Raychel {
     template <Arithmetic T, std::convertible_to<T> T_>
     constexpr basic_quaternion<T> rotate_around(const basic_vec3<T>& _axis, T_ angle_in_rads)
     {
-        RAYCHEL_ASSERT(_axis != basic_vec3<T>{});
+        if (!std::is_constant_evaluated()) {
+            RAYCHEL_ASSERT(_axis != basic_vec3<T>{});
+        }
         const auto half_angle = angle_in_rads / 2;
 
-        const auto s = std::sin(half_angle);
+        const auto [s, r] = details::math_sincos(half_angle);
         const auto axis = normalize(_axis);
 
-        const auto r = std::cos(half_angle);
         const auto i = axis[0] * s;
         const auto j = axis[1] * s;
         const auto k = axis[2] * s;
@@ -158,7 +159,9 @@ namespace Raychel {
     template <Arithmetic T>
     constexpr auto operator*(const basic_vec3<T>& v, const basic_quaternion<T>& _q)
     {
-        RAYCHEL_ASSERT(_q != (basic_quaternion<T>{0, 0, 0, 0}));
+        if (!std::is_constant_evaluated()) {
+            RAYCHEL_ASSERT(_q != (basic_quaternion<T>{0, 0, 0, 0}));
+        }
         const auto q = normalize(_q);
 
         //following is the expanded and somewhat optimized version of q * p * q^-1 with p = basic_quaternionImp{0.0, v[0], v.y, v.z}
@@ -195,7 +198,7 @@ namespace Raychel {
     template <Arithmetic T>
     constexpr T mag(const basic_quaternion<T>& q)
     {
-        return std::sqrt(mag_sq(q));
+        return details::math_sqrt(mag_sq(q));
     }
 
     template <Arithmetic T>
@@ -237,11 +240,11 @@ namespace Raychel {
 
         const auto theta0 = std::acos(d);
         const auto theta = theta0 * x;
-        const auto sin_theta = std::sin(theta);
-        const auto sin_theta0 = std::sin(theta0);
+        const auto [sin_theta, cos_theta] = details::math_sincos(theta);
+        const auto sin_theta0 = details::math_sin(theta0);
 
         const auto s1 = sin_theta / sin_theta0;
-        const auto s0 = std::cos(theta) - (d * s1);
+        const auto s0 = cos_theta - (d * s1);
 
         return (a * s0) + (b * s1);
     }
@@ -252,7 +255,7 @@ namespace Raychel {
         constexpr T threshold = 0.9998;
 
         const auto k_cos_theta = dot(old_forward, new_forward);
-        const auto k = std::sqrt(mag_sq(old_forward) * mag_sq(new_forward));
+        const auto k = details::math_sqrt(mag_sq(old_forward) * mag_sq(new_forward));
 
         if ((k_cos_theta) / k < -threshold) {
             const auto orth = get_tangent(old_forward);
@@ -0,0 +1,224 @@
+/**
+* \file RandomStreams.h
+* \author Weckyy702 (weckyy702@gmail.com)
+* \brief Several random number streams running in SIMD lanes
+* \date 2026-10-16
+*
+* MIT License
+* Copyright (c) [2026] [Weckyy702 (weckyy702@gmail.com | https://github.com/Weckyy702)]
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+#ifndef RAYCHELMATH_RANDOM_STREAMS_H
+#define RAYCHELMATH_RANDOM_STREAMS_H
+
+#include "Packet.h"
+#include "random.h"
+#include "simd.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+namespace Raychel {
+
+    /**
+    * \brief W independent xoshiro128++ streams whose states are stored lane by lane, so one step of all of them is a
+    * handful of vector instructions.
+    *
+    * Lane i runs the same sequence as a Xoshiro128PlusPlus seeded with the same seed and jumped i times, so the lanes
+    * never overlap. Hand copies to other threads after calling long_jump() on the original.
+    *
+    * \tparam W number of streams. 4 fills one SSE2 or NEON register, 8 one AVX2 register
+    */
+    template <std::size_t W = 8>
+        requires(details::is_valid_packet_width<W>)
+    class RandomStreams
+    {
+    public:
+        using result_type = std::array<std::uint32_t, W>;
+
+        static constexpr auto width = W;
+        static constexpr std::uint64_t default_seed = Xoshiro128PlusPlus::default_seed;
+
+        constexpr RandomStreams() noexcept
+        {
+            seed();
+        }
+
+        constexpr explicit RandomStreams(std::uint64_t seed) noexcept
+        {
+            this->seed(seed);
+        }
+
+        constexpr void seed(std::uint64_t seed = default_seed) noexcept
+        {
+            Xoshiro128PlusPlus engine{seed};
+            for (std::size_t i{0}; i != W; ++i) {
+                set_lane(i, engine);
+                engine.jump();
+            }
+        }
+
+        /**
+        * \brief Advance every stream by 2^96 steps
+        */
+        constexpr void long_jump() noexcept
+        {
+            for (std::size_t i{0}; i != W; ++i) {
+                auto engine = lane(i);
+                engine.long_jump();
+                set_lane(i, engine);
+            }
+        }
+
+        /**
+        * \brief The current state of a single stream
+        */
+        [[nodiscard]] constexpr Xoshiro128PlusPlus lane(std::size_t i) const noexcept
+        {
+            RAYCHEL_ASSERT(i < W);
+            return Xoshiro128PlusPlus{
+                typename Xoshiro128PlusPlus::state_type{state_[i], state_[W + i], state_[(2 * W) + i], state_[(3 * W) + i]}};
+        }
+
+        /**
+        * \brief The next output of every stream
+        */
+        result_type operator()() noexcept
+        {
+            result_type res{};
+            details::simd::xoshiro128pp<W>(state_.data(), res.data(), 1);
+            return res;
+        }
+
+        /**
+        * \brief The next output of every stream as a uniform number in [0, 1)
+        */
+        template <std::floating_point T = float>
+        basic_packet<T, W> uniform() noexcept
+        {
+            basic_packet<T, W> res;
+            if constexpr (std::is_same_v<T, float>) {
+                details::simd::xoshiro128pp<W>(state_.data(), res.lanes.data(), 1);
+            } else {
+                const auto bits = (*this)();
+                for (std::size_t i{0}; i != W; ++i) {
+                    res.lanes[i] = details::random::uniform_from_bits<T>(bits[i]);
+                }
+            }
+            return res;
+        }
+
+        /**
+        * \brief Fill out with uniform numbers in [0, 1). Consecutive groups of W values come from one step of the
+        * streams, a partial group at the end discards the unused outputs
+        */
+        template <std::floating_point T>
+        void fill(std::span<T> out) noexcept
+        {
+            const auto full = out.size() - (out.size() % W);
+            if constexpr (std::is_same_v<T, float>) {
+                details::simd::xoshiro128pp<W>(state_.data(), out.data(), full / W);
+            } else {
+                for (std::size_t begin{0}; begin != full; begin += W) {
+                    uniform<T>().store(out.data() + begin);
+                }
+            }
+            if (full != out.size()) {
+                const auto tail = uniform<T>();
+                for (std::size_t i{0}; i != out.size() - full; ++i) {
+                    out[full + i] = tail[i];
+                }
+            }
+        }
+
+        constexpr bool operator==(const RandomStreams&) const noexcept = default;
+
+    private:
+        constexpr void set_lane(std::size_t i, const Xoshiro128PlusPlus& engine) noexcept
+        {
+            const auto& state = engine.state();
+            for (std::size_t word{0}; word != state.size(); ++word) {
+                state_[(word * W) + i] = state[word];
+            }
+        }
+
+        //s0 of every lane, then s1 of every lane and so on
+        alignas(W * sizeof(std::uint32_t)) std::array<std::uint32_t, 4 * W> state_{};
+    };
+
+    /**
+    * \brief Scalar uniform numbers in [0, 1) served from a buffer that RandomStreams refills in bulk.
+    *
+    * The buffer is refilled every buffer_size calls, which amortizes the vectorized generation over many scalar draws.
+    *
+    * \tparam T floating point type
+    * \tparam W number of streams
+    */
+    template <std::floating_point T = float, std::size_t W = 8>
+    class BufferedUniformReal
+    {
+    public:
+        using result_type = T;
+
+        static constexpr std::size_t buffer_size = 16 * W;
+
+        BufferedUniformReal() = default;
+
+        explicit BufferedUniformReal(std::uint64_t seed) : streams_{seed}
+        {}
+
+        explicit BufferedUniformReal(const RandomStreams<W>& streams) : streams_{streams}
+        {}
+
+        T operator()() noexcept
+        {
+            if (index_ == buffer_size) {
+                refill();
+            }
+            return buffer_[index_++];
+        }
+
+        /**
+        * \brief Callable returning the next buffered number, for the functions taking a const rng that returns numbers
+        * in [0, 1). The generator references this object, which must outlive it
+        */
+        [[nodiscard]] auto generator() noexcept
+        {
+            return [this]() noexcept { return (*this)(); };
+        }
+
+    private:
+        void refill() noexcept
+        {
+            streams_.fill(std::span<T>{buffer_});
+            index_ = 0;
+        }
+
+        RandomStreams<W> streams_{};
+        std::array<T, buffer_size> buffer_{};
+        std::size_t index_{buffer_size};
+    };
+
+} // namespace Raychel
+
+#endif //!RAYCHELMATH_RANDOM_STREAMS_H
@@ -0,0 +1,337 @@
+/**
+* \file Rotation.h
+* \author Weckyy702 (weckyy702@gmail.com)
+* \brief Rotations around a fixed axis with their sine and cosine precomputed
+* \date 2026-10-16
+*
+* MIT License
+* Copyright (c) [2026] [Weckyy702 (weckyy702@gmail.com | https://github.com/Weckyy702)]
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+#ifndef RAYCHELMATH_ROTATION_H
+#define RAYCHELMATH_ROTATION_H
+
+#include "Matrix.h"
+#include "TupleSoA.h"
+#include "UnitQuaternion.h"
+#include "fastmath.h"
+#include "vec2.h"
+#include "vec3.h"
+
+#include <algorithm>
+#include <span>
+
+namespace Raychel {
+
+    namespace details {
+        //One Newton step towards sin^2 + cos^2 = 1 to counter drift when composing rotations
+        template <std::floating_point T>
+        constexpr SinCos<T> compose_sincos(const SinCos<T>& a, const SinCos<T>& b)
+        {
+            const T s = (a.sin * b.cos) + (a.cos * b.sin);
+            const T c = (a.cos * b.cos) - (a.sin * b.sin);
+            const T k = (T(3) - (sq(s) + sq(c))) / T(2);
+            return SinCos<T>{s * k, c * k};
+        }
+    } // namespace details
+
+    /**
+    * \brief Rotation around one of the coordinate axes. sin(theta) and cos(theta) are computed once on construction
+    *
+    * Rotating by it is the same as rotate_x, rotate_y or rotate_z with the same angle but costs four multiplies and no
+    * trigonometric functions, so build it once and apply it to as many vectors as needed.
+    *
+    * \tparam T Type of the rotation
+    * \tparam Axis Index of the axis to rotate around (0 = X, 1 = Y, 2 = Z)
+    */
+    template <std::floating_point T, std::size_t Axis>
+    requires(Axis < 3) class basic_axis_rotation
+    {
+    public:
+        //Indices of the two components the rotation changes. The rotation turns component i towards component j
+        static constexpr std::size_t i = (Axis + 1) % 3;
+        static constexpr std::size_t j = (Axis + 2) % 3;
+
+        //Identity rotation
+        constexpr basic_axis_rotation() = default;
+
+        /**
+        * \brief Construct a rotation by angle_in_rads radians around the axis
+        */
+        constexpr explicit basic_axis_rotation(T angle_in_rads) : sc_{details::math_sincos(angle_in_rads)}
+        {}
+
+        /**
+        * \brief Construct a rotation from sin(theta) and cos(theta) the caller has already computed
+        */
+        [[nodiscard]] static constexpr basic_axis_rotation from_sincos(T sin_theta, T cos_theta) noexcept
+        {
+            basic_axis_rotation res;
+            res.sc_ = SinCos<T>{sin_theta, cos_theta};
+            return res;
+        }
+
+        [[nodiscard]] constexpr T sin() const noexcept
+        {
+            return sc_.sin;
+        }
+
+        [[nodiscard]] constexpr T cos() const noexcept
+        {
+            return sc_.cos;
+        }
+
+        constexpr basic_vec3<T> operator()(const basic_vec3<T>& v) const noexcept
+        {
+            basic_vec3<T> res = v;
+            res[i] = (v[i] * sc_.cos) - (v[j] * sc_.sin);
+            res[j] = (v[i] * sc_.sin) + (v[j] * sc_.cos);
+            return res;
+        }
+
+    private:
+        SinCos<T> sc_{0, 1};
+    };
+
+    template <std::floating_point T>
+    using basic_rotation_x = basic_axis_rotation<T, 0>;
+
+    template <std::floating_point T>
+    using basic_rotation_y = basic_axis_rotation<T, 1>;
+
+    template <std::floating_point T>
+    using basic_rotation_z = basic_axis_rotation<T, 2>;
+
+    /**
+    * \brief Rotation in the plane. sin(theta) and cos(theta) are computed once on construction
+    *
+    * \tparam T Type of the rotation
+    */
+    template <std::floating_point T>
+    class basic_rotation2d
+    {
+    public:
+        //Identity rotation
+        constexpr basic_rotation2d() = default;
+
+        constexpr explicit basic_rotation2d(T angle_in_rads) : sc_{details::math_sincos(angle_in_rads)}
+        {}
+
+        [[nodiscard]] static constexpr basic_rotation2d from_sincos(T sin_theta, T cos_theta) noexcept
+        {
+            basic_rotation2d res;
+            res.sc_ = SinCos<T>{sin_theta, cos_theta};
+            return res;
+        }
+
+        [[nodiscard]] constexpr T sin() const noexcept
+        {
+            return sc_.sin;
+        }
+
+        [[nodiscard]] constexpr T cos() const noexcept
+        {
+            return sc_.cos;
+        }
+
+        constexpr basic_vec2<T> operator()(const basic_vec2<T>& v) const noexcept
+        {
+            return basic_vec2<T>{(v[0] * sc_.cos) - (v[1] * sc_.sin), (v[0] * sc_.sin) + (v[1] * sc_.cos)};
+        }
+
+    private:
+        SinCos<T> sc_{0, 1};
+    };
+
+    template <std::floating_point T, std::size_t Axis>
+    constexpr basic_vec3<T> apply(const basic_axis_rotation<T, Axis>& r, const basic_vec3<T>& v) noexcept
+    {
+        return r(v);
+    }
+
+    template <std::floating_point T>
+    constexpr basic_vec2<T> apply(const basic_rotation2d<T>& r, const basic_vec2<T>& v) noexcept
+    {
+        return r(v);
+    }
+
+    template <std::floating_point T, std::size_t Axis>
+    constexpr bool operator==(const basic_axis_rotation<T, Axis>& a, const basic_axis_rotation<T, Axis>& b) noexcept
+    {
+        return a.sin() == b.sin() && a.cos() == b.cos();
+    }
+
+    template <std::floating_point T>
+    constexpr bool operator==(const basic_rotation2d<T>& a, const basic_rotation2d<T>& b) noexcept
+    {
+        return a.sin() == b.sin() && a.cos() == b.cos();
+    }
+
+    /**
+    * \brief Rotation by the negative angle
+    */
+    template <std::floating_point T, std::size_t Axis>
+    constexpr basic_axis_rotation<T, Axis> inverse(const basic_axis_rotation<T, Axis>& r) noexcept
+    {
+        return basic_axis_rotation<T, Axis>::from_sincos(-r.sin(), r.cos());
+    }
+
+    template <std::floating_point T>
+    constexpr basic_rotation2d<T> inverse(const basic_rotation2d<T>& r) noexcept
+    {
+        return basic_rotation2d<T>::from_sincos(-r.sin(), r.cos());
+    }
+
+    /**
+    * \brief Compose two rotations around the same axis. The angles add, no trigonometric functions are evaluated
+    */
+    template <std::floating_point T, std::size_t Axis>
+    constexpr basic_axis_rotation<T, Axis> operator*(const basic_axis_rotation<T, Axis>& a, const basic_axis_rotation<T, Axis>& b) noexcept
+    {
+        const auto [s, c] = details::compose_sincos(SinCos<T>{a.sin(), a.cos()}, SinCos<T>{b.sin(), b.cos()});
+        return basic_axis_rotation<T, Axis>::from_sincos(s, c);
+    }
+
+    template <std::floating_point T>
+    constexpr basic_rotation2d<T> operator*(const basic_rotation2d<T>& a, const basic_rotation2d<T>& b) noexcept
+    {
+        const auto [s, c] = details::compose_sincos(SinCos<T>{a.sin(), a.cos()}, SinCos<T>{b.sin(), b.cos()});
+        return basic_rotation2d<T>::from_sincos(s, c);
+    }
+
+    /**
+    * \brief Get the rotation matrix equivalent to r. Rotations around different axes are composed by multiplying
+    * their matrices: (mat3_from_rotation(a) * mat3_from_rotation(b)) * v rotates by b first, then by a
+    */
+    template <std::floating_point T, std::size_t Axis>
+    constexpr basic_mat3<T> mat3_from_rotation(const basic_axis_rotation<T, Axis>& r) noexcept
+    {
+        constexpr auto i = basic_axis_rotation<T, Axis>::i;
+        constexpr auto j = basic_axis_rotation<T, Axis>::j;
+
+        basic_mat3<T> res{};
+        res(i, i) = r.cos();
+        res(i, j) = -r.sin();
+        res(j, i) = r.sin();
+        res(j, j) = r.cos();
+        return res;
+    }
+
+    /**
+    * \brief Get the unit quaternion equivalent to r. Rotations around different axes are composed by multiplying
+    * their quaternions: v * (quaternion_from_rotation(a) * quaternion_from_rotation(b)) rotates by b first, then by a
+    *
+    * The half angle is recovered from sin(theta) and cos(theta) with one square root
+    */
+    template <std::floating_point T, std::size_t Axis>
+    constexpr basic_unit_quaternion<T> quaternion_from_rotation(const basic_axis_rotation<T, Axis>& r)
+    {
+        //cos(theta/2) = sqrt((1 + cos)/2) and sin(theta) = 2 * sin(theta/2) * cos(theta/2). The division is
+        //only well-conditioned away from theta = pi, so fall back to sin(theta/2) = sqrt((1 - cos)/2) there
+        const T half_cos = details::math_sqrt(std::max(T(0), (T(1) + r.cos()) / T(2)));
+        const T half_sin = r.cos() >= T(0) ? r.sin() / (T(2) * half_cos)
+                                           : (r.sin() < T(0) ? T(-1) : T(1)) * details::math_sqrt((T(1) - r.cos()) / T(2));
+
+        basic_quaternion<T> q{half_cos, 0, 0, 0};
+        q[Axis + 1] = half_sin;
+        return basic_unit_quaternion<T>::from_normalized(q);
+    }
+
+    /**
+    * \brief Rotate every vector in in and write the results to out. in and out may be the same range
+    */
+    template <std::floating_point T, std::size_t Axis>
+    void apply_points(const basic_axis_rotation<T, Axis>& r, std::span<const basic_vec3<T>> in, std::span<basic_vec3<T>> out)
+    {
+        RAYCHEL_ASSERT(out.size() >= in.size());
+        for (std::size_t k{0}; k != in.size(); ++k) {
+            out[k] = r(in[k]);
+        }
+    }
+
+    /**
+    * \brief Rotate every vector in in and write the results to out. Only the two lanes that change are touched when
+    * rotating in place
+    */
+    template <std::floating_point T, std::size_t Axis>
+    void apply_points(const basic_axis_rotation<T, Axis>& r, const TupleSoA<T, 3, Vec3Tag>& in, TupleSoA<T, 3, Vec3Tag>& out)
+    {
+        constexpr auto i = basic_axis_rotation<T, Axis>::i;
+        constexpr auto j = basic_axis_rotation<T, Axis>::j;
+
+        if (&in != &out) {
+            out.resize(in.size());
+            std::ranges::copy(in.lane(Axis), out.lane(Axis).begin());
+        }
+
+        const auto *a = in.lane(i).data(), *b = in.lane(j).data();
+        auto *oa = out.lane(i).data(), *ob = out.lane(j).data();
+        const auto s = r.sin(), c = r.cos();
+
+        for (std::size_t k{0}; k != in.size(); ++k) {
+            const auto va = a[k];
+            const auto vb = b[k];
+            oa[k] = (va * c) - (vb * s);
+            ob[k] = (va * s) + (vb * c);
+        }
+    }
+
+    template <std::floating_point T>
+    void apply_points(const basic_rotation2d<T>& r, std::span<const basic_vec2<T>> in, std::span<basic_vec2<T>> out)
+    {
+        RAYCHEL_ASSERT(out.size() >= in.size());
+        const auto s = r.sin(), c = r.cos();
+        for (std::size_t k{0}; k != in.size(); ++k) {
+            const auto v = in[k];
+            out[k] = basic_vec2<T>{(v[0] * c) - (v[1] * s), (v[0] * s) + (v[1] * c)};
+        }
+    }
+
+    template <std::floating_point T>
+    void apply_points(const basic_rotation2d<T>& r, const TupleSoA<T, 2, vec2Tag>& in, TupleSoA<T, 2, vec2Tag>& out)
+    {
+        if (&in != &out) {
+            out.resize(in.size());
+        }
+
+        const auto *x = in.lane(0).data(), *y = in.lane(1).data();
+        auto *ox = out.lane(0).data(), *oy = out.lane(1).data();
+        const auto s = r.sin(), c = r.cos();
+
+        for (std::size_t k{0}; k != in.size(); ++k) {
+            const auto vx = x[k];
+            const auto vy = y[k];
+            ox[k] = (vx * c) - (vy * s);
+            oy[k] = (vx * s) + (vy * c);
+        }
+    }
+
+    /**
+    * \brief Rotate the 2D vector
+    */
+    template <std::floating_point T>
+    constexpr basic_vec2<T> rotate(const basic_vec2<T>& v, const basic_rotation2d<T>& r) noexcept
+    {
+        return r(v);
+    }
+
+} // namespace Raychel
+
+#endif //!RAYCHELMATH_ROTATION_H
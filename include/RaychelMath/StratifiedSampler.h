@@ -0,0 +1,270 @@
+/**
+* \file StratifiedSampler.h
+* \author Weckyy702 (weckyy702@gmail.com)
+* \brief Stratified, jittered and correlated multi-jittered 2D sample patterns
+* \date 2026-10-16
+*
+* MIT License
+* Copyright (c) [2026] [Weckyy702 (weckyy702@gmail.com | https://github.com/Weckyy702)]
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+#ifndef RAYCHELMATH_STRATIFIED_SAMPLER_H
+#define RAYCHELMATH_STRATIFIED_SAMPLER_H
+
+#include "RaychelCore/Raychel_assert.h"
+#include "low_discrepancy.h"
+#include "random.h"
+#include "vec2.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+namespace Raychel {
+
+    enum class StratifiedPattern {
+        //the centre of every cell. Ignores the seed
+        stratified,
+        //a random point in every cell
+        jittered,
+        //jittered, and additionally stratified in x and y separately like n-rooks (Kensler, "Correlated Multi-Jittered
+        //Sampling", 2013)
+        correlated_multi_jittered,
+    };
+
+    namespace details::stratified {
+
+        //Permutation of [0, length) selected by pattern, without a table (Kensler)
+        class Permutation
+        {
+        public:
+            constexpr Permutation(std::uint32_t length, std::uint32_t pattern) noexcept
+                : length_{length}, mask_{length - 1}, pattern_{pattern}, offset_{pattern % length}
+            {
+                mask_ |= mask_ >> 1U;
+                mask_ |= mask_ >> 2U;
+                mask_ |= mask_ >> 4U;
+                mask_ |= mask_ >> 8U;
+                mask_ |= mask_ >> 16U;
+            }
+
+            constexpr std::uint32_t operator()(std::uint32_t i) const noexcept
+            {
+                //hashing only the bits in mask_ is a bijection on them, so cycle walking stays in [0, length)
+                const auto w = mask_;
+                const auto p = pattern_;
+                do {
+                    i ^= p;
+                    i *= 0xE170893DU;
+                    i ^= p >> 16U;
+                    i ^= (i & w) >> 4U;
+                    i ^= p >> 8U;
+                    i *= 0x0929EB3FU;
+                    i ^= p >> 23U;
+                    i ^= (i & w) >> 1U;
+                    i *= 1U | (p >> 27U);
+                    i *= 0x6935FA69U;
+                    i ^= (i & w) >> 11U;
+                    i *= 0x74DCB303U;
+                    i ^= (i & w) >> 2U;
+                    i *= 0x9E501CC3U;
+                    i ^= (i & w) >> 2U;
+                    i *= 0xC860A3DFU;
+                    i &= w;
+                    i ^= i >> 5U;
+                } while (i >= length_);
+                //(i + pattern) % length without a division
+                i += offset_;
+                return i >= length_ ? i - length_ : i;
+            }
+
+        private:
+            std::uint32_t length_;
+            std::uint32_t mask_;
+            std::uint32_t pattern_;
+            std::uint32_t offset_;
+        };
+
+        //Random bits for sample i of pattern (Kensler)
+        constexpr std::uint32_t random_bits(std::uint32_t i, std::uint32_t pattern) noexcept
+        {
+            i ^= pattern;
+            i ^= i >> 17U;
+            i ^= i >> 10U;
+            i *= 0xB36534E5U;
+            i ^= i >> 12U;
+            i ^= i >> 21U;
+            i *= 0x93FC4795U;
+            i ^= 0xDF6E307FU;
+            i ^= i >> 17U;
+            i *= 1U | (pattern >> 18U);
+            return i;
+        }
+
+        template <std::floating_point T>
+        constexpr T jitter(std::uint32_t i, std::uint32_t pattern) noexcept
+        {
+            return random::uniform_from_bits<T>(random_bits(i, pattern));
+        }
+
+    } // namespace details::stratified
+
+    /**
+    * \brief Per pixel 2D sample patterns of strata_x * strata_y samples, one in each cell of a strata_x by strata_y grid.
+    *
+    * Every sample is computed from its index and the seed with a few integer hashes, so the sampler holds no buffers
+    * and costs nothing to copy or reseed. Seeding it with the pixel coordinates makes every tile reproducible no
+    * matter which thread renders it. Indices past sample_count() continue with new, independently seeded patterns.
+    */
+    class StratifiedSampler
+    {
+    public:
+        constexpr StratifiedSampler(
+            std::uint32_t strata_x,
+            std::uint32_t strata_y,
+            StratifiedPattern pattern = StratifiedPattern::correlated_multi_jittered,
+            std::uint32_t seed = 0) noexcept
+            : strata_x_{strata_x}, strata_y_{strata_y}, pattern_{pattern}, seed_{seed}
+        {
+            RAYCHEL_ASSERT(strata_x != 0 && strata_y != 0);
+            RAYCHEL_ASSERT(static_cast<std::uint64_t>(strata_x) * strata_y <= std::numeric_limits<std::uint32_t>::max());
+        }
+
+        constexpr void seed(std::uint32_t seed) noexcept
+        {
+            seed_ = seed;
+        }
+
+        /**
+        * \brief Seed for one pixel of one frame, the same on every thread
+        */
+        constexpr void seed(std::uint32_t pixel_x, std::uint32_t pixel_y, std::uint32_t frame = 0) noexcept
+        {
+            using details::low_discrepancy::hash_combine;
+            seed_ = hash_combine(hash_combine(hash_combine(0, pixel_x), pixel_y), frame);
+        }
+
+        [[nodiscard]] constexpr std::uint32_t sample_count() const noexcept
+        {
+            return strata_x_ * strata_y_;
+        }
+
+        [[nodiscard]] constexpr StratifiedPattern pattern() const noexcept
+        {
+            return pattern_;
+        }
+
+        template <std::floating_point T = float>
+        [[nodiscard]] constexpr basic_vec2<T> sample(std::uint32_t index) const noexcept
+        {
+            const auto count = sample_count();
+            return Instance{*this, index / count}.template sample<T>(index % count);
+        }
+
+        /**
+        * \brief out[i] = sample(first_index + i)
+        */
+        template <std::floating_point T>
+        constexpr void fill(std::span<basic_vec2<T>> out, std::uint32_t first_index = 0) const noexcept
+        {
+            const auto count = sample_count();
+            std::size_t done{0};
+            while (done != out.size()) {
+                const auto index = first_index + static_cast<std::uint32_t>(done);
+                const auto begin = index % count;
+                const auto end = begin + static_cast<std::uint32_t>(std::min<std::size_t>(count - begin, out.size() - done));
+
+                //the hashes that only depend on the pattern instance are set up once for all of its samples
+                const Instance instance{*this, index / count};
+                for (auto s = begin; s != end; ++s) {
+                    out[done++] = instance.template sample<T>(s);
+                }
+            }
+        }
+
+    private:
+        //One pattern of sample_count() samples
+        class Instance
+        {
+        public:
+            constexpr Instance(const StratifiedSampler& sampler, std::uint32_t instance) noexcept
+                : sampler_{sampler},
+                  seed_{details::low_discrepancy::hash_combine(sampler.seed_, instance)},
+                  shuffle_{sampler.sample_count(), seed_ * 0x51633E2DU},
+                  column_{sampler.strata_x_, seed_ * 0xA511E9B3U},
+                  row_{sampler.strata_y_, seed_ * 0x63D83595U}
+            {}
+
+            template <std::floating_point T>
+            constexpr basic_vec2<T> sample(std::uint32_t s) const noexcept
+            {
+                using details::stratified::jitter;
+
+                const auto m = static_cast<T>(sampler_.strata_x_);
+                const auto n = static_cast<T>(sampler_.strata_y_);
+                T x{};
+                T y{};
+                switch (sampler_.pattern_) {
+                    case StratifiedPattern::stratified:
+                        x = (static_cast<T>(s % sampler_.strata_x_) + T(.5)) / m;
+                        y = (static_cast<T>(s / sampler_.strata_x_) + T(.5)) / n;
+                        break;
+                    case StratifiedPattern::jittered:
+                        x = (static_cast<T>(s % sampler_.strata_x_) + jitter<T>(s, seed_ * 0xA399D265U)) / m;
+                        y = (static_cast<T>(s / sampler_.strata_x_) + jitter<T>(s, seed_ * 0x711AD6A5U)) / n;
+                        break;
+                    case StratifiedPattern::correlated_multi_jittered: {
+                        //shuffled so that the first few samples of a pattern are spread out as well
+                        s = shuffle_(s);
+                        const auto column = s % sampler_.strata_x_;
+                        const auto row = s / sampler_.strata_x_;
+                        //the same permutation in every row and column is what makes the pattern correlated
+                        const auto sx = column_(column);
+                        const auto sy = row_(row);
+                        x = (static_cast<T>(column) + ((static_cast<T>(sy) + jitter<T>(s, seed_ * 0xA399D265U)) / n)) / m;
+                        y = (static_cast<T>(row) + ((static_cast<T>(sx) + jitter<T>(s, seed_ * 0x711AD6A5U)) / m)) / n;
+                        break;
+                    }
+                }
+
+                //rounding must not reach 1
+                constexpr T one_minus_epsilon = T(1) - (std::numeric_limits<T>::epsilon() / 2);
+                return basic_vec2<T>{std::min(x, one_minus_epsilon), std::min(y, one_minus_epsilon)};
+            }
+
+        private:
+            const StratifiedSampler& sampler_;
+            std::uint32_t seed_;
+            details::stratified::Permutation shuffle_;
+            details::stratified::Permutation column_;
+            details::stratified::Permutation row_;
+        };
+
+    private:
+        std::uint32_t strata_x_;
+        std::uint32_t strata_y_;
+        StratifiedPattern pattern_;
+        std::uint32_t seed_;
+    };
+
+} // namespace Raychel
+
+#endif //!RAYCHELMATH_STRATIFIED_SAMPLER_H
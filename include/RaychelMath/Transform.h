@@ -28,10 +28,14 @@
 #ifndef RAYCHEL_TRANSFORM_H
 #define RAYCHEL_TRANSFORM_H
 
+#include "Matrix.h"
 #include "Quaternion.h"
+#include "TupleSoA.h"
 #include "forward.h"
 #include "vec3.h"
 
+#include <span>
+
 namespace Raychel {
 
     /**
@@ -52,6 +56,183 @@ namespace Raychel {
         return (v - t.offset) * t.rotation;
     }
 
+    /**
+    * \brief Get the affine matrix equivalent to apply(t, v)
+    */
+    template <Arithmetic T>
+    constexpr basic_mat4<T> mat4_from_transform(const basic_transform<T>& t)
+    {
+        const auto rotation = mat3_from_quaternion(t.rotation);
+        return mat4_from_affine(rotation, -(rotation * t.offset));
+    }
+
+    /**
+    *\brief Transform with the rotation precomputed as a matrix.
+    *
+    * Applying it costs one 3x3 matrix multiply instead of a normalize and a quaternion sandwich product.
+    * Compile once per object and use it in inner loops.
+    *
+    *\tparam T Type of the Transform
+    */
+    template <Arithmetic T>
+    struct basic_compiled_transform
+    {
+        constexpr basic_compiled_transform() = default;
+
+        constexpr explicit basic_compiled_transform(const basic_transform<T>& t)
+            : rotation{mat3_from_quaternion(t.rotation)}, offset{t.offset}, translation{-(rotation * t.offset)}
+        {}
+
+        basic_mat3<T> rotation{};
+        basic_vec3<T> offset{};
+        basic_vec3<T> translation{}; //-(rotation * offset), so that apply() is rotation * v + translation
+    };
+
+    template <Arithmetic T>
+    constexpr basic_mat4<T> mat4_from_transform(const basic_compiled_transform<T>& t)
+    {
+        return mat4_from_affine(t.rotation, t.translation);
+    }
+
+    template <Arithmetic T>
+    constexpr basic_vec3<T> apply(const basic_compiled_transform<T>& t, const basic_vec3<T>& v)
+    {
+        const auto& m = t.rotation;
+        // clang-format off
+        return basic_vec3<T>{
+            (m(0, 0) * v[0]) + (m(0, 1) * v[1]) + (m(0, 2) * v[2]) + t.translation[0],
+            (m(1, 0) * v[0]) + (m(1, 1) * v[1]) + (m(1, 2) * v[2]) + t.translation[1],
+            (m(2, 0) * v[0]) + (m(2, 1) * v[1]) + (m(2, 2) * v[2]) + t.translation[2]
+        };
+        // clang-format on
+    }
+
+    template <Arithmetic T>
+    constexpr basic_vec3<T> apply_direction(const basic_compiled_transform<T>& t, const basic_vec3<T>& d)
+    {
+        return t.rotation * d;
+    }
+
+    /**
+    *\brief Undo apply(t, v). The rotation matrix is orthonormal, so its inverse is its transpose
+    */
+    template <Arithmetic T>
+    constexpr basic_vec3<T> inverse_apply(const basic_compiled_transform<T>& t, const basic_vec3<T>& p)
+    {
+        const auto& m = t.rotation;
+        // clang-format off
+        return basic_vec3<T>{
+            (m(0, 0) * p[0]) + (m(1, 0) * p[1]) + (m(2, 0) * p[2]) + t.offset[0],
+            (m(0, 1) * p[0]) + (m(1, 1) * p[1]) + (m(2, 1) * p[2]) + t.offset[1],
+            (m(0, 2) * p[0]) + (m(1, 2) * p[1]) + (m(2, 2) * p[2]) + t.offset[2]
+        };
+        // clang-format on
+    }
+
+    template <Arithmetic T>
+    constexpr basic_vec3<T> inverse_apply_direction(const basic_compiled_transform<T>& t, const basic_vec3<T>& d)
+    {
+        const auto& m = t.rotation;
+        return basic_vec3<T>{dot(m.column(0), d), dot(m.column(1), d), dot(m.column(2), d)};
+    }
+
+    namespace details {
+        //out[j] = m * in[j] + translation for every element. in and out may be the same range
+        template <Arithmetic T>
+        void apply_affine(
+            const basic_mat3<T>& m, const basic_vec3<T>& translation, std::span<const basic_vec3<T>> in, std::span<basic_vec3<T>> out)
+        {
+            RAYCHEL_ASSERT(out.size() >= in.size());
+            for (std::size_t j{0}; j != in.size(); ++j) {
+                const auto v = in[j];
+                out[j] = basic_vec3<T>{
+                    (m(0, 0) * v[0]) + (m(0, 1) * v[1]) + (m(0, 2) * v[2]) + translation[0],
+                    (m(1, 0) * v[0]) + (m(1, 1) * v[1]) + (m(1, 2) * v[2]) + translation[1],
+                    (m(2, 0) * v[0]) + (m(2, 1) * v[1]) + (m(2, 2) * v[2]) + translation[2]};
+            }
+        }
+
+        template <Arithmetic T>
+        void apply_affine(
+            const basic_mat3<T>& m, const basic_vec3<T>& translation, const TupleSoA<T, 3, Vec3Tag>& in, TupleSoA<T, 3, Vec3Tag>& out)
+        {
+            if (&in != &out) {
+                out.resize(in.size());
+            }
+
+            const auto *x = in.lane(0).data(), *y = in.lane(1).data(), *z = in.lane(2).data();
+            auto *ox = out.lane(0).data(), *oy = out.lane(1).data(), *oz = out.lane(2).data();
+
+            const auto m00 = m(0, 0), m01 = m(0, 1), m02 = m(0, 2);
+            const auto m10 = m(1, 0), m11 = m(1, 1), m12 = m(1, 2);
+            const auto m20 = m(2, 0), m21 = m(2, 1), m22 = m(2, 2);
+            const auto t0 = translation[0], t1 = translation[1], t2 = translation[2];
+
+            for (std::size_t j{0}; j != in.size(); ++j) {
+                const auto vx = x[j];
+                const auto vy = y[j];
+                const auto vz = z[j];
+                ox[j] = (m00 * vx) + (m01 * vy) + (m02 * vz) + t0;
+                oy[j] = (m10 * vx) + (m11 * vy) + (m12 * vz) + t1;
+                oz[j] = (m20 * vx) + (m21 * vy) + (m22 * vz) + t2;
+            }
+        }
+    } // namespace details
+
+    /**
+    *\brief apply() every point in in and write the results to out. in and out may be the same range
+    */
+    template <Arithmetic T>
+    void apply_points(const basic_compiled_transform<T>& t, std::span<const basic_vec3<T>> in, std::span<basic_vec3<T>> out)
+    {
+        details::apply_affine(t.rotation, t.translation, in, out);
+    }
+
+    template <Arithmetic T>
+    void apply_points(const basic_compiled_transform<T>& t, const TupleSoA<T, 3, Vec3Tag>& in, TupleSoA<T, 3, Vec3Tag>& out)
+    {
+        details::apply_affine(t.rotation, t.translation, in, out);
+    }
+
+    template <Arithmetic T>
+    void apply_directions(const basic_compiled_transform<T>& t, std::span<const basic_vec3<T>> in, std::span<basic_vec3<T>> out)
+    {
+        details::apply_affine(t.rotation, basic_vec3<T>{}, in, out);
+    }
+
+    template <Arithmetic T>
+    void apply_directions(const basic_compiled_transform<T>& t, const TupleSoA<T, 3, Vec3Tag>& in, TupleSoA<T, 3, Vec3Tag>& out)
+    {
+        details::apply_affine(t.rotation, basic_vec3<T>{}, in, out);
+    }
+
+    template <Arithmetic T>
+    void inverse_apply_points(const basic_compiled_transform<T>& t, std::span<const basic_vec3<T>> in, std::span<basic_vec3<T>> out)
+    {
+        details::apply_affine(transpose(t.rotation), t.offset, in, out);
+    }
+
+    template <Arithmetic T>
+    void inverse_apply_points(
+        const basic_compiled_transform<T>& t, const TupleSoA<T, 3, Vec3Tag>& in, TupleSoA<T, 3, Vec3Tag>& out)
+    {
+        details::apply_affine(transpose(t.rotation), t.offset, in, out);
+    }
+
+    template <Arithmetic T>
+    void inverse_apply_directions(
+        const basic_compiled_transform<T>& t, std::span<const basic_vec3<T>> in, std::span<basic_vec3<T>> out)
+    {
+        details::apply_affine(transpose(t.rotation), basic_vec3<T>{}, in, out);
+    }
+
+    template <Arithmetic T>
+    void inverse_apply_directions(
+        const basic_compiled_transform<T>& t, const TupleSoA<T, 3, Vec3Tag>& in, TupleSoA<T, 3, Vec3Tag>& out)
+    {
+        details::apply_affine(transpose(t.rotation), basic_vec3<T>{}, in, out);
+    }
+
 } // namespace Raychel
 
 #endif //RAYCHEL_TRANSFORM_H
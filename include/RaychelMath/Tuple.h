@@ -31,6 +31,7 @@
 #include "RaychelCore/Raychel_assert.h"
 #include "RaychelMath/concepts.h"
 #include "TupleBase.h"
+#include "simd.h"
 
 #include <cstddef>
 #include <iostream>
@@ -55,6 +56,17 @@ namespace Raychel {
 
         template <std::size_t N, std::size_t... Indecies>
         constexpr auto indecies_valid = IndeciesValid<N, Indecies...>::value;
+
+        //Only lower scalar operations to the SIMD backend if converting the scalar to T first does not change the result
+        template <typename T, std::size_t N, typename T_>
+        constexpr bool simd_scalar_op()
+        {
+            if constexpr (simd::accelerated<T, N> && std::is_arithmetic_v<T_>) {
+                return std::is_same_v<std::common_type_t<T, T_>, T>;
+            } else {
+                return false;
+            }
+        }
     } // namespace details
 
     //Tag to identify "just a tuple" without further semantic meaning
@@ -120,6 +132,12 @@ namespace Raychel {
         template <TupleConvertable<Tag> Tag_>
         constexpr Tuple& operator+=(const Tuple<T, N, Tag_>& x)
         {
+            if constexpr (details::simd::accelerated<T, N>) {
+                if (!std::is_constant_evaluated()) {
+                    details::simd::add<T, N>(data_.data(), x.data());
+                    return *this;
+                }
+            }
             for (std::size_t i{0}; i != N; ++i) {
                 data_[i] = data_[i] + x[i];
             }
@@ -129,6 +147,12 @@ namespace Raychel {
         template <TupleConvertable<Tag> Tag_>
         constexpr Tuple& operator-=(const Tuple<T, N, Tag_>& x)
         {
+            if constexpr (details::simd::accelerated<T, N>) {
+                if (!std::is_constant_evaluated()) {
+                    details::simd::sub<T, N>(data_.data(), x.data());
+                    return *this;
+                }
+            }
             for (std::size_t i{0}; i != N; ++i) {
                 data_[i] = data_[i] - x[i];
             }
@@ -138,6 +162,12 @@ namespace Raychel {
         template <std::convertible_to<T> T_>
         constexpr Tuple& operator*=(T_ x)
         {
+            if constexpr (details::simd_scalar_op<T, N, T_>()) {
+                if (!std::is_constant_evaluated()) {
+                    details::simd::mul_scalar<T, N>(data_.data(), static_cast<T>(x));
+                    return *this;
+                }
+            }
             for (std::size_t i{0}; i != N; ++i) {
                 data_[i] = data_[i] * x;
             }
@@ -147,6 +177,12 @@ namespace Raychel {
         template <std::convertible_to<T> T_>
         constexpr Tuple& operator/=(T_ x)
         {
+            if constexpr (details::simd_scalar_op<T, N, T_>()) {
+                if (!std::is_constant_evaluated()) {
+                    details::simd::div_scalar<T, N>(data_.data(), static_cast<T>(x));
+                    return *this;
+                }
+            }
             for (std::size_t i{0}; i != N; ++i) {
                 data_[i] = data_[i] / x;
             }
@@ -209,6 +245,11 @@ namespace Raychel {
     template <Arithmetic T, std::size_t N, typename Tag, TupleConvertable<Tag> Tag_>
     constexpr bool operator==(const Tuple<T, N, Tag>& a, const Tuple<T, N, Tag_>& b)
     {
+        if constexpr (details::simd::accelerated<T, N>) {
+            if (!std::is_constant_evaluated()) {
+                return details::simd::equal<T, N>(a.data(), b.data());
+            }
+        }
         for (std::size_t i{0}; i != N; i++) {
             if (a[i] != b[i]) {
                 return false;
@@ -32,10 +32,21 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <iostream>
 
 namespace Raychel {
 
+    namespace details {
+        //Floating point tuples with a power-of-two size are aligned to that size (up to one 128 bit register),
+        //so they can be loaded with a single vector load and never straddle a cache line.
+        template <typename T, std::size_t N>
+        constexpr std::size_t tuple_alignment = std::max(
+            alignof(std::array<T, N>),
+            (std::is_floating_point_v<T> && std::has_single_bit(sizeof(T) * N) && (sizeof(T) * N) <= 16U) ? sizeof(T) * N
+                                                                                                          : std::size_t{1});
+    } // namespace details
+
     template <Arithmetic T, std::size_t N>
     requires(N != 0U) struct TupleBase
     {
@@ -77,6 +88,16 @@ namespace Raychel {
             return data_[I];
         }
 
+        constexpr T* data() noexcept
+        {
+            return data_.data();
+        }
+
+        constexpr const T* data() const noexcept
+        {
+            return data_.data();
+        }
+
         auto begin() noexcept
         {
             return data_.begin();
@@ -98,7 +119,7 @@ namespace Raychel {
         }
 
     protected:
-        std::array<T, N> data_{};
+        alignas(details::tuple_alignment<T, N>) std::array<T, N> data_{};
     };
 
     template <Arithmetic T, std::size_t N>
@@ -0,0 +1,344 @@
+/**
+* \file TupleExpression.h
+* \author Weckyy702 (weckyy702@gmail.com)
+* \brief Opt-in expression templates for temporary-free Tuple arithmetic
+* \date 2026-10-16
+*
+* MIT License
+* Copyright (c) [2026] [Weckyy702 (weckyy702@gmail.com | https://github.com/Weckyy702)]
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+#ifndef RAYCHELMATH_TUPLE_EXPRESSION_H
+#define RAYCHELMATH_TUPLE_EXPRESSION_H
+
+#include "Tuple.h"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+/*
+* Usage:
+*   const basic_vec3<T> r = lazy(b) * x + lazy(a) * (1 - x);
+*
+* lazy() turns a Tuple into an expression. Combining expressions (or expressions and Tuples) with +, -, * and / only
+* builds a tree of light-weight nodes. Every component is evaluated in one pass when the expression is converted into a
+* Tuple (or passed to eval()), so no intermediate Tuples are created.
+*
+* Expressions hold references to lvalue operands, so they must be materialized before those operands go out of scope.
+*/
+
+namespace Raychel {
+
+    namespace details {
+
+        template <typename T>
+        struct TupleInfo;
+
+        template <Arithmetic T, std::size_t N, typename Tag>
+        struct TupleInfo<Tuple<T, N, Tag>>
+        {
+            using value_type = T;
+            using tag_type = Tag;
+            static constexpr auto size = N;
+        };
+
+        template <typename T>
+        concept IsTuple = requires
+        {
+            typename TupleInfo<std::remove_cvref_t<T>>::value_type;
+        };
+
+        struct ExpressionAdd
+        {
+            template <typename A, typename B>
+            constexpr auto operator()(const A& a, const B& b) const
+            {
+                return a + b;
+            }
+        };
+
+        struct ExpressionSubtract
+        {
+            template <typename A, typename B>
+            constexpr auto operator()(const A& a, const B& b) const
+            {
+                return a - b;
+            }
+        };
+
+        struct ExpressionMultiply
+        {
+            template <typename A, typename B>
+            constexpr auto operator()(const A& a, const B& b) const
+            {
+                return a * b;
+            }
+        };
+
+        struct ExpressionDivide
+        {
+            template <typename A, typename B>
+            constexpr auto operator()(const A& a, const B& b) const
+            {
+                return a / b;
+            }
+        };
+
+    } // namespace details
+
+    /**
+    * \brief Common base of all expression nodes. Provides materialization into Tuples
+    *
+    * \tparam Derived expression node type. Must provide value_type, tag_type, size and operator[]
+    * \tparam T component type of the materialized Tuple
+    * \tparam N number of components
+    * \tparam Tag tag of the materialized Tuple
+    */
+    template <typename Derived, Arithmetic T, std::size_t N, typename Tag>
+    class TupleExpressionBase
+    {
+    public:
+        using value_type = T;
+        using tag_type = Tag;
+        static constexpr auto size = N;
+
+        template <typename Tag_>
+            requires(is_tuple_convertible_v<Tag, Tag_>)
+        constexpr operator Tuple<T, N, Tag_>() const //NOLINT(google-explicit-constructor): implicit materialization is the point
+        {
+            Tuple<T, N, Tag_> res;
+            const auto& self = static_cast<const Derived&>(*this);
+            for (std::size_t i{0}; i != N; ++i) {
+                res[i] = static_cast<T>(self[i]);
+            }
+            return res;
+        }
+    };
+
+    template <typename E>
+    concept TupleExpression = requires
+    {
+        typename std::remove_cvref_t<E>::value_type;
+        typename std::remove_cvref_t<E>::tag_type;
+        requires std::is_base_of_v<
+            TupleExpressionBase<
+                std::remove_cvref_t<E>,
+                typename std::remove_cvref_t<E>::value_type,
+                std::remove_cvref_t<E>::size,
+                typename std::remove_cvref_t<E>::tag_type>,
+            std::remove_cvref_t<E>>;
+    };
+
+    /**
+    * \brief Leaf of an expression tree. References lvalue Tuples and stores rvalue Tuples by value
+    */
+    template <typename Storage>
+    class TupleTerminalExpression
+        : public TupleExpressionBase<
+              TupleTerminalExpression<Storage>,
+              typename details::TupleInfo<std::remove_cvref_t<Storage>>::value_type,
+              details::TupleInfo<std::remove_cvref_t<Storage>>::size,
+              typename details::TupleInfo<std::remove_cvref_t<Storage>>::tag_type>
+    {
+    public:
+        constexpr explicit TupleTerminalExpression(Storage tuple) : tuple_{std::forward<Storage>(tuple)}
+        {}
+
+        constexpr auto operator[](std::size_t i) const
+        {
+            return tuple_[i];
+        }
+
+    private:
+        Storage tuple_;
+    };
+
+    template <TupleExpression L, TupleExpression R, typename Op>
+        requires(L::size == R::size && is_tuple_convertible_v<typename R::tag_type, typename L::tag_type>)
+    class TupleBinaryExpression
+        : public TupleExpressionBase<TupleBinaryExpression<L, R, Op>, typename L::value_type, L::size, typename L::tag_type>
+    {
+    public:
+        constexpr TupleBinaryExpression(L lhs, R rhs) : lhs_{std::move(lhs)}, rhs_{std::move(rhs)}
+        {}
+
+        constexpr auto operator[](std::size_t i) const
+        {
+            return Op{}(lhs_[i], rhs_[i]);
+        }
+
+    private:
+        L lhs_;
+        R rhs_;
+    };
+
+    template <TupleExpression E, typename S, typename Op, bool ScalarOnLeft>
+    class TupleScalarExpression
+        : public TupleExpressionBase<TupleScalarExpression<E, S, Op, ScalarOnLeft>, typename E::value_type, E::size, typename E::tag_type>
+    {
+    public:
+        constexpr TupleScalarExpression(E expression, S scalar) : expression_{std::move(expression)}, scalar_{scalar}
+        {}
+
+        constexpr auto operator[](std::size_t i) const
+        {
+            if constexpr (ScalarOnLeft) {
+                return Op{}(scalar_, expression_[i]);
+            } else {
+                return Op{}(expression_[i], scalar_);
+            }
+        }
+
+    private:
+        E expression_;
+        S scalar_;
+    };
+
+    template <TupleExpression E>
+    class TupleNegateExpression
+        : public TupleExpressionBase<TupleNegateExpression<E>, typename E::value_type, E::size, typename E::tag_type>
+    {
+    public:
+        constexpr explicit TupleNegateExpression(E expression) : expression_{std::move(expression)}
+        {}
+
+        constexpr auto operator[](std::size_t i) const
+        {
+            return -expression_[i];
+        }
+
+    private:
+        E expression_;
+    };
+
+    /**
+    * \brief Turn a Tuple into an expression. Lvalues are referenced, rvalues are moved into the expression
+    */
+    template <details::IsTuple T>
+    constexpr auto lazy(T&& tuple)
+    {
+        if constexpr (std::is_lvalue_reference_v<T>) {
+            return TupleTerminalExpression<const std::remove_cvref_t<T>&>{tuple};
+        } else {
+            return TupleTerminalExpression<std::remove_cvref_t<T>>{std::move(tuple)};
+        }
+    }
+
+    template <TupleExpression E>
+    constexpr auto lazy(E&& expression)
+    {
+        return std::remove_cvref_t<E>{std::forward<E>(expression)};
+    }
+
+    /**
+    * \brief Materialize an expression into a Tuple with the component type and tag of its left-most operand
+    */
+    template <TupleExpression E>
+    constexpr auto eval(const E& expression)
+    {
+        using Result = Tuple<typename E::value_type, E::size, typename E::tag_type>;
+        return static_cast<Result>(expression);
+    }
+
+    namespace details {
+        template <typename T>
+        concept ExpressionOperand = TupleExpression<T> || IsTuple<T>;
+
+        //at least one side of an operator must already be an expression, so plain Tuple arithmetic is unaffected
+        template <typename A, typename B>
+        concept ExpressionOperands = ExpressionOperand<A> && ExpressionOperand<B> && (TupleExpression<A> || TupleExpression<B>);
+
+        template <typename T>
+        concept ExpressionScalar = !ExpressionOperand<T> && Arithmetic<std::remove_cvref_t<T>>;
+
+        template <typename Op, typename A, typename B>
+        constexpr auto make_binary_expression(A&& a, B&& b)
+        {
+            using L = decltype(lazy(std::forward<A>(a)));
+            using R = decltype(lazy(std::forward<B>(b)));
+            return TupleBinaryExpression<L, R, Op>{lazy(std::forward<A>(a)), lazy(std::forward<B>(b))};
+        }
+    } // namespace details
+
+    template <typename A, typename B>
+        requires details::ExpressionOperands<A, B>
+    constexpr auto operator+(A&& a, B&& b)
+    {
+        return details::make_binary_expression<details::ExpressionAdd>(std::forward<A>(a), std::forward<B>(b));
+    }
+
+    template <typename A, typename B>
+        requires details::ExpressionOperands<A, B>
+    constexpr auto operator-(A&& a, B&& b)
+    {
+        return details::make_binary_expression<details::ExpressionSubtract>(std::forward<A>(a), std::forward<B>(b));
+    }
+
+    template <TupleExpression E, details::ExpressionScalar S>
+    constexpr auto operator*(E&& e, S s)
+    {
+        using Expr = std::remove_cvref_t<E>;
+        return TupleScalarExpression<Expr, S, details::ExpressionMultiply, false>{std::forward<E>(e), s};
+    }
+
+    template <TupleExpression E, details::ExpressionScalar S>
+    constexpr auto operator*(S s, E&& e)
+    {
+        using Expr = std::remove_cvref_t<E>;
+        return TupleScalarExpression<Expr, S, details::ExpressionMultiply, true>{std::forward<E>(e), s};
+    }
+
+    template <TupleExpression E, details::ExpressionScalar S>
+    constexpr auto operator/(E&& e, S s)
+    {
+        using Expr = std::remove_cvref_t<E>;
+        return TupleScalarExpression<Expr, S, details::ExpressionDivide, false>{std::forward<E>(e), s};
+    }
+
+    template <TupleExpression E>
+    constexpr auto operator-(E&& e)
+    {
+        using Expr = std::remove_cvref_t<E>;
+        return TupleNegateExpression<Expr>{std::forward<E>(e)};
+    }
+
+    /**
+    * \brief Dot product of two expressions (or an expression and a Tuple) without materializing either of them
+    */
+    template <typename A, typename B>
+        requires details::ExpressionOperands<A, B>
+    constexpr auto dot(const A& a, const B& b)
+    {
+        const auto lhs = lazy(a);
+        const auto rhs = lazy(b);
+        using L = std::remove_cvref_t<decltype(lhs)>;
+        static_assert(L::size == std::remove_cvref_t<decltype(rhs)>::size, "Operands of dot() must have the same size");
+
+        typename L::value_type res = lhs[0] * rhs[0];
+        for (std::size_t i{1}; i != L::size; ++i) {
+            res = res + (lhs[i] * rhs[i]);
+        }
+        return res;
+    }
+
+} // namespace Raychel
+
+#endif //!RAYCHELMATH_TUPLE_EXPRESSION_H
@@ -0,0 +1,504 @@
+/**
+* \file TupleSoA.h
+* \author Weckyy702 (weckyy702@gmail.com)
+* \brief Header file for TupleSoA class
+* \date 2026-10-16
+*
+* MIT License
+* Copyright (c) [2026] [Weckyy702 (weckyy702@gmail.com | https://github.com/Weckyy702)]
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+#ifndef RAYCHELMATH_TUPLE_SOA_H
+#define RAYCHELMATH_TUPLE_SOA_H
+
+#include "RaychelCore/Raychel_assert.h"
+#include "Tuple.h"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace Raychel {
+
+    template <Arithmetic T, std::size_t N, typename Tag = TupleTag>
+        requires(N != 0)
+    class TupleSoA;
+
+    /**
+    * \brief Proxy for a single element inside a TupleSoA. Behaves like a Tuple<T, N, Tag> but refers to the container storage
+    *
+    * \tparam Container (possibly const qualified) TupleSoA type
+    */
+    template <typename Container>
+    class TupleSoAReference
+    {
+        using _container = std::remove_const_t<Container>;
+        static constexpr bool is_const = std::is_const_v<Container>;
+
+    public:
+        using value_type = typename _container::value_type;
+        using component_type = typename _container::component_type;
+        using reference = std::conditional_t<is_const, const component_type&, component_type&>;
+
+        static constexpr auto size = _container::components;
+
+        TupleSoAReference(Container& container, std::size_t index) : container_{&container}, index_{index}
+        {}
+
+        //The copy refers to the same element (container pointer and index), like copying a pointer
+        TupleSoAReference(const TupleSoAReference&) = default;
+
+        //Assigning a reference copies the referenced values, not the reference itself
+        TupleSoAReference& operator=(const TupleSoAReference& other)
+            requires(!is_const)
+        {
+            return *this = other.load();
+        }
+
+        template <TupleConvertable<typename _container::tag_type> Tag_>
+        TupleSoAReference& operator=(const Tuple<component_type, size, Tag_>& value)
+            requires(!is_const)
+        {
+            for (std::size_t i{0}; i != size; ++i) {
+                (*this)[i] = value[i];
+            }
+            return *this;
+        }
+
+        reference operator[](std::size_t i) const
+        {
+            return container_->lane(i)[index_];
+        }
+
+        template <std::size_t I>
+            requires(I < size)
+        component_type get() const
+        {
+            return (*this)[I];
+        }
+
+        [[nodiscard]] value_type load() const
+        {
+            value_type res;
+            for (std::size_t i{0}; i != size; ++i) {
+                res[i] = (*this)[i];
+            }
+            return res;
+        }
+
+        operator value_type() const //NOLINT(google-explicit-constructor): The proxy should be usable wherever a Tuple is
+        {
+            return load();
+        }
+
+        template <TupleConvertable<typename _container::tag_type> Tag_>
+        TupleSoAReference& operator+=(const Tuple<component_type, size, Tag_>& x)
+            requires(!is_const)
+        {
+            for (std::size_t i{0}; i != size; ++i) {
+                (*this)[i] = (*this)[i] + x[i];
+            }
+            return *this;
+        }
+
+        template <TupleConvertable<typename _container::tag_type> Tag_>
+        TupleSoAReference& operator-=(const Tuple<component_type, size, Tag_>& x)
+            requires(!is_const)
+        {
+            for (std::size_t i{0}; i != size; ++i) {
+                (*this)[i] = (*this)[i] - x[i];
+            }
+            return *this;
+        }
+
+        template <std::convertible_to<component_type> T_>
+        TupleSoAReference& operator*=(T_ x)
+            requires(!is_const)
+        {
+            for (std::size_t i{0}; i != size; ++i) {
+                (*this)[i] = (*this)[i] * x;
+            }
+            return *this;
+        }
+
+        template <std::convertible_to<component_type> T_>
+        TupleSoAReference& operator/=(T_ x)
+            requires(!is_const)
+        {
+            for (std::size_t i{0}; i != size; ++i) {
+                (*this)[i] = (*this)[i] / x;
+            }
+            return *this;
+        }
+
+    private:
+        Container* container_;
+        std::size_t index_;
+    };
+
+    /**
+    * \brief Structure-of-arrays container for Tuples. Every component is stored in its own contiguous lane.
+    *
+    * The bulk operations defined below walk the lanes linearly, which lets the compiler vectorize them.
+    *
+    * \tparam T Component type
+    * \tparam N Number of components per element
+    * \tparam Tag Tag of the stored Tuples
+    */
+    template <Arithmetic T, std::size_t N, typename Tag>
+        requires(N != 0)
+    class TupleSoA
+    {
+    public:
+        using value_type = Tuple<T, N, Tag>;
+        using component_type = T;
+        using tag_type = Tag;
+        using reference = TupleSoAReference<TupleSoA>;
+        using const_reference = TupleSoAReference<const TupleSoA>;
+
+        static constexpr auto components = N;
+
+        TupleSoA() = default;
+
+        explicit TupleSoA(std::size_t size)
+        {
+            resize(size);
+        }
+
+        template <TupleConvertable<Tag> Tag_>
+        explicit TupleSoA(std::span<const Tuple<T, N, Tag_>> values)
+        {
+            load(values);
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return lanes_[0].size();
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return lanes_[0].empty();
+        }
+
+        void resize(std::size_t size)
+        {
+            for (auto& lane : lanes_) {
+                lane.resize(size);
+            }
+        }
+
+        void reserve(std::size_t capacity)
+        {
+            for (auto& lane : lanes_) {
+                lane.reserve(capacity);
+            }
+        }
+
+        void clear() noexcept
+        {
+            for (auto& lane : lanes_) {
+                lane.clear();
+            }
+        }
+
+        template <TupleConvertable<Tag> Tag_>
+        void push_back(const Tuple<T, N, Tag_>& value)
+        {
+            for (std::size_t i{0}; i != N; ++i) {
+                lanes_[i].push_back(value[i]);
+            }
+        }
+
+        reference operator[](std::size_t index)
+        {
+            RAYCHEL_ASSERT(index < size());
+            return reference{*this, index};
+        }
+
+        const_reference operator[](std::size_t index) const
+        {
+            RAYCHEL_ASSERT(index < size());
+            return const_reference{*this, index};
+        }
+
+        std::span<T> lane(std::size_t component) noexcept
+        {
+            RAYCHEL_ASSERT(component < N);
+            return lanes_[component];
+        }
+
+        std::span<const T> lane(std::size_t component) const noexcept
+        {
+            RAYCHEL_ASSERT(component < N);
+            return lanes_[component];
+        }
+
+        /**
+        * \brief Replace the contents of the container with the values of an array-of-structures span
+        */
+        template <TupleConvertable<Tag> Tag_>
+        void load(std::span<const Tuple<T, N, Tag_>> values)
+        {
+            resize(values.size());
+            for (std::size_t i{0}; i != N; ++i) {
+                auto* lane = lanes_[i].data();
+                for (std::size_t j{0}; j != values.size(); ++j) {
+                    lane[j] = values[j][i];
+                }
+            }
+        }
+
+        /**
+        * \brief Write the contents of the container into an array-of-structures span. out must hold at least size() elements
+        */
+        template <typename Tag_>
+            requires(is_tuple_convertible_v<Tag, Tag_>)
+        void store(std::span<Tuple<T, N, Tag_>> out) const
+        {
+            RAYCHEL_ASSERT(out.size() >= size());
+            for (std::size_t i{0}; i != N; ++i) {
+                const auto* lane = lanes_[i].data();
+                for (std::size_t j{0}; j != size(); ++j) {
+                    out[j][i] = lane[j];
+                }
+            }
+        }
+
+        [[nodiscard]] std::vector<value_type> to_aos() const
+        {
+            std::vector<value_type> res(size());
+            store(std::span{res});
+            return res;
+        }
+
+        template <TupleConvertable<Tag> Tag_>
+        TupleSoA& operator+=(const TupleSoA<T, N, Tag_>& x)
+        {
+            RAYCHEL_ASSERT(size() == x.size());
+            for (std::size_t i{0}; i != N; ++i) {
+                auto* lane = lanes_[i].data();
+                const auto* other = x.lane(i).data();
+                for (std::size_t j{0}; j != size(); ++j) {
+                    lane[j] = lane[j] + other[j];
+                }
+            }
+            return *this;
+        }
+
+        template <TupleConvertable<Tag> Tag_>
+        TupleSoA& operator-=(const TupleSoA<T, N, Tag_>& x)
+        {
+            RAYCHEL_ASSERT(size() == x.size());
+            for (std::size_t i{0}; i != N; ++i) {
+                auto* lane = lanes_[i].data();
+                const auto* other = x.lane(i).data();
+                for (std::size_t j{0}; j != size(); ++j) {
+                    lane[j] = lane[j] - other[j];
+                }
+            }
+            return *this;
+        }
+
+        template <std::convertible_to<T> T_>
+        TupleSoA& operator*=(T_ _x)
+        {
+            const auto x = static_cast<T>(_x);
+            for (auto& lane : lanes_) {
+                for (auto& value : lane) {
+                    value = value * x;
+                }
+            }
+            return *this;
+        }
+
+        template <std::convertible_to<T> T_>
+        TupleSoA& operator/=(T_ _x)
+        {
+            const auto x = static_cast<T>(_x);
+            for (auto& lane : lanes_) {
+                for (auto& value : lane) {
+                    value = value / x;
+                }
+            }
+            return *this;
+        }
+
+    private:
+        std::array<std::vector<T>, N> lanes_{};
+    };
+
+    template <Arithmetic T, std::size_t N, typename Tag>
+    TupleSoA(std::span<const Tuple<T, N, Tag>>) -> TupleSoA<T, N, Tag>;
+
+    template <Arithmetic T, std::size_t N, typename Tag>
+    TupleSoA(std::span<Tuple<T, N, Tag>>) -> TupleSoA<T, N, Tag>;
+
+    template <Arithmetic T, std::size_t N, typename Tag, TupleConvertable<Tag> Tag_>
+    TupleSoA<T, N, Tag> operator+(const TupleSoA<T, N, Tag>& a, const TupleSoA<T, N, Tag_>& b)
+    {
+        auto res{a};
+        res += b;
+        return res;
+    }
+
+    template <Arithmetic T, std::size_t N, typename Tag, TupleConvertable<Tag> Tag_>
+    TupleSoA<T, N, Tag> operator-(const TupleSoA<T, N, Tag>& a, const TupleSoA<T, N, Tag_>& b)
+    {
+        auto res{a};
+        res -= b;
+        return res;
+    }
+
+    template <Arithmetic T, std::size_t N, typename Tag, std::convertible_to<T> T_>
+    TupleSoA<T, N, Tag> operator*(const TupleSoA<T, N, Tag>& a, T_ s)
+    {
+        auto res{a};
+        res *= s;
+        return res;
+    }
+
+    template <Arithmetic T, std::size_t N, typename Tag, std::convertible_to<T> T_>
+    TupleSoA<T, N, Tag> operator*(T_ s, const TupleSoA<T, N, Tag>& a)
+    {
+        return a * s;
+    }
+
+    template <Arithmetic T, std::size_t N, typename Tag, std::convertible_to<T> T_>
+    TupleSoA<T, N, Tag> operator/(const TupleSoA<T, N, Tag>& a, T_ s)
+    {
+        auto res{a};
+        res /= s;
+        return res;
+    }
+
+    /**
+    * \brief Element-wise dot product of two containers. out must hold at least a.size() elements
+    */
+    template <Arithmetic T, std::size_t N, typename Tag, TupleConvertable<Tag> Tag_>
+    void dot(const TupleSoA<T, N, Tag>& a, const TupleSoA<T, N, Tag_>& b, std::span<T> out)
+    {
+        RAYCHEL_ASSERT(a.size() == b.size());
+        RAYCHEL_ASSERT(out.size() >= a.size());
+
+        const auto size = a.size();
+        {
+            const auto* x = a.lane(0).data();
+            const auto* y = b.lane(0).data();
+            for (std::size_t j{0}; j != size; ++j) {
+                out[j] = x[j] * y[j];
+            }
+        }
+        for (std::size_t i{1}; i != N; ++i) {
+            const auto* x = a.lane(i).data();
+            const auto* y = b.lane(i).data();
+            for (std::size_t j{0}; j != size; ++j) {
+                out[j] = out[j] + (x[j] * y[j]);
+            }
+        }
+    }
+
+    template <Arithmetic T, std::size_t N, typename Tag, TupleConvertable<Tag> Tag_>
+    std::vector<T> dot(const TupleSoA<T, N, Tag>& a, const TupleSoA<T, N, Tag_>& b)
+    {
+        std::vector<T> res(a.size());
+        dot(a, b, std::span{res});
+        return res;
+    }
+
+    template <Arithmetic T, std::size_t N, typename Tag>
+    void mag_sq(const TupleSoA<T, N, Tag>& a, std::span<T> out)
+    {
+        dot(a, a, out);
+    }
+
+    template <Arithmetic T, std::size_t N, typename Tag>
+    std::vector<T> mag_sq(const TupleSoA<T, N, Tag>& a)
+    {
+        return dot(a, a);
+    }
+
+    template <Arithmetic T, std::size_t N, typename Tag>
+    void mag(const TupleSoA<T, N, Tag>& a, std::span<T> out)
+    {
+        using std::sqrt;
+        mag_sq(a, out);
+        for (std::size_t j{0}; j != a.size(); ++j) {
+            out[j] = static_cast<T>(sqrt(out[j]));
+        }
+    }
+
+    template <Arithmetic T, std::size_t N, typename Tag>
+    std::vector<T> mag(const TupleSoA<T, N, Tag>& a)
+    {
+        std::vector<T> res(a.size());
+        mag(a, std::span{res});
+        return res;
+    }
+
+    template <std::floating_point T, std::size_t N, typename Tag>
+    TupleSoA<T, N, Tag> normalize(const TupleSoA<T, N, Tag>& a)
+    {
+        using std::sqrt;
+
+        const auto size = a.size();
+        std::vector<T> inv_mag(size);
+        mag_sq(a, std::span{inv_mag});
+        for (auto& m : inv_mag) {
+            m = T(1) / sqrt(m);
+        }
+
+        TupleSoA<T, N, Tag> res(size);
+        for (std::size_t i{0}; i != N; ++i) {
+            const auto* x = a.lane(i).data();
+            auto* out = res.lane(i).data();
+            for (std::size_t j{0}; j != size; ++j) {
+                out[j] = x[j] * inv_mag[j];
+            }
+        }
+        return res;
+    }
+
+    template <Arithmetic T, typename Tag, TupleConvertable<Tag> Tag_>
+    TupleSoA<T, 3, Tag> cross(const TupleSoA<T, 3, Tag>& a, const TupleSoA<T, 3, Tag_>& b)
+    {
+        RAYCHEL_ASSERT(a.size() == b.size());
+
+        const auto size = a.size();
+        TupleSoA<T, 3, Tag> res(size);
+
+        const auto *ax = a.lane(0).data(), *ay = a.lane(1).data(), *az = a.lane(2).data();
+        const auto *bx = b.lane(0).data(), *by = b.lane(1).data(), *bz = b.lane(2).data();
+        auto *rx = res.lane(0).data(), *ry = res.lane(1).data(), *rz = res.lane(2).data();
+
+        for (std::size_t j{0}; j != size; ++j) {
+            rx[j] = (ay[j] * bz[j]) - (az[j] * by[j]);
+            ry[j] = (az[j] * bx[j]) - (ax[j] * bz[j]);
+            rz[j] = (ax[j] * by[j]) - (ay[j] * bx[j]);
+        }
+        return res;
+    }
+
+} // namespace Raychel
+
+#endif //!RAYCHELMATH_TUPLE_SOA_H
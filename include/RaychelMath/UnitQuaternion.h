@@ -0,0 +1,183 @@
+/**
+* \file UnitQuaternion.h
+* \author Weckyy702 (weckyy702@gmail.com)
+* \brief Quaternion type that is guaranteed to be normalized
+* \date 2026-10-16
+*
+* MIT License
+* Copyright (c) [2026] [Weckyy702 (weckyy702@gmail.com | https://github.com/Weckyy702)]
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+#ifndef RAYCHELMATH_UNIT_QUATERNION_H
+#define RAYCHELMATH_UNIT_QUATERNION_H
+
+#include "Matrix.h"
+#include "Quaternion.h"
+#include "vec3.h"
+
+#include <cmath>
+
+namespace Raychel {
+
+    /**
+    * \brief Quaternion with magnitude 1. Rotating by it, inverting and composing never needs to re-normalize
+    *
+    * The invariant is established on construction (explicit normalization or unit_rotate_around) and maintained by
+    * composition, which applies one cheap Newton step instead of a full normalize to counter floating point drift.
+    *
+    * \tparam T Type of the quaternion
+    */
+    template <std::floating_point T>
+    class basic_unit_quaternion
+    {
+    public:
+        //Identity rotation
+        constexpr basic_unit_quaternion() = default;
+
+        constexpr explicit basic_unit_quaternion(const basic_quaternion<T>& q) : q_{normalize(q)}
+        {}
+
+        /**
+        * \brief Wrap a quaternion the caller knows to be normalized. Only checked in debug builds
+        */
+        [[nodiscard]] static constexpr basic_unit_quaternion from_normalized(const basic_quaternion<T>& q)
+        {
+            if (!std::is_constant_evaluated()) {
+                RAYCHEL_ASSERT(std::abs(mag_sq(q) - 1) < T(1e-3));
+            }
+            basic_unit_quaternion res;
+            res.q_ = q;
+            return res;
+        }
+
+        [[nodiscard]] constexpr const basic_quaternion<T>& quaternion() const noexcept
+        {
+            return q_;
+        }
+
+        constexpr operator const basic_quaternion<T>&() const noexcept //NOLINT(google-explicit-constructor): a unit quaternion is a quaternion
+        {
+            return q_;
+        }
+
+        constexpr T operator[](std::size_t i) const
+        {
+            return q_[i];
+        }
+
+        constexpr basic_unit_quaternion& operator*=(const basic_unit_quaternion& b)
+        {
+            q_ *= b.q_;
+            q_ *= (T(3) - mag_sq(q_)) / T(2); //first order Newton step towards |q| = 1. No sqrt, no division
+            return *this;
+        }
+
+    private:
+        basic_quaternion<T> q_{};
+    };
+
+    template <std::floating_point T>
+    constexpr bool operator==(const basic_unit_quaternion<T>& a, const basic_unit_quaternion<T>& b)
+    {
+        return a.quaternion() == b.quaternion();
+    }
+
+    template <std::floating_point T>
+    constexpr bool operator!=(const basic_unit_quaternion<T>& a, const basic_unit_quaternion<T>& b)
+    {
+        return !(a == b);
+    }
+
+    /**
+    * \brief Same as rotate_around, but returns a basic_unit_quaternion
+    */
+    template <std::floating_point T, std::convertible_to<T> T_>
+    constexpr basic_unit_quaternion<T> unit_rotate_around(const basic_vec3<T>& axis, T_ angle_in_rads)
+    {
+        return basic_unit_quaternion<T>::from_normalized(rotate_around(axis, angle_in_rads));
+    }
+
+    /**
+    * \brief Re-normalize a quaternion that is already close to unit length using one Newton step
+    */
+    template <std::floating_point T>
+    constexpr basic_unit_quaternion<T> renormalize(const basic_unit_quaternion<T>& q)
+    {
+        return basic_unit_quaternion<T>::from_normalized(q.quaternion() * ((T(3) - mag_sq(q.quaternion())) / T(2)));
+    }
+
+    template <std::floating_point T>
+    constexpr basic_unit_quaternion<T> operator*(const basic_unit_quaternion<T>& a, const basic_unit_quaternion<T>& b)
+    {
+        auto res{a};
+        res *= b;
+        return res;
+    }
+
+    template <std::floating_point T>
+    constexpr basic_unit_quaternion<T> conjugate(const basic_unit_quaternion<T>& q)
+    {
+        return basic_unit_quaternion<T>::from_normalized(conjugate(q.quaternion()));
+    }
+
+    //The inverse of a unit quaternion is its conjugate
+    template <std::floating_point T>
+    constexpr basic_unit_quaternion<T> inverse(const basic_unit_quaternion<T>& q)
+    {
+        return conjugate(q);
+    }
+
+    template <std::floating_point T>
+    constexpr basic_unit_quaternion<T> operator/(const basic_unit_quaternion<T>& a, const basic_unit_quaternion<T>& b)
+    {
+        return a * conjugate(b);
+    }
+
+    /**
+    * \brief Rotate v by q. Same result as v * q.quaternion(), but without normalizing q first
+    */
+    template <std::floating_point T>
+    constexpr basic_vec3<T> operator*(const basic_vec3<T>& v, const basic_unit_quaternion<T>& q)
+    {
+        //v' = v + w * t + u x t with t = 2 * (u x v)
+        const basic_vec3<T> u{q[1], q[2], q[3]};
+        const auto t = cross(u, v) * T(2);
+        return v + (t * q[0]) + cross(u, t);
+    }
+
+    template <std::floating_point T>
+    constexpr basic_mat3<T> mat3_from_quaternion(const basic_unit_quaternion<T>& q)
+    {
+        const auto w = q[0];
+        const auto x = q[1];
+        const auto y = q[2];
+        const auto z = q[3];
+
+        // clang-format off
+        return mat3_from_rows(
+            basic_vec3<T>{1 - 2 * (y * y + z * z), 2 * (x * y - w * z),     2 * (x * z + w * y)},
+            basic_vec3<T>{2 * (x * y + w * z),     1 - 2 * (x * x + z * z), 2 * (y * z - w * x)},
+            basic_vec3<T>{2 * (x * z - w * y),     2 * (y * z + w * x),     1 - 2 * (x * x + y * y)});
+        // clang-format on
+    }
+
+} // namespace Raychel
+
+#endif //!RAYCHELMATH_UNIT_QUATERNION_H
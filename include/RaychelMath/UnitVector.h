@@ -0,0 +1,228 @@
+/**
+* \file UnitVector.h
+* \author Weckyy702 (weckyy702@gmail.com)
+* \brief Vector type that is guaranteed to be normalized
+* \date 2026-10-16
+*
+* MIT License
+* Copyright (c) [2026] [Weckyy702 (weckyy702@gmail.com | https://github.com/Weckyy702)]
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+#ifndef RAYCHELMATH_UNIT_VECTOR_H
+#define RAYCHELMATH_UNIT_VECTOR_H
+
+#include "UnitQuaternion.h"
+#include "constants.h"
+#include "vec3.h"
+#include "vector.h"
+
+#include <array>
+#include <cmath>
+
+namespace Raychel {
+
+    /**
+    * \brief 3D vector with magnitude 1. Functions that need unit length input skip normalization for it
+    *
+    * \tparam T Type of the vector
+    */
+    template <std::floating_point T>
+    class basic_unit_vec3
+    {
+    public:
+        //+Y, the "up" axis of the frames returned by get_basis_vectors
+        constexpr basic_unit_vec3() = default;
+
+        constexpr explicit basic_unit_vec3(const basic_vec3<T>& v) : v_{normalize(v)}
+        {}
+
+        /**
+        * \brief Wrap a vector the caller knows to be normalized. Only checked in debug builds
+        */
+        [[nodiscard]] static constexpr basic_unit_vec3 from_normalized(const basic_vec3<T>& v)
+        {
+            if (!std::is_constant_evaluated()) {
+                RAYCHEL_ASSERT(std::abs(mag_sq(v) - 1) < T(1e-3));
+            }
+            basic_unit_vec3 res;
+            res.v_ = v;
+            return res;
+        }
+
+        [[nodiscard]] constexpr const basic_vec3<T>& vector() const noexcept
+        {
+            return v_;
+        }
+
+        constexpr operator const basic_vec3<T>&() const noexcept //NOLINT(google-explicit-constructor): a unit vector is a vector
+        {
+            return v_;
+        }
+
+        constexpr T operator[](std::size_t i) const
+        {
+            return v_[i];
+        }
+
+        [[nodiscard]] constexpr T x() const noexcept
+        {
+            return v_[0];
+        }
+
+        [[nodiscard]] constexpr T y() const noexcept
+        {
+            return v_[1];
+        }
+
+        [[nodiscard]] constexpr T z() const noexcept
+        {
+            return v_[2];
+        }
+
+    private:
+        basic_vec3<T> v_{0, 1, 0};
+    };
+
+    template <std::floating_point T>
+    constexpr bool operator==(const basic_unit_vec3<T>& a, const basic_unit_vec3<T>& b)
+    {
+        return a.vector() == b.vector();
+    }
+
+    template <std::floating_point T>
+    constexpr bool operator!=(const basic_unit_vec3<T>& a, const basic_unit_vec3<T>& b)
+    {
+        return !(a == b);
+    }
+
+    template <std::floating_point T>
+    constexpr basic_unit_vec3<T> operator-(const basic_unit_vec3<T>& v)
+    {
+        return basic_unit_vec3<T>::from_normalized(-v.vector());
+    }
+
+    template <std::floating_point T>
+    constexpr T dot(const basic_unit_vec3<T>& a, const basic_unit_vec3<T>& b) noexcept
+    {
+        return dot(a.vector(), b.vector());
+    }
+
+    template <std::floating_point T>
+    constexpr T dot(const basic_unit_vec3<T>& a, const basic_vec3<T>& b) noexcept
+    {
+        return dot(a.vector(), b);
+    }
+
+    template <std::floating_point T>
+    constexpr T dot(const basic_vec3<T>& a, const basic_unit_vec3<T>& b) noexcept
+    {
+        return dot(a, b.vector());
+    }
+
+    /**
+    * \brief Reflect direction along a unit normal. The reflection of a unit vector is a unit vector
+    */
+    template <std::floating_point T>
+    constexpr basic_unit_vec3<T> reflect(const basic_unit_vec3<T>& direction, const basic_unit_vec3<T>& normal) noexcept
+    {
+        return basic_unit_vec3<T>::from_normalized(reflect(direction.vector(), normal.vector()));
+    }
+
+    template <std::floating_point T>
+    constexpr basic_vec3<T> reflect(const basic_vec3<T>& direction, const basic_unit_vec3<T>& normal) noexcept
+    {
+        return reflect(direction, normal.vector());
+    }
+
+    /**
+    * \brief Rotate a unit vector. Rotations preserve length, so the result is a unit vector
+    */
+    template <std::floating_point T>
+    constexpr basic_unit_vec3<T> operator*(const basic_unit_vec3<T>& v, const basic_unit_quaternion<T>& q)
+    {
+        return basic_unit_vec3<T>::from_normalized(v.vector() * q);
+    }
+
+    /**
+    * \brief Same as rotate_around, but the axis is already normalized
+    */
+    template <std::floating_point T, std::convertible_to<T> T_>
+    constexpr basic_unit_quaternion<T> rotate_around(const basic_unit_vec3<T>& axis, T_ angle_in_rads)
+    {
+        const auto half_angle = static_cast<T>(angle_in_rads) / 2;
+        const auto [s, c] = details::math_sincos(half_angle);
+
+        return basic_unit_quaternion<T>::from_normalized(basic_quaternion<T>{c, axis[0] * s, axis[1] * s, axis[2] * s});
+    }
+
+    /**
+    * \brief Get the basis vectors around a unit normal without any square roots
+    *
+    * Uses the branchless construction from "Building an Orthonormal Basis, Revisited" (Duff et al. 2017)
+    *
+    * \return +x, +y (the normal), +z axis. All three are unit vectors
+    */
+    template <std::floating_point T>
+    constexpr std::array<basic_vec3<T>, 3> get_basis_vectors(const basic_unit_vec3<T>& normal) noexcept
+    {
+        const auto n = normal.vector();
+        const auto sign = n[2] < T(0) ? T(-1) : T(1);
+        const auto a = T(-1) / (sign + n[2]);
+        const auto b = n[0] * n[1] * a;
+
+        const basic_vec3<T> b1{1 + (sign * n[0] * n[0] * a), sign * b, -sign * n[0]};
+        const basic_vec3<T> b2{b, sign + (n[1] * n[1] * a), -n[1]};
+
+        //b1, b2, n is right-handed, so n x b1 = b2
+        return {b2, n, b1};
+    }
+
+    /**
+    * \brief Get a unit tangent to a unit normal without any square roots
+    */
+    template <std::floating_point T>
+    constexpr basic_unit_vec3<T> get_tangent(const basic_unit_vec3<T>& normal) noexcept
+    {
+        return basic_unit_vec3<T>::from_normalized(get_basis_vectors(normal)[2]);
+    }
+
+    /**
+    * \brief Get a random direction on a cone angle around a unit normal
+    *
+    * The basis is orthonormal, so the result is a unit vector without normalizing it
+    */
+    template <std::floating_point T, std::invocable RNG_t>
+    basic_unit_vec3<T> get_random_direction_on_cone_angle(const basic_unit_vec3<T>& normal, T half_cone_angle, const RNG_t& rng) noexcept
+    {
+        if (half_cone_angle != 0) {
+            half_cone_angle = std::clamp<T>(half_cone_angle, 0, half_pi<T>);
+            const auto [sin_theta, cos_theta] = details::math_sincos(rng() * half_cone_angle);
+            const auto [sin_phi, cos_phi] = details::math_sincos(rng() * pi_v<T>);
+
+            const auto [i, j, k] = get_basis_vectors(normal);
+
+            return basic_unit_vec3<T>::from_normalized((i * (sin_theta * sin_phi)) + (j * cos_theta) + (k * (cos_phi * sin_theta)));
+        }
+        return normal;
+    }
+
+} // namespace Raychel
+
+#endif //!RAYCHELMATH_UNIT_VECTOR_H
@@ -29,11 +29,16 @@
 #define RAYCHEL_COLOR_H
 
 #include "Tuple.h"
+#include "fastmath.h"
+#include "simd.h"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <limits>
 #include <numeric>
 #include <ratio>
+#include <span>
 
 namespace Raychel {
 
@@ -170,6 +175,97 @@ namespace Raychel {
         return details::convert_color_helper<From, To>(c);
     }
 
+    namespace details {
+        template <typename T>
+        concept ColorChannel =
+            std::same_as<T, float> || std::same_as<T, double> || std::same_as<T, std::uint8_t> || std::same_as<T, std::uint16_t>;
+
+        //basic_color has no padding, so a span of colors can be processed as a flat array of 3 * size() channels
+        template <Arithmetic T>
+        const T* channels(std::span<const basic_color<T>> colors) noexcept
+        {
+            static_assert(sizeof(basic_color<T>) == 3 * sizeof(T));
+            return colors.empty() ? nullptr : &colors[0][0];
+        }
+
+        template <Arithmetic T>
+        T* channels(std::span<basic_color<T>> colors) noexcept
+        {
+            static_assert(sizeof(basic_color<T>) == 3 * sizeof(T));
+            return colors.empty() ? nullptr : &colors[0][0];
+        }
+
+        template <ColorChannel From, ColorChannel To>
+        void convert_channels(const From* in, To* out, std::size_t count)
+        {
+            if constexpr (std::is_same_v<From, To>) {
+                std::copy_n(in, count, out);
+            } else if constexpr (std::floating_point<From> && std::floating_point<To>) {
+                for (std::size_t i{0}; i != count; ++i) {
+                    out[i] = static_cast<To>(in[i]);
+                }
+            } else if constexpr (std::floating_point<From>) {
+                simd::quantize(in, out, count);
+            } else if constexpr (std::floating_point<To>) {
+                simd::dequantize(in, out, count);
+            } else {
+                simd::rescale(in, out, count);
+            }
+        }
+    } // namespace details
+
+    /**
+    * \brief Convert every color in src and write the results to dst. dst must hold at least src.size() colors
+    *
+    * Supports float, double, std::uint8_t and std::uint16_t channels. Unlike convert_color, conversions to integer
+    * channels clamp to [0, 1] and round to the nearest value (NaN becomes 0), and integer to integer conversions
+    * rescale exactly without going through floating point. Quantizing float and double and dequantizing to float use
+    * SIMD where available.
+    */
+    template <details::ColorChannel To, details::ColorChannel From>
+    void convert_colors(std::span<const basic_color<From>> src, std::span<basic_color<To>> dst)
+    {
+        RAYCHEL_ASSERT(dst.size() >= src.size());
+        details::convert_channels(details::channels(src), details::channels(dst), src.size() * 3);
+    }
+
+    /**
+    * \brief Quantize every color in src to interleaved 8 bit RGB. dst must hold at least 3 * src.size() bytes
+    */
+    template <details::ColorChannel T>
+    void pack_rgb8(std::span<const basic_color<T>> src, std::span<std::uint8_t> dst)
+    {
+        RAYCHEL_ASSERT(dst.size() >= src.size() * 3);
+        details::convert_channels(details::channels(src), dst.data(), src.size() * 3);
+    }
+
+    /**
+    * \brief Quantize every color in src to interleaved 8 bit RGBA with a constant alpha. dst must hold at least
+    * 4 * src.size() bytes
+    */
+    template <details::ColorChannel T>
+    void pack_rgba8(std::span<const basic_color<T>> src, std::span<std::uint8_t> dst, std::uint8_t alpha = 255)
+    {
+        RAYCHEL_ASSERT(dst.size() >= src.size() * 4);
+
+        //Quantize blocks of colors with the flat kernels, then spread them out to make room for alpha
+        constexpr std::size_t block_size = 64;
+        std::array<std::uint8_t, block_size * 3> rgb{};
+
+        const auto* in = details::channels(src);
+        auto* out = dst.data();
+        for (std::size_t begin{0}; begin < src.size(); begin += block_size) {
+            const auto count = std::min(block_size, src.size() - begin);
+            details::convert_channels(in + (begin * 3), rgb.data(), count * 3);
+            for (std::size_t i{0}; i != count; ++i) {
+                out[((begin + i) * 4) + 0] = rgb[(i * 3) + 0];
+                out[((begin + i) * 4) + 1] = rgb[(i * 3) + 1];
+                out[((begin + i) * 4) + 2] = rgb[(i * 3) + 2];
+                out[((begin + i) * 4) + 3] = alpha;
+            }
+        }
+    }
+
     template <Arithmetic T>
     constexpr basic_color<T> color_from_rgb(std::uint8_t r, std::uint8_t g, std::uint8_t b)
     {
@@ -187,48 +283,155 @@ namespace Raychel {
         return convert_color<T>(basic_color<u8>{r, g, b});
     }
 
+    namespace details {
+        /*
+        * Tanner Helland's fit of the blackbody color curve, before any quantization. Thank you to Tanner Helland at
+        * https://tannerhelland.com/2012/09/18/convert-temperature-rgb-algorithm-code.html
+        *
+        * temperature is in hundreds of Kelvin and every channel is in [0, 255]. The fit has a different formula above and
+        * below 6'600 Kelvin and jumps at the boundary, so both halves are exposed for sampling them separately.
+        */
+        constexpr basic_color<double> temperature_curve_warm(double temperature)
+        {
+            const auto green = std::clamp(99.4708025861 * details::math_log(temperature) - 161.1195681661, 0., 255.);
+            const auto blue =
+                temperature <= 19 ? 0. : std::clamp(138.5177312231 * details::math_log(temperature - 10.) - 305.0447927307, 0., 255.);
+            return basic_color<double>{255., green, blue};
+        }
+
+        constexpr basic_color<double> temperature_curve_cool(double temperature)
+        {
+            const auto red = std::clamp(329.698727446 * details::math_pow(temperature - 60, -.1332047592), 0., 255.);
+            const auto green = std::clamp(288.1221695283 * details::math_pow(temperature - 60., -.0755148492), 0., 255.);
+            return basic_color<double>{red, green, 255.};
+        }
+
+        constexpr basic_color<double> temperature_curve(double temperature)
+        {
+            if (temperature == 66.) {
+                //The original fit already uses the cool formula for blue at exactly 6'600 Kelvin
+                return basic_color<double>{255., temperature_curve_warm(temperature)[1], 255.};
+            }
+            return temperature < 66. ? temperature_curve_warm(temperature) : temperature_curve_cool(temperature);
+        }
+
+        constexpr std::uint32_t min_color_temperature = 1'000;
+        constexpr std::uint32_t max_color_temperature = 40'000;
+    } // namespace details
+
+    /**
+    * \brief Get the color of a black body at the given temperature. This is the exact reference for temperature_lut
+    *
+    * \param _temp Temperature in Kelvin. Clamped to [1'000, 40'000]
+    * \return The color, quantized to 8 bits per channel
+    */
     template <Arithmetic T>
-    basic_color<T> color_from_temperature(std::uint32_t _temp)
+    constexpr basic_color<T> color_from_temperature(std::uint32_t _temp)
     {
-        // Thank you to Tanner Helland at https://tannerhelland.com/2012/09/18/convert-temperature-rgb-algorithm-code.html
         using u8 = std::uint8_t;
 
-        const auto temperature = static_cast<double>(std::clamp<std::uint32_t>(_temp, 1'000, 40'000)) / 100.;
+        const auto temperature =
+            static_cast<double>(std::clamp<std::uint32_t>(_temp, details::min_color_temperature, details::max_color_temperature)) / 100.;
+        const auto rgb = details::temperature_curve(temperature);
 
-        const auto red = [=]() -> u8 {
-            if (temperature <= 66.) {
-                return 255;
-            }
-            auto red = 329.698727446 * std::pow(temperature - 60, -.1332047592);
-            red = std::clamp(red, 0., 255.);
-            return static_cast<u8>(red);
-        }();
-
-        const auto green = [=]() -> u8 {
-            if (temperature <= 66.0) {
-                auto green = 99.4708025861 * std::log(temperature) - 161.1195681661;
-                green = std::clamp(green, 0., 255.);
-                return static_cast<u8>(green);
+        return convert_color<T>(basic_color<u8>{static_cast<u8>(rgb[0]), static_cast<u8>(rgb[1]), static_cast<u8>(rgb[2])});
+    }
+
+    /**
+    * \brief Black body colors sampled at compile time, for color_from_temperature in inner loops
+    *
+    * The table samples the unquantized curve evenly in reciprocal temperature (mired), which matches how quickly the
+    * color changes, with one half of the samples on either side of the jump at 6'600 Kelvin. Lookups take the
+    * temperature as a floating point number, cost one division and interpolate linearly between the samples. With the
+    * default resolution they stay within 0.6/255 of the curve and 1.2/255 of the 8 bit color_from_temperature.
+    *
+    * \tparam T Type of the color
+    * \tparam Resolution Number of samples in the table
+    */
+    template <std::floating_point T, std::size_t Resolution = 256>
+    requires(Resolution >= 4 && Resolution % 2 == 0) class basic_temperature_lut
+    {
+    public:
+        constexpr basic_temperature_lut()
+        {
+            for (std::size_t i{0}; i != half; ++i) {
+                const auto warm_mired = split_mired + (static_cast<double>(i) * warm_step);
+                const auto cool_mired = min_mired + (static_cast<double>(i) * cool_step);
+                entries_[i] = convert_color<T>(details::temperature_curve_warm(1e4 / warm_mired) / 255.);
+                entries_[half + i] = convert_color<T>(details::temperature_curve_cool(1e4 / cool_mired) / 255.);
             }
-            auto green = 288.1221695283 * std::pow(temperature - 60., -.0755148492);
-            green = std::clamp(green, 0., 255.);
-            return static_cast<u8>(green);
-        }();
-
-        const auto blue = [=]() -> u8 {
-            if (temperature >= 66) {
-                return 255;
+        }
+
+        /**
+        * \brief Interpolated color at kelvin. The temperature is clamped to [1'000, 40'000], NaN becomes 1'000
+        */
+        constexpr basic_color<T> operator()(T kelvin) const noexcept
+        {
+            //std::clamp passes NaN through, which would index the table out of bounds. Both comparisons fail for NaN
+            const T max = T(details::max_color_temperature);
+            const T clamped = kelvin > max ? max : (kelvin >= T(details::min_color_temperature) ? kelvin : T(details::min_color_temperature));
+            const T mired = T(1e6) / clamped;
+
+            const bool cool = clamped > T(6'600);
+            const T x = (mired - T(cool ? min_mired : split_mired)) * T(cool ? 1. / cool_step : 1. / warm_step);
+            const auto i = std::min(static_cast<std::size_t>(x), half - 2);
+            const T t = x - static_cast<T>(i);
+
+            const auto& a = entries_[(cool ? half : 0) + i];
+            const auto& b = entries_[(cool ? half : 0) + i + 1];
+            const T blue = a[2] + ((b[2] - a[2]) * t);
+
+            //like temperature_curve, exactly 6'600 Kelvin already uses the cool formula for blue
+            return basic_color<T>{a[0] + ((b[0] - a[0]) * t), a[1] + ((b[1] - a[1]) * t), clamped == T(6'600) ? T(1) : blue};
+        }
+
+        /**
+        * \brief Look up every temperature in in and write the colors to out
+        */
+        constexpr void operator()(std::span<const T> in, std::span<basic_color<T>> out) const noexcept
+        {
+            if (!std::is_constant_evaluated()) {
+                RAYCHEL_ASSERT(out.size() >= in.size());
             }
-            if (temperature <= 19) {
-                return 0;
+            for (std::size_t i{0}; i != in.size(); ++i) {
+                out[i] = (*this)(in[i]);
             }
+        }
+
+        [[nodiscard]] constexpr std::span<const basic_color<T>, Resolution> entries() const noexcept
+        {
+            return entries_;
+        }
+
+    private:
+        static constexpr std::size_t half = Resolution / 2;
 
-            auto blue = 138.5177312231 * std::log(temperature - 10.) - 305.0447927307;
-            blue = std::clamp(blue, 0., 255.);
-            return static_cast<u8>(blue);
-        }();
+        //The samples of each half run from its hottest to its coldest temperature
+        static constexpr double min_mired = 1e6 / details::max_color_temperature;
+        static constexpr double split_mired = 1e6 / 6'600.;
+        static constexpr double max_mired = 1e6 / details::min_color_temperature;
+        static constexpr double cool_step = (split_mired - min_mired) / static_cast<double>(half - 1);
+        static constexpr double warm_step = (max_mired - split_mired) / static_cast<double>(half - 1);
 
-        return convert_color<T>(basic_color<u8>{red, green, blue});
+        std::array<basic_color<T>, Resolution> entries_{};
+    };
+
+    /**
+    * \brief The table is built during compilation and shared between all users of the same type and resolution
+    */
+    template <std::floating_point T, std::size_t Resolution = 256>
+    inline constexpr basic_temperature_lut<T, Resolution> temperature_lut{};
+
+    template <std::floating_point T, std::size_t Resolution = 256>
+    constexpr basic_color<T> color_from_temperature_lut(T kelvin) noexcept
+    {
+        return temperature_lut<T, Resolution>(kelvin);
+    }
+
+    template <std::floating_point T, std::size_t Resolution = 256>
+    constexpr void color_from_temperature_lut(std::span<const T> kelvin, std::span<basic_color<T>> out) noexcept
+    {
+        temperature_lut<T, Resolution>(kelvin, out);
     }
 
 } // namespace Raychel
@@ -0,0 +1,397 @@
+/**
+* \file constexpr_math.h
+* \author Weckyy702 (weckyy702@gmail.com)
+* \brief Square root and transcendental functions usable in constant expressions
+* \date 2026-10-16
+*
+* MIT License
+* Copyright (c) [2026] [Weckyy702 (weckyy702@gmail.com | https://github.com/Weckyy702)]
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+#ifndef RAYCHELMATH_CONSTEXPR_MATH_H
+#define RAYCHELMATH_CONSTEXPR_MATH_H
+
+#include <concepts>
+#include <limits>
+
+/**
+* The constexpr_* functions evaluate in constant expressions, where std::sqrt, std::sin etc. are not available before
+* C++26. They compute in long double and iterate until the result stops changing. float and double results are within
+* one ULP of the std functions, long double results lose a few bits (constexpr_pow up to 64 ULP). They are much slower
+* than the std functions and meant for baking scene constants and tables at compile time; the math_* helpers in
+* fastmath.h only call them during constant evaluation.
+*
+* constexpr_sin/cos reduce the argument with a 4-part Cody-Waite split of pi/2 and are accurate for |x| < 2^20.
+* Special values (NaN, inf, 0, negative inputs to sqrt and log) behave like the std functions.
+*/
+
+namespace Raychel {
+
+    template <typename T>
+    struct SinCos
+    {
+        T sin;
+        T cos;
+    };
+
+    namespace details::constexpr_math {
+
+        using wide = long double;
+
+        template <std::floating_point T>
+        constexpr bool is_nan(T x) noexcept
+        {
+            return x != x; //NOLINT(misc-redundant-expression): NaN is the only value not equal to itself
+        }
+
+        template <std::floating_point T>
+        constexpr bool is_inf(T x) noexcept
+        {
+            return x == std::numeric_limits<T>::infinity() || x == -std::numeric_limits<T>::infinity();
+        }
+
+        template <std::floating_point T>
+        constexpr T abs_value(T x) noexcept
+        {
+            return x < T(0) ? -x : x;
+        }
+
+        //Narrowing a value above the largest finite T is not a constant expression, so saturate to inf first
+        template <std::floating_point T>
+        constexpr T narrow(wide x) noexcept
+        {
+            if (abs_value(x) > static_cast<wide>(std::numeric_limits<T>::max())) {
+                return x < 0 ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::infinity();
+            }
+            return static_cast<T>(x);
+        }
+
+        //2^e without ever overflowing an intermediate result
+        constexpr wide pow2(int e) noexcept
+        {
+            wide base = e < 0 ? wide(0.5) : wide(2);
+            auto n = static_cast<unsigned>(e < 0 ? -e : e);
+            wide res{1};
+            while (n != 0) {
+                if ((n & 1U) != 0) {
+                    res *= base;
+                }
+                n >>= 1U;
+                if (n != 0) {
+                    base *= base;
+                }
+            }
+            return res;
+        }
+
+        //Round to the nearest integer, halfway cases away from zero
+        constexpr long long round_to_int(wide x) noexcept
+        {
+            return static_cast<long long>(x < 0 ? x - wide(0.5) : x + wide(0.5));
+        }
+
+        //Split x = m * 2^e with m in [sqrt(0.5), sqrt(2))
+        constexpr wide split_exponent(wide x, int& e) noexcept
+        {
+            constexpr wide big = 0x1p64L;
+            constexpr wide small = 0x1p-64L;
+            constexpr wide sqrt2 = 1.41421356237309504880168872420969808L;
+
+            e = 0;
+            while (x >= big) {
+                x *= small;
+                e += 64;
+            }
+            while (x < small) {
+                x *= big;
+                e -= 64;
+            }
+            while (x >= sqrt2) {
+                x /= 2;
+                ++e;
+            }
+            while (x < sqrt2 / 2) {
+                x *= 2;
+                --e;
+            }
+            return x;
+        }
+
+        //Reduce x to r in [-pi/4, pi/4] and the quadrant n with x = n * pi/2 + r. The pi/2 parts have at most 33
+        //significant bits, so n * part is exact for |n| < 2^20
+        constexpr wide reduce_half_pi(wide x, long long& n) noexcept
+        {
+            constexpr wide two_over_pi = 0.636619772367581343075535053490057448L;
+            constexpr wide pio2_1 = 1.57079632673412561417e+00L;
+            constexpr wide pio2_2 = 6.07710050630396597660e-11L;
+            constexpr wide pio2_3 = 2.02226624871116645580e-21L;
+            constexpr wide pio2_3t = 8.47842766036889956997e-32L;
+
+            n = round_to_int(x * two_over_pi);
+            const auto k = static_cast<wide>(n);
+            return (((x - (k * pio2_1)) - (k * pio2_2)) - (k * pio2_3)) - (k * pio2_3t);
+        }
+
+        //Taylor series on the reduced argument, summed until the terms no longer change the result
+        constexpr wide sin_series(wide r) noexcept
+        {
+            const wide r2 = r * r;
+            wide term = r;
+            wide sum = r;
+            for (int i{1}; i != 30; ++i) {
+                term *= -r2 / static_cast<wide>((2 * i) * ((2 * i) + 1));
+                const wide next = sum + term;
+                if (next == sum) {
+                    break;
+                }
+                sum = next;
+            }
+            return sum;
+        }
+
+        constexpr wide cos_series(wide r) noexcept
+        {
+            const wide r2 = r * r;
+            wide term = 1;
+            wide sum = 1;
+            for (int i{1}; i != 30; ++i) {
+                term *= -r2 / static_cast<wide>(((2 * i) - 1) * (2 * i));
+                const wide next = sum + term;
+                if (next == sum) {
+                    break;
+                }
+                sum = next;
+            }
+            return sum;
+        }
+
+        constexpr wide exp_wide(wide x) noexcept
+        {
+            constexpr wide ln2 = 0.693147180559945309417232121458176568L;
+            constexpr wide ln2_hi = 6.93147180369123816490e-01L;
+            constexpr wide ln2_lo = 1.90821492927058770002e-10L;
+
+            //x = k * ln2 + r with |r| <= ln2/2
+            const auto k = round_to_int(x / ln2);
+            const wide r = (x - (static_cast<wide>(k) * ln2_hi)) - (static_cast<wide>(k) * ln2_lo);
+
+            wide term = 1;
+            wide sum = 1;
+            for (int i{1}; i != 40; ++i) {
+                term *= r / static_cast<wide>(i);
+                const wide next = sum + term;
+                if (next == sum) {
+                    break;
+                }
+                sum = next;
+            }
+
+            //Scale in two steps so neither factor overflows when the result is close to the limits
+            const auto e = static_cast<int>(k);
+            return (sum * pow2(e / 2)) * pow2(e - (e / 2));
+        }
+
+        constexpr wide log_wide(wide x) noexcept
+        {
+            constexpr wide ln2_hi = 6.93147180369123816490e-01L;
+            constexpr wide ln2_lo = 1.90821492927058770002e-10L;
+
+            int e{};
+            const wide m = split_exponent(x, e);
+
+            //log(m) = 2 * atanh(s) with s = (m - 1) / (m + 1), |s| <= 0.172
+            const wide s = (m - 1) / (m + 1);
+            const wide s2 = s * s;
+            wide power = s;
+            wide sum = s;
+            for (int i{1}; i != 40; ++i) {
+                power *= s2;
+                const wide next = sum + (power / static_cast<wide>((2 * i) + 1));
+                if (next == sum) {
+                    break;
+                }
+                sum = next;
+            }
+
+            const auto k = static_cast<wide>(e);
+            return ((k * ln2_hi) + (2 * sum)) + (k * ln2_lo);
+        }
+
+    } // namespace details::constexpr_math
+
+    /**
+    * \brief Square root by Newton iteration
+    */
+    template <std::floating_point T>
+    constexpr T constexpr_sqrt(T x) noexcept
+    {
+        using namespace details::constexpr_math;
+
+        if (is_nan(x) || x < T(0)) {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+        if (x == T(0) || is_inf(x)) {
+            return x;
+        }
+
+        //Scale by even powers of two into [2^-64, 2^64) so the iteration count stays small
+        wide a = x;
+        wide scale = 1;
+        while (a >= 0x1p64L) {
+            a *= 0x1p-64L;
+            scale *= 0x1p32L;
+        }
+        while (a < 0x1p-64L) {
+            a *= 0x1p64L;
+            scale *= 0x1p-32L;
+        }
+
+        //(a + 1) / 2 >= sqrt(a), from there Newton's method decreases monotonically
+        wide g = (a + 1) / 2;
+        while (true) {
+            const wide next = (g + (a / g)) / 2;
+            if (next >= g) {
+                break;
+            }
+            g = next;
+        }
+        return static_cast<T>(g * scale);
+    }
+
+    template <std::floating_point T>
+    constexpr SinCos<T> constexpr_sincos(T x) noexcept
+    {
+        using namespace details::constexpr_math;
+
+        if (is_nan(x) || is_inf(x)) {
+            return SinCos<T>{std::numeric_limits<T>::quiet_NaN(), std::numeric_limits<T>::quiet_NaN()};
+        }
+
+        long long n{};
+        const wide r = reduce_half_pi(x, n);
+        const wide s = sin_series(r);
+        const wide c = cos_series(r);
+
+        switch (n & 3) {
+            case 0:
+                return SinCos<T>{static_cast<T>(s), static_cast<T>(c)};
+            case 1:
+                return SinCos<T>{static_cast<T>(c), static_cast<T>(-s)};
+            case 2:
+                return SinCos<T>{static_cast<T>(-s), static_cast<T>(-c)};
+            default:
+                return SinCos<T>{static_cast<T>(-c), static_cast<T>(s)};
+        }
+    }
+
+    template <std::floating_point T>
+    constexpr T constexpr_sin(T x) noexcept
+    {
+        return constexpr_sincos(x).sin;
+    }
+
+    template <std::floating_point T>
+    constexpr T constexpr_cos(T x) noexcept
+    {
+        return constexpr_sincos(x).cos;
+    }
+
+    template <std::floating_point T>
+    constexpr T constexpr_exp(T x) noexcept
+    {
+        using namespace details::constexpr_math;
+
+        if (is_nan(x)) {
+            return x;
+        }
+        //Outside of these bounds the result is not representable in T
+        if (x > T(std::numeric_limits<T>::max_exponent) * T(0.6931471805599453)) {
+            return std::numeric_limits<T>::infinity();
+        }
+        if (x < T(std::numeric_limits<T>::min_exponent - std::numeric_limits<T>::digits - 1) * T(0.6931471805599453)) {
+            return T(0);
+        }
+        return narrow<T>(exp_wide(x));
+    }
+
+    template <std::floating_point T>
+    constexpr T constexpr_log(T x) noexcept
+    {
+        using namespace details::constexpr_math;
+
+        if (is_nan(x) || x < T(0)) {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+        if (x == T(0)) {
+            return -std::numeric_limits<T>::infinity();
+        }
+        if (is_inf(x)) {
+            return x;
+        }
+        return static_cast<T>(log_wide(x));
+    }
+
+    /**
+    * \brief x^y computed as exp(y * log(x)) in long double. Negative x is only valid for integral y
+    */
+    template <std::floating_point T>
+    constexpr T constexpr_pow(T x, T y) noexcept
+    {
+        using namespace details::constexpr_math;
+
+        if (y == T(0)) {
+            return T(1);
+        }
+        if (is_nan(x) || is_nan(y)) {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+        if (x == T(0)) {
+            return y > T(0) ? T(0) : std::numeric_limits<T>::infinity();
+        }
+
+        bool negate = false;
+        if (x < T(0)) {
+            //|y| >= 2^63 is always an even integer
+            const bool is_integral = abs_value(y) >= T(0x1p63) || static_cast<wide>(static_cast<long long>(y)) == static_cast<wide>(y);
+            if (!is_integral) {
+                return std::numeric_limits<T>::quiet_NaN();
+            }
+            negate = abs_value(y) < T(0x1p63) && (static_cast<long long>(y) & 1) != 0;
+            x = -x;
+        }
+        if (is_inf(x)) {
+            return (y > T(0) ? std::numeric_limits<T>::infinity() : T(0)) * (negate ? T(-1) : T(1));
+        }
+
+        const wide product = static_cast<wide>(y) * log_wide(x);
+        T res{};
+        if (product > wide(std::numeric_limits<T>::max_exponent) * wide(0.6931471805599453)) {
+            res = std::numeric_limits<T>::infinity();
+        } else if (product < wide(std::numeric_limits<T>::min_exponent - std::numeric_limits<T>::digits - 1) * wide(0.6931471805599453)) {
+            res = T(0);
+        } else {
+            res = narrow<T>(exp_wide(product));
+        }
+        return negate ? -res : res;
+    }
+
+} // namespace Raychel
+
+#endif //!RAYCHELMATH_CONSTEXPR_MATH_H
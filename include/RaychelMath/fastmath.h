@@ -0,0 +1,529 @@
+/**
+* \file fastmath.h
+* \author Weckyy702 (weckyy702@gmail.com)
+* \brief Fast polynomial approximations of common transcendental functions
+* \date 2026-10-16
+*
+* MIT License
+* Copyright (c) [2026] [Weckyy702 (weckyy702@gmail.com | https://github.com/Weckyy702)]
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+#ifndef RAYCHELMATH_FASTMATH_H
+#define RAYCHELMATH_FASTMATH_H
+
+#include "Packet.h"
+#include "constexpr_math.h"
+
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+/**
+* Accuracy tiers of the fast_* functions. The bounds are the maximum errors measured against long double std functions.
+*
+*   function      | domain          | low (float, double)  | high (float)       | high (double)
+*   --------------+-----------------+----------------------+--------------------+-------------------
+*   fast_rsqrt    | x > 0, finite   | 5e-6 rel             | 3 ULP              | 3 ULP
+*   fast_sqrt     | x >= 0, finite  | 5e-6 rel             | std::sqrt (exact)  | std::sqrt (exact)
+*   fast_sin/cos  | |x| < 2^15      | 4e-5 abs             | 5e-7 abs           | 3e-9 abs
+*   fast_exp      | all x           | 6e-5 rel             | 2 ULP              | 1.2e-9 rel
+*   fast_log      | x > 0           | 4e-6 rel             | 3 ULP              | 2.1e-9 rel
+*   fast_pow      | x > 0           | 6e-5 rel             | 1.3e-6 rel         | 3.2e-9 rel
+*
+* The low tier targets shading code that tolerates about 1e-4 relative error, the high tier is close to full float
+* precision. Neither tier is full double precision. long double always uses the std functions.
+* The fast_pow bounds hold for |y * log(x)| <= 14, its error grows with that product.
+*
+* sin/cos errors are absolute because the result passes through 0. Outside |x| < 2^15 the range reduction loses
+* accuracy. fast_exp returns +inf and 0 outside the representable range like std::exp. fast_log returns -inf for 0,
+* NaN for negative inputs and handles subnormal inputs.
+*/
+
+namespace Raychel {
+
+    enum class FastMathPrecision {
+        low,
+        high,
+    };
+
+    namespace details::fastmath {
+
+        template <typename T>
+        struct FloatTraits;
+
+        template <>
+        struct FloatTraits<float>
+        {
+            using uint = std::uint32_t;
+            using sint = std::int32_t;
+            static constexpr int mantissa_bits = 23;
+            static constexpr sint exponent_bias = 127;
+            static constexpr uint rsqrt_magic = 0x5F37'5A86U;
+            //exp of these overflows to inf or rounds to 0, so clamping the input keeps exp's special cases intact
+            static constexpr float exp_max = 89.F;
+            static constexpr float exp_min = -104.F;
+        };
+
+        template <>
+        struct FloatTraits<double>
+        {
+            using uint = std::uint64_t;
+            using sint = std::int64_t;
+            static constexpr int mantissa_bits = 52;
+            static constexpr sint exponent_bias = 1023;
+            static constexpr uint rsqrt_magic = 0x5FE6'EB50'C7B5'37A9ULL;
+            static constexpr double exp_max = 710.;
+            static constexpr double exp_min = -746.;
+        };
+
+        //long double has no portable bit layout, it always uses the std functions
+        template <typename T>
+        concept Supported = std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+        /*
+        * The kernels below avoid branches, float <-> integer conversions and ternaries on float comparisons
+        * (which compilers do not if-convert under the default -ftrapping-math), so loops over them are vectorized.
+        */
+
+        template <Supported T>
+        using uint_t = typename FloatTraits<T>::uint;
+
+        //1.5 * 2^mantissa_bits. Adding it to |x| < 2^(mantissa_bits - 1) rounds x to an integer stored in the low mantissa bits
+        template <Supported T>
+        constexpr T shifter = static_cast<T>(uint_t<T>{3} << (FloatTraits<T>::mantissa_bits - 1));
+
+        //all ones if condition is set
+        template <Supported T>
+        inline uint_t<T> mask(bool condition) noexcept
+        {
+            return uint_t<T>{0} - static_cast<uint_t<T>>(condition);
+        }
+
+        template <Supported T>
+        inline T select(uint_t<T> mask, T if_true, T if_false) noexcept
+        {
+            return std::bit_cast<T>((std::bit_cast<uint_t<T>>(if_true) & mask) | (std::bit_cast<uint_t<T>>(if_false) & ~mask));
+        }
+
+        //Integer n (as stored in the low bits of n + shifter) to a float, without a conversion instruction
+        template <Supported T>
+        inline T to_float(uint_t<T> n) noexcept
+        {
+            return std::bit_cast<T>(std::bit_cast<uint_t<T>>(shifter<T>) + n) - shifter<T>;
+        }
+
+        //2^n for exponents of normal numbers
+        template <Supported T>
+        inline T exp2_int(uint_t<T> n) noexcept
+        {
+            using Traits = FloatTraits<T>;
+            return std::bit_cast<T>((n + static_cast<uint_t<T>>(Traits::exponent_bias)) << Traits::mantissa_bits);
+        }
+
+        template <FastMathPrecision P, Supported T>
+        inline T rsqrt(T x) noexcept
+        {
+            using Traits = FloatTraits<T>;
+            constexpr int iterations = (P == FastMathPrecision::low) ? 2 : (std::is_same_v<T, float> ? 3 : 4);
+
+            const T half_x = x * T(0.5);
+            T y = std::bit_cast<T>(Traits::rsqrt_magic - (std::bit_cast<uint_t<T>>(x) >> 1U));
+            for (int i = 0; i != iterations; ++i) {
+                y = y * (T(1.5) - (half_x * y * y));
+            }
+            return y;
+        }
+
+        template <FastMathPrecision P, Supported T>
+        inline SinCos<T> sincos(T x) noexcept
+        {
+            constexpr auto sign_shift = sizeof(T) * 8 - 2;
+
+            //Cody-Waite reduction to r in [-pi/4, pi/4]. The first constant has few enough bits that k * pio2_1 is exact
+            constexpr T two_over_pi = T(0.636619772367581343075535053490057448);
+            constexpr T pio2_1 = T(1.5703125);
+            constexpr T pio2_2 = T(4.837512969970703125e-4);
+            constexpr T pio2_3 = T(7.54978995489188216e-8);
+
+            const T shifted = (x * two_over_pi) + shifter<T>;
+            const T k = shifted - shifter<T>;
+            const auto quadrant = std::bit_cast<uint_t<T>>(shifted);
+
+            const T r = ((x - (k * pio2_1)) - (k * pio2_2)) - (k * pio2_3);
+            const T r2 = r * r;
+
+            T s{};
+            T c{};
+            // clang-format off
+            if constexpr (P == FastMathPrecision::low) {
+                //Taylor polynomials
+                s = r + (r * r2 * (T(-1.0 / 6.0) + (r2 * T(1.0 / 120.0))));
+                c = T(1) - (T(0.5) * r2) + (r2 * r2 * (T(1.0 / 24.0) + (r2 * T(-1.0 / 720.0))));
+            } else {
+                //minimax polynomials from Cephes sinf/cosf
+                s = r + (r * r2 * (T(-1.6666654611e-1) + (r2 * (T(8.3321608736e-3) + (r2 * T(-1.9515295891e-4))))));
+                c = T(1) - (T(0.5) * r2) + (r2 * r2 * (T(4.166664568298827e-2) + (r2 * (T(-1.388731625493765e-3) + (r2 * T(2.443315711809948e-5))))));
+            }
+            // clang-format on
+
+            //quadrant 0: (s, c), 1: (c, -s), 2: (-s, -c), 3: (-c, s)
+            const auto swap = mask<T>((quadrant & 1U) != 0);
+            const auto sin_sign = (quadrant & 2U) << sign_shift;
+            const auto cos_sign = ((quadrant + 1U) & 2U) << sign_shift;
+            return SinCos<T>{
+                std::bit_cast<T>(std::bit_cast<uint_t<T>>(select(swap, c, s)) ^ sin_sign),
+                std::bit_cast<T>(std::bit_cast<uint_t<T>>(select(swap, s, c)) ^ cos_sign),
+            };
+        }
+
+        template <FastMathPrecision P, Supported T>
+        inline T exp(T x) noexcept
+        {
+            using Traits = FloatTraits<T>;
+
+            constexpr T log2e = T(1.44269504088896340735992468100189214);
+            constexpr T ln2_hi = T(0.693359375);
+            constexpr T ln2_lo = T(-2.12194440e-4);
+
+            const T shifted = (x * log2e) + shifter<T>;
+            const T n = shifted - shifter<T>;
+            const T r = (x - (n * ln2_hi)) - (n * ln2_lo);
+
+            T p{};
+            // clang-format off
+            if constexpr (P == FastMathPrecision::low) {
+                p = T(1) + r + (r * r * (T(0.5) + (r * (T(1.0 / 6.0) + (r * T(1.0 / 24.0))))));
+            } else {
+                //minimax polynomial from Cephes expf
+                p = T(1) + r + (r * r * (T(5.0000001201e-1) + (r * (T(1.6666665459e-1) + (r * (T(4.1665795894e-2) +
+                    (r * (T(8.3334519073e-3) + (r * (T(1.3981999507e-3) + (r * T(1.9875691500e-4))))))))))));
+            }
+            // clang-format on
+
+            //split the scale in two so results in the subnormal range and beyond the maximum are rounded correctly
+            const auto e = std::bit_cast<uint_t<T>>(shifted) - std::bit_cast<uint_t<T>>(shifter<T>);
+            const auto e_half = static_cast<uint_t<T>>(static_cast<std::make_signed_t<uint_t<T>>>(e) >> 1);
+            const T res = (p * exp2_int<T>(e_half)) * exp2_int<T>(e - e_half);
+
+            const T special = select(mask<T>(x < T(0)), T(0), std::numeric_limits<T>::infinity());
+            return select(mask<T>(x > Traits::exp_max) | mask<T>(x < Traits::exp_min), special, res);
+        }
+
+        template <FastMathPrecision P, Supported T>
+        inline T log(T x) noexcept
+        {
+            using Traits = FloatTraits<T>;
+            using uint = uint_t<T>;
+
+            constexpr T ln2_hi = T(0.693359375);
+            constexpr T ln2_lo = T(-2.12194440e-4);
+            constexpr T sqrt2 = T(1.41421356237309504880168872420969808);
+            constexpr uint mantissa_mask = (uint{1} << Traits::mantissa_bits) - 1;
+            constexpr uint exponent_mask = (uint{1} << (sizeof(T) * 8 - Traits::mantissa_bits - 1)) - 1;
+            constexpr uint one_bits = std::bit_cast<uint>(T(1));
+            constexpr auto inf = std::numeric_limits<T>::infinity();
+
+            //bring subnormals into the normal range first
+            const auto subnormal = mask<T>(x < std::numeric_limits<T>::min());
+            const T y = select(subnormal, x * static_cast<T>(uint{1} << Traits::mantissa_bits), x);
+            const uint bits = std::bit_cast<uint>(y);
+
+            //biased exponent, the bias is removed when converting to float
+            uint e = ((bits >> Traits::mantissa_bits) & exponent_mask) - (static_cast<uint>(Traits::mantissa_bits) & subnormal);
+            T m = std::bit_cast<T>((bits & mantissa_mask) | one_bits);
+
+            //m in [sqrt(2)/2, sqrt(2)) keeps s small
+            const auto large = mask<T>(m > sqrt2);
+            m = select(large, m * T(0.5), m);
+            e += uint{1} & large;
+
+            //log(m) = 2 * atanh(s)
+            const T s = (m - T(1)) / (m + T(1));
+            const T s2 = s * s;
+            T p{};
+            // clang-format off
+            if constexpr (P == FastMathPrecision::low) {
+                p = T(2) * s * (T(1) + (s2 * (T(1.0 / 3.0) + (s2 * T(1.0 / 5.0)))));
+            } else {
+                p = T(2) * s * (T(1) + (s2 * (T(1.0 / 3.0) + (s2 * (T(1.0 / 5.0) + (s2 * (T(1.0 / 7.0) + (s2 * T(1.0 / 9.0)))))))));
+            }
+            // clang-format on
+
+            const T fe = to_float<T>(e) - static_cast<T>(Traits::exponent_bias);
+            const T res = (fe * ln2_hi) + (p + (fe * ln2_lo));
+
+            const T special = select(mask<T>(x == T(0)), -inf, select(mask<T>(x == inf), inf, std::numeric_limits<T>::quiet_NaN()));
+            return select(mask<T>(x > T(0)) & mask<T>(x < inf), res, special);
+        }
+
+    } // namespace details::fastmath
+
+    /**
+    * \brief Approximate 1 / sqrt(x)
+    */
+    template <FastMathPrecision P = FastMathPrecision::high, std::floating_point T>
+    inline T fast_rsqrt(T x) noexcept
+    {
+        if constexpr (details::fastmath::Supported<T>) {
+            return details::fastmath::rsqrt<P>(x);
+        } else {
+            return T(1) / std::sqrt(x);
+        }
+    }
+
+    /**
+    * \brief Approximate sqrt(x). The high tier is std::sqrt, which is a single correctly rounded instruction
+    */
+    template <FastMathPrecision P = FastMathPrecision::high, std::floating_point T>
+    inline T fast_sqrt(T x) noexcept
+    {
+        if constexpr (details::fastmath::Supported<T> && P == FastMathPrecision::low) {
+            return x * details::fastmath::rsqrt<P>(x);
+        } else {
+            return std::sqrt(x);
+        }
+    }
+
+    /**
+    * \brief Approximate sin(x) and cos(x) with a single range reduction
+    */
+    template <FastMathPrecision P = FastMathPrecision::high, std::floating_point T>
+    inline SinCos<T> fast_sincos(T x) noexcept
+    {
+        if constexpr (details::fastmath::Supported<T>) {
+            return details::fastmath::sincos<P>(x);
+        } else {
+            return SinCos<T>{std::sin(x), std::cos(x)};
+        }
+    }
+
+    template <FastMathPrecision P = FastMathPrecision::high, std::floating_point T>
+    inline T fast_sin(T x) noexcept
+    {
+        return fast_sincos<P>(x).sin;
+    }
+
+    template <FastMathPrecision P = FastMathPrecision::high, std::floating_point T>
+    inline T fast_cos(T x) noexcept
+    {
+        return fast_sincos<P>(x).cos;
+    }
+
+    template <FastMathPrecision P = FastMathPrecision::high, std::floating_point T>
+    inline T fast_exp(T x) noexcept
+    {
+        if constexpr (details::fastmath::Supported<T>) {
+            return details::fastmath::exp<P>(x);
+        } else {
+            return std::exp(x);
+        }
+    }
+
+    template <FastMathPrecision P = FastMathPrecision::high, std::floating_point T>
+    inline T fast_log(T x) noexcept
+    {
+        if constexpr (details::fastmath::Supported<T>) {
+            return details::fastmath::log<P>(x);
+        } else {
+            return std::log(x);
+        }
+    }
+
+    /**
+    * \brief Approximate x^y for x >= 0 as exp(y * log(x)). Negative bases return NaN
+    */
+    template <FastMathPrecision P = FastMathPrecision::high, std::floating_point T>
+    inline T fast_pow(T x, T y) noexcept
+    {
+        if constexpr (details::fastmath::Supported<T>) {
+            const T res = details::fastmath::exp<P>(y * details::fastmath::log<P>(x));
+            return details::fastmath::select(details::fastmath::mask<T>(y == T(0)), T(1), res);
+        } else {
+            return std::pow(x, y);
+        }
+    }
+
+    //Packet versions. The scalar kernels are branch-free, so these loops are vectorized by the compiler
+
+#define RAYCHELMATH_FASTMATH_PACKET_FUNCTION(name)                                                                               \
+    template <FastMathPrecision P = FastMathPrecision::high, std::floating_point T, std::size_t W>                              \
+    inline basic_packet<T, W> name(const basic_packet<T, W>& x) noexcept                                                       \
+    {                                                                                                                            \
+        basic_packet<T, W> res;                                                                                                  \
+        for (std::size_t i{0}; i != W; ++i) {                                                                                    \
+            res.lanes[i] = name<P>(x.lanes[i]);                                                                                  \
+        }                                                                                                                        \
+        return res;                                                                                                              \
+    }
+
+    RAYCHELMATH_FASTMATH_PACKET_FUNCTION(fast_rsqrt)
+    RAYCHELMATH_FASTMATH_PACKET_FUNCTION(fast_sqrt)
+    RAYCHELMATH_FASTMATH_PACKET_FUNCTION(fast_sin)
+    RAYCHELMATH_FASTMATH_PACKET_FUNCTION(fast_cos)
+    RAYCHELMATH_FASTMATH_PACKET_FUNCTION(fast_exp)
+    RAYCHELMATH_FASTMATH_PACKET_FUNCTION(fast_log)
+
+#undef RAYCHELMATH_FASTMATH_PACKET_FUNCTION
+
+    template <FastMathPrecision P = FastMathPrecision::high, std::floating_point T, std::size_t W>
+    inline SinCos<basic_packet<T, W>> fast_sincos(const basic_packet<T, W>& x) noexcept
+    {
+        SinCos<basic_packet<T, W>> res;
+        for (std::size_t i{0}; i != W; ++i) {
+            const auto [s, c] = fast_sincos<P>(x.lanes[i]);
+            res.sin.lanes[i] = s;
+            res.cos.lanes[i] = c;
+        }
+        return res;
+    }
+
+    template <FastMathPrecision P = FastMathPrecision::high, std::floating_point T, std::size_t W>
+    inline basic_packet<T, W> fast_pow(const basic_packet<T, W>& x, const basic_packet<T, W>& y) noexcept
+    {
+        basic_packet<T, W> res;
+        for (std::size_t i{0}; i != W; ++i) {
+            res.lanes[i] = fast_pow<P>(x.lanes[i], y.lanes[i]);
+        }
+        return res;
+    }
+
+    namespace details {
+
+        /*
+        * Opt-in policy for the math used inside the vector, quaternion and color headers.
+        * Define RAYCHELMATH_FASTMATH_LOW or RAYCHELMATH_FASTMATH_HIGH (or set the RAYCHELMATH_FASTMATH CMake option)
+        * to route their transcendental functions through the fast_* approximations of that tier.
+        * During constant evaluation the math_* helpers always use the constexpr_* functions.
+        */
+#if defined(RAYCHELMATH_FASTMATH_LOW)
+        constexpr bool fastmath_policy_enabled = true;
+        constexpr auto fastmath_policy_precision = FastMathPrecision::low;
+#elif defined(RAYCHELMATH_FASTMATH_HIGH)
+        constexpr bool fastmath_policy_enabled = true;
+        constexpr auto fastmath_policy_precision = FastMathPrecision::high;
+#else
+        constexpr bool fastmath_policy_enabled = false;
+        constexpr auto fastmath_policy_precision = FastMathPrecision::high;
+#endif
+
+        template <typename T>
+        constexpr bool use_fastmath = fastmath_policy_enabled && fastmath::Supported<T>;
+
+        //Worst relative error (absolute for sin/cos) a single math_* call adds under the active policy, 0 if it uses the std functions
+        template <std::floating_point T>
+        constexpr T fastmath_policy_tolerance = [] {
+            if constexpr (!use_fastmath<T>) {
+                return T{0};
+            } else if constexpr (fastmath_policy_precision == FastMathPrecision::low) {
+                return T(6e-5);
+            } else if constexpr (std::is_same_v<T, float>) {
+                return T(1.3e-6);
+            } else {
+                return T(3.2e-9);
+            }
+        }();
+
+        template <Arithmetic T>
+        constexpr auto math_sqrt(T x) noexcept
+        {
+            if (std::is_constant_evaluated()) {
+                return constexpr_sqrt(static_cast<decltype(std::sqrt(x))>(x));
+            }
+            if constexpr (use_fastmath<T>) {
+                return fast_sqrt<fastmath_policy_precision>(x);
+            } else {
+                return std::sqrt(x);
+            }
+        }
+
+        template <Arithmetic T>
+        constexpr auto math_sin(T x) noexcept
+        {
+            if (std::is_constant_evaluated()) {
+                return constexpr_sin(static_cast<decltype(std::sin(x))>(x));
+            }
+            if constexpr (use_fastmath<T>) {
+                return fast_sin<fastmath_policy_precision>(x);
+            } else {
+                return std::sin(x);
+            }
+        }
+
+        template <Arithmetic T>
+        constexpr auto math_cos(T x) noexcept
+        {
+            if (std::is_constant_evaluated()) {
+                return constexpr_cos(static_cast<decltype(std::cos(x))>(x));
+            }
+            if constexpr (use_fastmath<T>) {
+                return fast_cos<fastmath_policy_precision>(x);
+            } else {
+                return std::cos(x);
+            }
+        }
+
+        template <Arithmetic T>
+        constexpr auto math_sincos(T x) noexcept
+        {
+            if (std::is_constant_evaluated()) {
+                return constexpr_sincos(static_cast<decltype(std::sin(x))>(x));
+            }
+            if constexpr (use_fastmath<T>) {
+                return fast_sincos<fastmath_policy_precision>(x);
+            } else {
+                return SinCos<decltype(std::sin(x))>{std::sin(x), std::cos(x)};
+            }
+        }
+
+        template <Arithmetic T>
+        constexpr auto math_log(T x) noexcept
+        {
+            if (std::is_constant_evaluated()) {
+                return constexpr_log(static_cast<decltype(std::log(x))>(x));
+            }
+            if constexpr (use_fastmath<T>) {
+                return fast_log<fastmath_policy_precision>(x);
+            } else {
+                return std::log(x);
+            }
+        }
+
+        template <Arithmetic T>
+        constexpr auto math_pow(T x, T y) noexcept
+        {
+            if (std::is_constant_evaluated()) {
+                using R = decltype(std::pow(x, y));
+                return constexpr_pow(static_cast<R>(x), static_cast<R>(y));
+            }
+            if constexpr (use_fastmath<T>) {
+                return fast_pow<fastmath_policy_precision>(x, y);
+            } else {
+                return std::pow(x, y);
+            }
+        }
+
+    } // namespace details
+
+} // namespace Raychel
+
+#endif //!RAYCHELMATH_FASTMATH_H
@@ -0,0 +1,319 @@
+/**
+* \file hdr_encoding.h
+* \author Weckyy702 (weckyy702@gmail.com)
+* \brief 32 bit encodings of HDR colors: RGBE, RGB9E5 and R11G11B10F
+* \date 2026-10-16
+*
+* MIT License
+* Copyright (c) [2026] [Weckyy702 (weckyy702@gmail.com | https://github.com/Weckyy702)]
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+#ifndef RAYCHELMATH_HDR_ENCODING_H
+#define RAYCHELMATH_HDR_ENCODING_H
+
+#include "color.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <span>
+
+/**
+* Every encoding stores a basic_color<float> in 32 bits instead of 12 bytes. Negative channels and NaN are encoded as
+* 0, values above the largest representable one are clamped to it. Encoding rounds to the nearest representable value
+* except for RGBE, which truncates like the Radiance reference implementation and adds half a step when decoding.
+*
+* - RGBE: 8 bit mantissas with a shared exponent (Radiance .hdr). Bytes r, g, b, e from the least significant one.
+*   Channels are within 2^-8 * max(r, g, b) of the input, values below 2^-106 (about 1.2e-32) become black.
+* - RGB9E5: 9 bit mantissas with a shared 5 bit exponent (GL_EXT_texture_shared_exponent, DXGI_FORMAT_R9G9B9E5).
+*   Red in bits 0-8, green in 9-17, blue in 18-26 and the exponent in 27-31. Channels are within
+*   2^-9 * max(r, g, b) of the input, the largest value is 65408.
+* - R11G11B10F: separate unsigned floats with 5 exponent bits and 6 (red, green) or 5 (blue) mantissa bits
+*   (DXGI_FORMAT_R11G11B10_FLOAT). Red in bits 0-10, green in 11-21 and blue in 22-31. Every channel keeps its own
+*   relative precision of 2^-7 (red, green) or 2^-6 (blue), the largest values are 65024 and 64512.
+*
+* The kernels only use integer and float arithmetic without branches, so the span versions vectorize.
+*/
+
+namespace Raychel {
+
+    namespace details::hdr_encoding {
+
+        //2^e for e in [-126, 127]
+        constexpr float pow2(std::int32_t e) noexcept
+        {
+            return std::bit_cast<float>(static_cast<std::uint32_t>(e + 127) << 23U);
+        }
+
+        //floor(log2(x)) for normal positive x, -127 for 0 and denormals
+        constexpr std::int32_t floor_log2(float x) noexcept
+        {
+            return static_cast<std::int32_t>(std::bit_cast<std::uint32_t>(x) >> 23U) - 127;
+        }
+
+        //Truncate a non-negative float below 2^31. Going through int32 lets SSE2 convert four lanes at once
+        constexpr std::uint32_t to_bits(float x) noexcept
+        {
+            return static_cast<std::uint32_t>(static_cast<std::int32_t>(x));
+        }
+
+        //condition ? a : b without a branch. GCC moves float conversions into the arms of a ternary, which keeps the loops
+        //from being vectorized
+        constexpr std::uint32_t select_bits(bool condition, std::uint32_t a, std::uint32_t b) noexcept
+        {
+            const std::uint32_t mask = 0U - static_cast<std::uint32_t>(condition);
+            return (a & mask) | (b & ~mask);
+        }
+
+        //x clamped to [0, max], NaN becomes 0. Comparing the bits as integers keeps GCC from branching on float
+        //comparisons that could trap
+        constexpr float clamp_channel(float x, float max) noexcept
+        {
+            const auto bits = std::bit_cast<std::int32_t>(x);
+            const auto max_bits = std::bit_cast<std::int32_t>(max);
+            const bool nan = (bits & 0x7FFFFFFF) > 0x7F800000;
+
+            const std::int32_t positive = bits > 0 ? bits : 0;
+            const std::int32_t clamped = positive < max_bits ? positive : max_bits;
+            return std::bit_cast<float>(select_bits(nan, 0U, static_cast<std::uint32_t>(clamped)));
+        }
+
+        constexpr float max3(float a, float b, float c) noexcept
+        {
+            const float ab = a < b ? b : a;
+            return ab < c ? c : ab;
+        }
+
+        //Largest float with a frexp exponent of 127, so the RGBE exponent fits into a byte
+        constexpr float rgbe_max = std::bit_cast<float>(0x7EFFFFFFU);
+        constexpr float rgbe_min = pow2(-106);
+
+        constexpr float rgb9e5_max = 65408.F; //511 / 512 * 2^16
+
+        //Unsigned small float with 5 exponent bits (bias 15) and M mantissa bits
+        template <std::uint32_t M>
+        constexpr std::uint32_t encode_small_float(float x) noexcept
+        {
+            constexpr float max = (2.F - pow2(-static_cast<std::int32_t>(M))) * pow2(15);
+            constexpr float min_normal = pow2(-14);
+
+            x = clamp_channel(x, max);
+
+            //denormals are multiples of 2^(-14 - M), and rounding up to 2^M yields the smallest normal
+            const auto denormal = to_bits((x * pow2(14 + static_cast<std::int32_t>(M))) + .5F);
+
+            //the exponent and mantissa bits are contiguous, so a carry out of the rounded mantissa bumps the exponent
+            const auto bits = std::bit_cast<std::uint32_t>(x);
+            const auto normal = ((bits + (1U << (22U - M))) >> (23U - M)) - (112U << M);
+
+            return select_bits(x < min_normal, denormal, normal);
+        }
+
+        template <std::uint32_t M>
+        constexpr float decode_small_float(std::uint32_t v) noexcept
+        {
+            constexpr std::uint32_t mantissa_mask = (1U << M) - 1U;
+            const std::uint32_t exponent = v >> M;
+            const std::uint32_t mantissa = v & mantissa_mask;
+
+            const auto denormal = std::bit_cast<std::uint32_t>(static_cast<float>(mantissa) * pow2(-14 - static_cast<std::int32_t>(M)));
+            const std::uint32_t normal = (v + (112U << M)) << (23U - M);
+            //infinity for a zero mantissa, NaN otherwise
+            const std::uint32_t special = 0x7F800000U | (mantissa << (23U - M));
+
+            return std::bit_cast<float>(select_bits(exponent == 0, denormal, select_bits(exponent == 31, special, normal)));
+        }
+
+    } // namespace details::hdr_encoding
+
+    /**
+    * \brief Encode a color as RGBE
+    */
+    constexpr std::uint32_t encode_rgbe(const basic_color<float>& c) noexcept
+    {
+        using namespace details::hdr_encoding;
+
+        const float r = clamp_channel(c.r(), rgbe_max);
+        const float g = clamp_channel(c.g(), rgbe_max);
+        const float b = clamp_channel(c.b(), rgbe_max);
+        const float v = max3(r, g, b);
+
+        //v = m * 2^e with m in [0.5, 1) as with std::frexp, so every channel times 2^(8 - e) is below 256
+        const std::int32_t e = floor_log2(v) + 1;
+        const float scale = pow2(8 - (v < rgbe_min ? 0 : e));
+
+        const std::uint32_t res = to_bits(r * scale) | (to_bits(g * scale) << 8U) |
+                                  (to_bits(b * scale) << 16U) |
+                                  (static_cast<std::uint32_t>(e + 128) << 24U);
+        return select_bits(v < rgbe_min, 0U, res);
+    }
+
+    /**
+    * \brief Decode an RGBE color. Exponents that the encoder never produces (below 2^-106) decode to black
+    */
+    constexpr basic_color<float> decode_rgbe(std::uint32_t v) noexcept
+    {
+        using namespace details::hdr_encoding;
+
+        //rgbe_min = 2^-106, so valid exponents are at least 23 and 2^(e - 136) is a normal float
+        const auto e = static_cast<std::int32_t>(v >> 24U);
+        const float scale = e < 23 ? 0.F : pow2((e < 23 ? 136 : e) - 136);
+
+        return basic_color<float>{
+            (static_cast<float>(v & 0xFFU) + .5F) * scale,
+            (static_cast<float>((v >> 8U) & 0xFFU) + .5F) * scale,
+            (static_cast<float>((v >> 16U) & 0xFFU) + .5F) * scale};
+    }
+
+    /**
+    * \brief Encode a color as RGB9E5
+    */
+    constexpr std::uint32_t encode_rgb9e5(const basic_color<float>& c) noexcept
+    {
+        using namespace details::hdr_encoding;
+
+        const float r = clamp_channel(c.r(), rgb9e5_max);
+        const float g = clamp_channel(c.g(), rgb9e5_max);
+        const float b = clamp_channel(c.b(), rgb9e5_max);
+        const float v = max3(r, g, b);
+
+        //Shared exponent following the extension spec: bias 15, 9 mantissa bits without an implicit one
+        const std::int32_t log2_v = floor_log2(v);
+        const std::int32_t e_guess = (log2_v < -16 ? -16 : log2_v) + 16;
+        const auto max_mantissa = to_bits((v * pow2(24 - e_guess)) + .5F);
+        const std::int32_t e = max_mantissa == 512U ? e_guess + 1 : e_guess;
+
+        const float scale = pow2(24 - e);
+        return to_bits((r * scale) + .5F) | (to_bits((g * scale) + .5F) << 9U) |
+               (to_bits((b * scale) + .5F) << 18U) | (static_cast<std::uint32_t>(e) << 27U);
+    }
+
+    /**
+    * \brief Decode an RGB9E5 color
+    */
+    constexpr basic_color<float> decode_rgb9e5(std::uint32_t v) noexcept
+    {
+        using namespace details::hdr_encoding;
+
+        const float scale = pow2(static_cast<std::int32_t>(v >> 27U) - 24);
+        return basic_color<float>{
+            static_cast<float>(v & 0x1FFU) * scale,
+            static_cast<float>((v >> 9U) & 0x1FFU) * scale,
+            static_cast<float>((v >> 18U) & 0x1FFU) * scale};
+    }
+
+    /**
+    * \brief Encode a color as R11G11B10F
+    */
+    constexpr std::uint32_t encode_r11g11b10f(const basic_color<float>& c) noexcept
+    {
+        using namespace details::hdr_encoding;
+
+        return encode_small_float<6>(c.r()) | (encode_small_float<6>(c.g()) << 11U) | (encode_small_float<5>(c.b()) << 22U);
+    }
+
+    /**
+    * \brief Decode an R11G11B10F color. Infinity and NaN channels decode as such, although the encoder never produces them
+    */
+    constexpr basic_color<float> decode_r11g11b10f(std::uint32_t v) noexcept
+    {
+        using namespace details::hdr_encoding;
+
+        return basic_color<float>{
+            decode_small_float<6>(v & 0x7FFU), decode_small_float<6>((v >> 11U) & 0x7FFU), decode_small_float<5>(v >> 22U)};
+    }
+
+    namespace details::hdr_encoding {
+
+        //The kernels run over blocks of separate channel arrays, which vectorize much better than strided colors
+        constexpr std::size_t block_size = 64;
+
+        template <typename Encode>
+        void encode_blocks(std::span<const basic_color<float>> src, std::span<std::uint32_t> dst, Encode&& encode) noexcept
+        {
+            RAYCHEL_ASSERT(dst.size() >= src.size());
+            std::array<float, block_size> r{};
+            std::array<float, block_size> g{};
+            std::array<float, block_size> b{};
+
+            const auto* in = channels(src);
+            for (std::size_t begin{0}; begin < src.size(); begin += block_size) {
+                const auto count = std::min(block_size, src.size() - begin);
+                for (std::size_t i{0}; i != count; ++i) {
+                    r[i] = in[((begin + i) * 3) + 0];
+                    g[i] = in[((begin + i) * 3) + 1];
+                    b[i] = in[((begin + i) * 3) + 2];
+                }
+                for (std::size_t i{0}; i != count; ++i) {
+                    dst[begin + i] = encode(basic_color<float>{r[i], g[i], b[i]});
+                }
+            }
+        }
+
+        template <typename Decode>
+        void decode_blocks(std::span<const std::uint32_t> src, std::span<basic_color<float>> dst, Decode&& decode) noexcept
+        {
+            RAYCHEL_ASSERT(dst.size() >= src.size());
+            std::array<float, block_size> r{};
+            std::array<float, block_size> g{};
+            std::array<float, block_size> b{};
+
+            auto* out = channels(dst);
+            for (std::size_t begin{0}; begin < src.size(); begin += block_size) {
+                const auto count = std::min(block_size, src.size() - begin);
+                for (std::size_t i{0}; i != count; ++i) {
+                    const auto c = decode(src[begin + i]);
+                    r[i] = c.r();
+                    g[i] = c.g();
+                    b[i] = c.b();
+                }
+                for (std::size_t i{0}; i != count; ++i) {
+                    out[((begin + i) * 3) + 0] = r[i];
+                    out[((begin + i) * 3) + 1] = g[i];
+                    out[((begin + i) * 3) + 2] = b[i];
+                }
+            }
+        }
+
+    } // namespace details::hdr_encoding
+
+    //Span versions, dst must hold at least src.size() elements
+
+#define RAYCHELMATH_HDR_ENCODING_SPAN(name)                                                                                     \
+    inline void encode_##name(std::span<const basic_color<float>> src, std::span<std::uint32_t> dst) noexcept                  \
+    {                                                                                                                          \
+        details::hdr_encoding::encode_blocks(src, dst, [](const basic_color<float>& c) { return encode_##name(c); });         \
+    }                                                                                                                          \
+                                                                                                                               \
+    inline void decode_##name(std::span<const std::uint32_t> src, std::span<basic_color<float>> dst) noexcept                  \
+    {                                                                                                                          \
+        details::hdr_encoding::decode_blocks(src, dst, [](std::uint32_t v) { return decode_##name(v); });                      \
+    }
+
+    RAYCHELMATH_HDR_ENCODING_SPAN(rgbe)
+    RAYCHELMATH_HDR_ENCODING_SPAN(rgb9e5)
+    RAYCHELMATH_HDR_ENCODING_SPAN(r11g11b10f)
+
+#undef RAYCHELMATH_HDR_ENCODING_SPAN
+
+} // namespace Raychel
+
+#endif //!RAYCHELMATH_HDR_ENCODING_H
@@ -0,0 +1,403 @@
+/**
+* \file low_discrepancy.h
+* \author Weckyy702 (weckyy702@gmail.com)
+* \brief Sobol, Owen scrambled Sobol, Halton and Kronecker (R2) sequences
+* \date 2026-10-16
+*
+* MIT License
+* Copyright (c) [2026] [Weckyy702 (weckyy702@gmail.com | https://github.com/Weckyy702)]
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+#ifndef RAYCHELMATH_LOW_DISCREPANCY_H
+#define RAYCHELMATH_LOW_DISCREPANCY_H
+
+#include "RaychelCore/Raychel_assert.h"
+#include "random.h"
+#include "vec2.h"
+#include "vec3.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+/**
+* Points that fill [0, 1)^n much more evenly than random numbers, so an estimate converges faster with the same number
+* of samples. Every sequence gives random access to coordinate `dimension` of point `index`, and sample_2d / sample_3d
+* combine consecutive dimensions into points for the samplers in sampling.h.
+*
+* - Sobol: the first 2^m points put one coordinate into each interval of size 2^-m in every dimension, and dimensions
+*   0 and 1 form a (0, m, 2)-net. Up to 16 dimensions, with Joe and Kuo's direction numbers.
+* - OwenScrambledSobol: Sobol with hash based nested uniform scrambling (Burley, "Practical Hash-based Owen Scrambling",
+*   2020). Keeps the net properties, removes the structured artifacts and gives every seed an independent sequence.
+*   Dimensions past 4 reuse the first four Sobol dimensions with different seeds, so any number of them works.
+* - Halton: radical inverses in the first 32 prime bases. Needs no power of two sample counts.
+* - Kronecker<D>: x_n = frac(1/2 + n * alpha) with the R_D constants of Roberts ("The Unreasonable Effectiveness of
+*   Quasirandom Sequences"). R2 is the 2D version. The cheapest, but only stratified for its own dimension count.
+*/
+
+namespace Raychel {
+
+    namespace details::low_discrepancy {
+
+        constexpr std::size_t sobol_dimensions = 16;
+
+        //Primitive polynomial and initial direction numbers m_1...m_s of one Sobol dimension (new-joe-kuo-6.21201)
+        struct SobolPolynomial
+        {
+            std::uint32_t degree;
+            std::uint32_t coefficients;
+            std::array<std::uint32_t, 6> m;
+        };
+
+        // clang-format off
+        constexpr std::array<SobolPolynomial, sobol_dimensions - 1> sobol_polynomials{{
+            {1, 0, {1}},
+            {2, 1, {1, 3}},
+            {3, 1, {1, 3, 1}},
+            {3, 2, {1, 1, 1}},
+            {4, 1, {1, 1, 3, 3}},
+            {4, 4, {1, 3, 5, 13}},
+            {5, 2, {1, 1, 5, 5, 17}},
+            {5, 4, {1, 1, 5, 5, 5}},
+            {5, 7, {1, 1, 7, 11, 19}},
+            {5, 11, {1, 1, 5, 1, 1}},
+            {5, 13, {1, 1, 1, 3, 11}},
+            {5, 14, {1, 3, 5, 5, 31}},
+            {6, 1, {1, 3, 3, 9, 7, 49}},
+            {6, 13, {1, 1, 1, 15, 21, 21}},
+            {6, 16, {1, 3, 1, 13, 27, 49}},
+        }};
+        // clang-format on
+
+        //Column j of the generator matrix of every dimension, with the most significant bit first
+        constexpr auto sobol_matrices = [] {
+            std::array<std::array<std::uint32_t, 32>, sobol_dimensions> matrices{};
+            for (std::uint32_t j{0}; j != 32; ++j) {
+                matrices[0][j] = std::uint32_t{1} << (31U - j);
+            }
+            for (std::size_t d{1}; d != sobol_dimensions; ++d) {
+                const auto& [s, a, m] = sobol_polynomials[d - 1];
+                auto& v = matrices[d];
+                for (std::uint32_t j{0}; j != 32; ++j) {
+                    if (j < s) {
+                        v[j] = m[j] << (31U - j);
+                        continue;
+                    }
+                    v[j] = v[j - s] ^ (v[j - s] >> s);
+                    for (std::uint32_t k{1}; k != s; ++k) {
+                        if (((a >> (s - 1 - k)) & 1U) != 0) {
+                            v[j] ^= v[j - k];
+                        }
+                    }
+                }
+            }
+            return matrices;
+        }();
+
+        //XOR of the generator matrix columns selected by each possible byte of the index, so a point takes four lookups
+        //instead of one step per index bit
+        constexpr auto sobol_byte_tables = [] {
+            std::array<std::array<std::array<std::uint32_t, 256>, 4>, sobol_dimensions> tables{};
+            for (std::size_t d{0}; d != sobol_dimensions; ++d) {
+                for (std::uint32_t byte{0}; byte != 4; ++byte) {
+                    auto& table = tables[d][byte];
+                    //value without its lowest set bit is already done
+                    for (std::uint32_t value{1}; value != 256; ++value) {
+                        const auto lowest = static_cast<std::uint32_t>(std::countr_zero(value));
+                        table[value] = table[value & (value - 1)] ^ sobol_matrices[d][(8 * byte) + lowest];
+                    }
+                }
+            }
+            return tables;
+        }();
+
+        constexpr std::uint32_t sobol(std::uint32_t index, std::size_t dimension) noexcept
+        {
+            const auto& tables = sobol_byte_tables[dimension];
+            return tables[0][index & 0xFFU] ^ tables[1][(index >> 8U) & 0xFFU] ^ tables[2][(index >> 16U) & 0xFFU] ^
+                   tables[3][index >> 24U];
+        }
+
+        //Integer hash with good avalanche (Wellons' lowbias32)
+        constexpr std::uint32_t hash(std::uint32_t x) noexcept
+        {
+            x ^= x >> 16U;
+            x *= 0x7FEB352DU;
+            x ^= x >> 15U;
+            x *= 0x846CA68BU;
+            x ^= x >> 16U;
+            return x;
+        }
+
+        constexpr std::uint32_t hash_combine(std::uint32_t seed, std::uint32_t value) noexcept
+        {
+            return seed ^ (hash(value) + 0x9E3779B9U + (seed << 6U) + (seed >> 2U));
+        }
+
+        constexpr std::uint32_t reverse_bits(std::uint32_t x) noexcept
+        {
+            x = ((x >> 1U) & 0x55555555U) | ((x & 0x55555555U) << 1U);
+            x = ((x >> 2U) & 0x33333333U) | ((x & 0x33333333U) << 2U);
+            x = ((x >> 4U) & 0x0F0F0F0FU) | ((x & 0x0F0F0F0FU) << 4U);
+            x = ((x >> 8U) & 0x00FF00FFU) | ((x & 0x00FF00FFU) << 8U);
+            return (x >> 16U) | (x << 16U);
+        }
+
+        //Every output bit only depends on the input bits below it (Laine and Karras, improved by Burley)
+        constexpr std::uint32_t laine_karras_permutation(std::uint32_t x, std::uint32_t seed) noexcept
+        {
+            x += seed;
+            x ^= x * 0x6C50B47CU;
+            x ^= x * 0xB82F1E52U;
+            x ^= x * 0xC7AFE638U;
+            x ^= x * 0x8D22F6E6U;
+            return x;
+        }
+
+        //Owen scrambling: flips every bit based on the bits above it
+        constexpr std::uint32_t nested_uniform_scramble(std::uint32_t x, std::uint32_t seed) noexcept
+        {
+            return reverse_bits(laine_karras_permutation(reverse_bits(x), seed));
+        }
+
+        constexpr std::array<std::uint32_t, 32> halton_bases{2,  3,  5,  7,  11, 13, 17, 19, 23, 29,  31,  37,  41,  43,  47,  53,
+                                                             59, 61, 67, 71, 73, 79, 83, 89, 97, 101, 103, 107, 109, 113, 127, 131};
+
+        template <std::floating_point T>
+        constexpr T radical_inverse(std::uint32_t base, std::uint32_t index) noexcept
+        {
+            //reversed < base^digits <= base * index, which fits into 64 bits
+            const double inv_base = 1.0 / static_cast<double>(base);
+            std::uint64_t reversed{0};
+            double inv_base_n{1};
+            while (index != 0) {
+                const auto next = index / base;
+                reversed = (reversed * base) + (index - (next * base));
+                inv_base_n *= inv_base;
+                index = next;
+            }
+            //rounding to T must not reach 1
+            constexpr T one_minus_epsilon = T(1) - (std::numeric_limits<T>::epsilon() / 2);
+            return std::min(static_cast<T>(static_cast<double>(reversed) * inv_base_n), one_minus_epsilon);
+        }
+
+        //alpha_j = phi^-j for j in [1, D] as 64 bit fractions, where phi^(D + 1) = phi + 1
+        template <std::size_t D>
+        constexpr std::array<std::uint64_t, D> kronecker_alphas() noexcept
+        {
+            long double phi = 2;
+            for (int i = 0; i != 64; ++i) {
+                long double power = 1;
+                for (std::size_t j{0}; j != D; ++j) {
+                    power *= phi;
+                }
+                //Newton step for phi^(D + 1) - phi - 1 = 0
+                phi -= ((power * phi) - phi - 1) / ((static_cast<long double>(D + 1) * power) - 1);
+            }
+
+            std::array<std::uint64_t, D> alphas{};
+            long double alpha = 1;
+            for (auto& a : alphas) {
+                alpha /= phi;
+                //2^64 * alpha, in two steps because 2^64 does not fit into the integer
+                const auto high = static_cast<std::uint64_t>(alpha * 0x1p32L);
+                const auto low = static_cast<std::uint64_t>(((alpha * 0x1p32L) - static_cast<long double>(high)) * 0x1p32L);
+                a = (high << 32U) | low;
+            }
+            return alphas;
+        }
+
+    } // namespace details::low_discrepancy
+
+    /**
+    * \brief Sequences giving random access to coordinate dimension of point index as a number in [0, 1)
+    */
+    template <typename Sequence>
+    concept LowDiscrepancySequence = requires(const Sequence& sequence, std::uint32_t index, std::size_t dimension) {
+        { sequence.template sample<float>(index, dimension) } -> std::same_as<float>;
+        { sequence.template sample<double>(index, dimension) } -> std::same_as<double>;
+        { Sequence::max_dimension } -> std::convertible_to<std::size_t>;
+    };
+
+    class Sobol
+    {
+    public:
+        static constexpr std::size_t max_dimension = details::low_discrepancy::sobol_dimensions;
+
+        template <std::floating_point T = float>
+        [[nodiscard]] constexpr T sample(std::uint32_t index, std::size_t dimension) const noexcept
+        {
+            RAYCHEL_ASSERT(dimension < max_dimension);
+            return details::random::uniform_from_bits<T>(details::low_discrepancy::sobol(index, dimension));
+        }
+    };
+
+    class OwenScrambledSobol
+    {
+    public:
+        static constexpr std::size_t max_dimension = std::numeric_limits<std::size_t>::max();
+
+        constexpr OwenScrambledSobol() = default;
+
+        /**
+        * \brief Different seeds give independent sequences, for example one per pixel
+        */
+        constexpr explicit OwenScrambledSobol(std::uint32_t seed) noexcept : seed_{seed}
+        {}
+
+        template <std::floating_point T = float>
+        [[nodiscard]] constexpr T sample(std::uint32_t index, std::size_t dimension) const noexcept
+        {
+            using namespace details::low_discrepancy;
+
+            //The points of each group of four dimensions come from their own shuffle of the sequence
+            const auto group = static_cast<std::uint32_t>(dimension / padded_dimensions);
+            const auto shuffled_index = nested_uniform_scramble(index, hash_combine(seed_, group));
+            const auto bits = sobol(shuffled_index, dimension % padded_dimensions);
+
+            return details::random::uniform_from_bits<T>(
+                nested_uniform_scramble(bits, hash_combine(seed_, static_cast<std::uint32_t>(dimension) + 0x5851F42DU)));
+        }
+
+        [[nodiscard]] constexpr std::uint32_t seed() const noexcept
+        {
+            return seed_;
+        }
+
+    private:
+        static constexpr std::size_t padded_dimensions = 4;
+
+        std::uint32_t seed_{0};
+    };
+
+    class Halton
+    {
+    public:
+        static constexpr std::size_t max_dimension = details::low_discrepancy::halton_bases.size();
+
+        template <std::floating_point T = float>
+        [[nodiscard]] constexpr T sample(std::uint32_t index, std::size_t dimension) const noexcept
+        {
+            RAYCHEL_ASSERT(dimension < max_dimension);
+            return details::low_discrepancy::radical_inverse<T>(details::low_discrepancy::halton_bases[dimension], index);
+        }
+    };
+
+    /**
+    * \tparam D number of dimensions the alphas are chosen for
+    */
+    template <std::size_t D>
+        requires(D > 0)
+    class Kronecker
+    {
+    public:
+        static constexpr std::size_t max_dimension = D;
+
+        template <std::floating_point T = float>
+        [[nodiscard]] constexpr T sample(std::uint32_t index, std::size_t dimension) const noexcept
+        {
+            RAYCHEL_ASSERT(dimension < max_dimension);
+            //the fixed point sum wraps around exactly, unlike a float one
+            constexpr std::uint64_t half = std::uint64_t{1} << 63U;
+            const std::uint64_t x = half + (static_cast<std::uint64_t>(index) * alphas[dimension]);
+            return details::random::uniform_from_bits<T>(static_cast<std::uint32_t>(x >> 32U));
+        }
+
+    private:
+        static constexpr auto alphas = details::low_discrepancy::kronecker_alphas<D>();
+    };
+
+    using R2 = Kronecker<2>;
+
+    /**
+    * \brief Point index in dimensions dimension and dimension + 1, for the 2D samplers in sampling.h
+    */
+    template <std::floating_point T = float, LowDiscrepancySequence Sequence>
+    constexpr basic_vec2<T> sample_2d(const Sequence& sequence, std::uint32_t index, std::size_t dimension = 0) noexcept
+    {
+        return basic_vec2<T>{sequence.template sample<T>(index, dimension), sequence.template sample<T>(index, dimension + 1)};
+    }
+
+    template <std::floating_point T = float, LowDiscrepancySequence Sequence>
+    constexpr basic_vec3<T> sample_3d(const Sequence& sequence, std::uint32_t index, std::size_t dimension = 0) noexcept
+    {
+        return basic_vec3<T>{
+            sequence.template sample<T>(index, dimension),
+            sequence.template sample<T>(index, dimension + 1),
+            sequence.template sample<T>(index, dimension + 2)};
+    }
+
+    //Batch versions: out[i] is point first_index + i
+
+    template <std::floating_point T, LowDiscrepancySequence Sequence>
+    void fill(const Sequence& sequence, std::uint32_t first_index, std::size_t dimension, std::span<T> out) noexcept
+    {
+        for (std::size_t i{0}; i != out.size(); ++i) {
+            out[i] = sequence.template sample<T>(first_index + static_cast<std::uint32_t>(i), dimension);
+        }
+    }
+
+    template <std::floating_point T, LowDiscrepancySequence Sequence>
+    void fill(const Sequence& sequence, std::uint32_t first_index, std::size_t dimension, std::span<basic_vec2<T>> out) noexcept
+    {
+        for (std::size_t i{0}; i != out.size(); ++i) {
+            out[i] = sample_2d<T>(sequence, first_index + static_cast<std::uint32_t>(i), dimension);
+        }
+    }
+
+    template <std::floating_point T, LowDiscrepancySequence Sequence>
+    void fill(const Sequence& sequence, std::uint32_t first_index, std::size_t dimension, std::span<basic_vec3<T>> out) noexcept
+    {
+        for (std::size_t i{0}; i != out.size(); ++i) {
+            out[i] = sample_3d<T>(sequence, first_index + static_cast<std::uint32_t>(i), dimension);
+        }
+    }
+
+    /**
+    * \brief Callable returning the coordinates of point index one dimension after the other, for the functions in
+    * vector.h that take a const rng. The sequence is referenced and must outlive the generator
+    */
+    template <std::floating_point T, LowDiscrepancySequence Sequence>
+    class DimensionGenerator
+    {
+    public:
+        constexpr DimensionGenerator(const Sequence& sequence, std::uint32_t index, std::size_t first_dimension = 0) noexcept
+            : sequence_{&sequence}, index_{index}, dimension_{first_dimension}
+        {}
+
+        constexpr T operator()() const noexcept
+        {
+            return sequence_->template sample<T>(index_, dimension_++);
+        }
+
+    private:
+        const Sequence* sequence_;
+        std::uint32_t index_;
+        mutable std::size_t dimension_;
+    };
+
+} // namespace Raychel
+
+#endif //!RAYCHELMATH_LOW_DISCREPANCY_H
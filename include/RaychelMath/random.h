@@ -0,0 +1,657 @@
+/**
+* \file random.h
+* \author Weckyy702 (weckyy702@gmail.com)
+* \brief Small and fast random number engines
+* \date 2026-10-16
+*
+* MIT License
+* Copyright (c) [2026] [Weckyy702 (weckyy702@gmail.com | https://github.com/Weckyy702)]
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+#ifndef RAYCHELMATH_RANDOM_H
+#define RAYCHELMATH_RANDOM_H
+
+#include "RaychelCore/Raychel_assert.h"
+#include "concepts.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <ostream>
+
+/**
+* The engines below satisfy StdRandomNumberEngine and fit into one or four 64 bit words, compared to the 2.5 KB of
+* std::mt19937. Seeding from a single value runs it through SplitMix64 as recommended by the xoshiro authors.
+*
+* - SplitMix64: seeder and a decent generator in its own right, discard is O(1)
+* - Xoshiro256PlusPlus: general purpose 64 bit generator with a period of 2^256 - 1
+* - Xoroshiro128Plus: the fastest one, but its lowest bits are weak. Fine for floats made from the top bits
+* - Xoshiro128PlusPlus: 32 bit variant of xoshiro256++, the lanes of RandomStreams run this one
+* - PCG32: 32 bit output, 2^63 selectable streams and O(log n) discard
+*
+* For independent per-thread streams, seed one xoshiro engine and call jump() between handing out copies. Each
+* jump advances the engine by 2^128 (xoshiro256) or 2^64 (xoroshiro128, xoshiro128) steps, long_jump() by 2^192 or
+* 2^96 steps.
+*/
+
+namespace Raychel {
+
+    namespace details::random {
+
+        //Whitespace separated decimal state words, like the standard engines
+        template <typename Word, std::size_t N>
+        std::ostream& write_state(std::ostream& os, const std::array<Word, N>& state)
+        {
+            const auto flags = os.flags(std::ios_base::dec | std::ios_base::left);
+            const auto fill = os.fill(' ');
+            for (std::size_t i{0}; i != N; ++i) {
+                if (i != 0) {
+                    os << ' ';
+                }
+                os << state[i];
+            }
+            os.flags(flags);
+            os.fill(fill);
+            return os;
+        }
+
+        //The state is only changed if every word could be read
+        template <typename Word, std::size_t N>
+        std::istream& read_state(std::istream& is, std::array<Word, N>& state)
+        {
+            std::array<Word, N> res{};
+            const auto flags = is.flags(std::ios_base::dec | std::ios_base::skipws);
+            for (auto& word : res) {
+                is >> word;
+            }
+            is.flags(flags);
+            if (!is.fail()) {
+                state = res;
+            }
+            return is;
+        }
+
+        //Advance a xor-shift family engine by the number of steps encoded in the jump polynomial
+        template <typename Engine, std::unsigned_integral Word, std::size_t N>
+        constexpr void jump(Engine& engine, std::array<Word, N>& state, const std::array<Word, N>& polynomial) noexcept
+        {
+            std::array<Word, N> res{};
+            for (const auto word : polynomial) {
+                for (int bit{0}; bit != std::numeric_limits<Word>::digits; ++bit) {
+                    if (((word >> bit) & 1U) != 0) {
+                        for (std::size_t i{0}; i != N; ++i) {
+                            res[i] ^= state[i];
+                        }
+                    }
+                    engine();
+                }
+            }
+            state = res;
+        }
+
+    } // namespace details::random
+
+    /**
+    * \brief Sebastiano Vigna's SplitMix64. Every seed is fine, including 0
+    */
+    class SplitMix64
+    {
+    public:
+        using result_type = std::uint64_t;
+
+        static constexpr result_type default_seed = 0;
+
+        constexpr SplitMix64() noexcept = default;
+
+        constexpr explicit SplitMix64(result_type seed) noexcept : state_{seed}
+        {}
+
+        constexpr void seed(result_type seed = default_seed) noexcept
+        {
+            state_ = seed;
+        }
+
+        static constexpr result_type min() noexcept
+        {
+            return 0;
+        }
+
+        static constexpr result_type max() noexcept
+        {
+            return std::numeric_limits<result_type>::max();
+        }
+
+        constexpr result_type operator()() noexcept
+        {
+            state_ += increment;
+            std::uint64_t z = state_;
+            z = (z ^ (z >> 30U)) * 0xBF58476D1CE4E5B9U;
+            z = (z ^ (z >> 27U)) * 0x94D049BB133111EBU;
+            return z ^ (z >> 31U);
+        }
+
+        constexpr void discard(unsigned long long z) noexcept
+        {
+            state_ += z * increment;
+        }
+
+        constexpr bool operator==(const SplitMix64&) const noexcept = default;
+
+        friend std::ostream& operator<<(std::ostream& os, const SplitMix64& engine)
+        {
+            return details::random::write_state(os, std::array{engine.state_});
+        }
+
+        friend std::istream& operator>>(std::istream& is, SplitMix64& engine)
+        {
+            std::array state{engine.state_};
+            details::random::read_state(is, state);
+            engine.state_ = state[0];
+            return is;
+        }
+
+    private:
+        static constexpr std::uint64_t increment = 0x9E3779B97F4A7C15U;
+
+        std::uint64_t state_{default_seed};
+    };
+
+    /**
+    * \brief xoshiro256++ 1.0 by David Blackman and Sebastiano Vigna
+    */
+    class Xoshiro256PlusPlus
+    {
+    public:
+        using result_type = std::uint64_t;
+        using state_type = std::array<std::uint64_t, 4>;
+
+        static constexpr result_type default_seed = 0;
+
+        constexpr Xoshiro256PlusPlus() noexcept
+        {
+            seed();
+        }
+
+        constexpr explicit Xoshiro256PlusPlus(result_type seed) noexcept
+        {
+            this->seed(seed);
+        }
+
+        /**
+        * \brief Start from an explicit state, which must not be all zeros
+        */
+        constexpr explicit Xoshiro256PlusPlus(const state_type& state) noexcept : state_{state}
+        {
+            RAYCHEL_ASSERT(state != state_type{});
+        }
+
+        constexpr void seed(result_type seed = default_seed) noexcept
+        {
+            SplitMix64 seeder{seed};
+            for (auto& word : state_) {
+                word = seeder();
+            }
+        }
+
+        static constexpr result_type min() noexcept
+        {
+            return 0;
+        }
+
+        static constexpr result_type max() noexcept
+        {
+            return std::numeric_limits<result_type>::max();
+        }
+
+        constexpr result_type operator()() noexcept
+        {
+            auto& s = state_;
+            const std::uint64_t res = std::rotl(s[0] + s[3], 23) + s[0];
+            const std::uint64_t t = s[1] << 17U;
+
+            s[2] ^= s[0];
+            s[3] ^= s[1];
+            s[1] ^= s[2];
+            s[0] ^= s[3];
+            s[2] ^= t;
+            s[3] = std::rotl(s[3], 45);
+
+            return res;
+        }
+
+        constexpr void discard(unsigned long long z) noexcept
+        {
+            for (; z != 0; --z) {
+                (*this)();
+            }
+        }
+
+        /**
+        * \brief Advance by 2^128 steps, which gives 2^128 non-overlapping sequences
+        */
+        constexpr void jump() noexcept
+        {
+            constexpr state_type polynomial{0x180EC6D33CFD0ABAU, 0xD5A61266F0C9392CU, 0xA9582618E03FC9AAU, 0x39ABDC4529B1661CU};
+            details::random::jump(*this, state_, polynomial);
+        }
+
+        /**
+        * \brief Advance by 2^192 steps, for 2^64 starting points which can each be split up with jump()
+        */
+        constexpr void long_jump() noexcept
+        {
+            constexpr state_type polynomial{0x76E15D3EFEFDCBBFU, 0xC5004E441C522FB3U, 0x77710069854EE241U, 0x39109BB02ACBE635U};
+            details::random::jump(*this, state_, polynomial);
+        }
+
+        [[nodiscard]] constexpr const state_type& state() const noexcept
+        {
+            return state_;
+        }
+
+        constexpr bool operator==(const Xoshiro256PlusPlus&) const noexcept = default;
+
+        friend std::ostream& operator<<(std::ostream& os, const Xoshiro256PlusPlus& engine)
+        {
+            return details::random::write_state(os, engine.state_);
+        }
+
+        friend std::istream& operator>>(std::istream& is, Xoshiro256PlusPlus& engine)
+        {
+            return details::random::read_state(is, engine.state_);
+        }
+
+    private:
+        state_type state_{};
+    };
+
+    /**
+    * \brief xoroshiro128+ 1.0 by David Blackman and Sebastiano Vigna. The lowest bits fail linearity tests, so use the
+    * top bits or uniform_real
+    */
+    class Xoroshiro128Plus
+    {
+    public:
+        using result_type = std::uint64_t;
+        using state_type = std::array<std::uint64_t, 2>;
+
+        static constexpr result_type default_seed = 0;
+
+        constexpr Xoroshiro128Plus() noexcept
+        {
+            seed();
+        }
+
+        constexpr explicit Xoroshiro128Plus(result_type seed) noexcept
+        {
+            this->seed(seed);
+        }
+
+        /**
+        * \brief Start from an explicit state, which must not be all zeros
+        */
+        constexpr explicit Xoroshiro128Plus(const state_type& state) noexcept : state_{state}
+        {
+            RAYCHEL_ASSERT(state != state_type{});
+        }
+
+        constexpr void seed(result_type seed = default_seed) noexcept
+        {
+            SplitMix64 seeder{seed};
+            for (auto& word : state_) {
+                word = seeder();
+            }
+        }
+
+        static constexpr result_type min() noexcept
+        {
+            return 0;
+        }
+
+        static constexpr result_type max() noexcept
+        {
+            return std::numeric_limits<result_type>::max();
+        }
+
+        constexpr result_type operator()() noexcept
+        {
+            const std::uint64_t s0 = state_[0];
+            std::uint64_t s1 = state_[1];
+            const std::uint64_t res = s0 + s1;
+
+            s1 ^= s0;
+            state_[0] = std::rotl(s0, 24) ^ s1 ^ (s1 << 16U);
+            state_[1] = std::rotl(s1, 37);
+
+            return res;
+        }
+
+        constexpr void discard(unsigned long long z) noexcept
+        {
+            for (; z != 0; --z) {
+                (*this)();
+            }
+        }
+
+        /**
+        * \brief Advance by 2^64 steps, which gives 2^64 non-overlapping sequences
+        */
+        constexpr void jump() noexcept
+        {
+            constexpr state_type polynomial{0xDF900294D8F554A5U, 0x170865DF4B3201FCU};
+            details::random::jump(*this, state_, polynomial);
+        }
+
+        /**
+        * \brief Advance by 2^96 steps, for 2^32 starting points which can each be split up with jump()
+        */
+        constexpr void long_jump() noexcept
+        {
+            constexpr state_type polynomial{0xD2A98B26625EEE7BU, 0xDDDF9B1090AA7AC1U};
+            details::random::jump(*this, state_, polynomial);
+        }
+
+        [[nodiscard]] constexpr const state_type& state() const noexcept
+        {
+            return state_;
+        }
+
+        constexpr bool operator==(const Xoroshiro128Plus&) const noexcept = default;
+
+        friend std::ostream& operator<<(std::ostream& os, const Xoroshiro128Plus& engine)
+        {
+            return details::random::write_state(os, engine.state_);
+        }
+
+        friend std::istream& operator>>(std::istream& is, Xoroshiro128Plus& engine)
+        {
+            return details::random::read_state(is, engine.state_);
+        }
+
+    private:
+        state_type state_{};
+    };
+
+    /**
+    * \brief xoshiro128++ 1.0 by David Blackman and Sebastiano Vigna. Only needs 32 bit arithmetic, which makes it cheap
+    * to run in SIMD lanes
+    */
+    class Xoshiro128PlusPlus
+    {
+    public:
+        using result_type = std::uint32_t;
+        using state_type = std::array<std::uint32_t, 4>;
+
+        static constexpr std::uint64_t default_seed = 0;
+
+        constexpr Xoshiro128PlusPlus() noexcept
+        {
+            seed();
+        }
+
+        constexpr explicit Xoshiro128PlusPlus(std::uint64_t seed) noexcept
+        {
+            this->seed(seed);
+        }
+
+        /**
+        * \brief Start from an explicit state, which must not be all zeros
+        */
+        constexpr explicit Xoshiro128PlusPlus(const state_type& state) noexcept : state_{state}
+        {
+            RAYCHEL_ASSERT(state != state_type{});
+        }
+
+        constexpr void seed(std::uint64_t seed = default_seed) noexcept
+        {
+            SplitMix64 seeder{seed};
+            for (std::size_t i{0}; i != state_.size(); i += 2) {
+                const auto word = seeder();
+                state_[i] = static_cast<std::uint32_t>(word);
+                state_[i + 1] = static_cast<std::uint32_t>(word >> 32U);
+            }
+        }
+
+        static constexpr result_type min() noexcept
+        {
+            return 0;
+        }
+
+        static constexpr result_type max() noexcept
+        {
+            return std::numeric_limits<result_type>::max();
+        }
+
+        constexpr result_type operator()() noexcept
+        {
+            auto& s = state_;
+            const std::uint32_t res = std::rotl(s[0] + s[3], 7) + s[0];
+            const std::uint32_t t = s[1] << 9U;
+
+            s[2] ^= s[0];
+            s[3] ^= s[1];
+            s[1] ^= s[2];
+            s[0] ^= s[3];
+            s[2] ^= t;
+            s[3] = std::rotl(s[3], 11);
+
+            return res;
+        }
+
+        constexpr void discard(unsigned long long z) noexcept
+        {
+            for (; z != 0; --z) {
+                (*this)();
+            }
+        }
+
+        /**
+        * \brief Advance by 2^64 steps, which gives 2^64 non-overlapping sequences
+        */
+        constexpr void jump() noexcept
+        {
+            constexpr state_type polynomial{0x8764000BU, 0xF542D2D3U, 0x6FA035C3U, 0x77F2DB5BU};
+            details::random::jump(*this, state_, polynomial);
+        }
+
+        /**
+        * \brief Advance by 2^96 steps, for 2^32 starting points which can each be split up with jump()
+        */
+        constexpr void long_jump() noexcept
+        {
+            constexpr state_type polynomial{0xB523952EU, 0x0B6F099FU, 0xCCF5A0EFU, 0x1C580662U};
+            details::random::jump(*this, state_, polynomial);
+        }
+
+        [[nodiscard]] constexpr const state_type& state() const noexcept
+        {
+            return state_;
+        }
+
+        constexpr bool operator==(const Xoshiro128PlusPlus&) const noexcept = default;
+
+        friend std::ostream& operator<<(std::ostream& os, const Xoshiro128PlusPlus& engine)
+        {
+            return details::random::write_state(os, engine.state_);
+        }
+
+        friend std::istream& operator>>(std::istream& is, Xoshiro128PlusPlus& engine)
+        {
+            return details::random::read_state(is, engine.state_);
+        }
+
+    private:
+        state_type state_{};
+    };
+
+    /**
+    * \brief Melissa O'Neill's pcg32 (XSH RR 64/32). Engines seeded with different streams produce independent sequences
+    */
+    class PCG32
+    {
+    public:
+        using result_type = std::uint32_t;
+
+        static constexpr std::uint64_t default_seed = 0x853C49E6748FEA9BU;
+        //the stream of the reference implementation's default increment 0xDA3E39CB94B95BDB
+        static constexpr std::uint64_t default_stream = 0x6D1F1CE5CA5CADEDU;
+
+        constexpr PCG32() noexcept
+        {
+            seed();
+        }
+
+        /**
+        * \brief Seed with the full 64 bits and select one of 2^63 streams. The top bit of stream is ignored
+        */
+        constexpr explicit PCG32(std::uint64_t seed, std::uint64_t stream = default_stream) noexcept
+        {
+            this->seed(seed, stream);
+        }
+
+        constexpr void seed(std::uint64_t seed = default_seed, std::uint64_t stream = default_stream) noexcept
+        {
+            state_ = 0;
+            increment_ = (stream << 1U) | 1U;
+            (*this)();
+            state_ += seed;
+            (*this)();
+        }
+
+        static constexpr result_type min() noexcept
+        {
+            return 0;
+        }
+
+        static constexpr result_type max() noexcept
+        {
+            return std::numeric_limits<result_type>::max();
+        }
+
+        constexpr result_type operator()() noexcept
+        {
+            const std::uint64_t old = state_;
+            state_ = (old * multiplier) + increment_;
+
+            const auto xorshifted = static_cast<std::uint32_t>(((old >> 18U) ^ old) >> 27U);
+            const auto rotation = static_cast<int>(old >> 59U);
+            return std::rotr(xorshifted, rotation);
+        }
+
+        /**
+        * \brief Advance by delta steps in O(log delta), using Brown's algorithm for skipping ahead in an LCG
+        */
+        constexpr void advance(std::uint64_t delta) noexcept
+        {
+            std::uint64_t current_multiplier = multiplier;
+            std::uint64_t current_increment = increment_;
+            std::uint64_t accumulated_multiplier = 1;
+            std::uint64_t accumulated_increment = 0;
+
+            for (; delta != 0; delta >>= 1U) {
+                if ((delta & 1U) != 0) {
+                    accumulated_multiplier *= current_multiplier;
+                    accumulated_increment = (accumulated_increment * current_multiplier) + current_increment;
+                }
+                current_increment *= current_multiplier + 1;
+                current_multiplier *= current_multiplier;
+            }
+            state_ = (accumulated_multiplier * state_) + accumulated_increment;
+        }
+
+        constexpr void discard(unsigned long long z) noexcept
+        {
+            advance(z);
+        }
+
+        constexpr bool operator==(const PCG32&) const noexcept = default;
+
+        friend std::ostream& operator<<(std::ostream& os, const PCG32& engine)
+        {
+            return details::random::write_state(os, std::array{engine.state_, engine.increment_});
+        }
+
+        friend std::istream& operator>>(std::istream& is, PCG32& engine)
+        {
+            std::array state{engine.state_, engine.increment_};
+            details::random::read_state(is, state);
+            engine.state_ = state[0];
+            engine.increment_ = state[1] | 1U;
+            return is;
+        }
+
+    private:
+        static constexpr std::uint64_t multiplier = 6364136223846793005U;
+
+        std::uint64_t state_{};
+        std::uint64_t increment_{};
+    };
+
+    namespace details::random {
+
+        //Engines whose outputs are uniformly distributed over [0, 2^k)
+        template <typename Engine>
+        concept FullRangeEngine = std::uniform_random_bit_generator<Engine> &&
+                                  (Engine::min() == 0) && (((Engine::max() + 1) & Engine::max()) == 0);
+
+        //Top bits of a 32 bit output as a number in [0, 1). Matches details::simd::Lanes<std::uint32_t, W>::to_unit_float
+        //for floats
+        template <std::floating_point T>
+        constexpr T uniform_from_bits(std::uint32_t bits) noexcept
+        {
+            constexpr int mantissa_bits = std::min(std::numeric_limits<T>::digits, 31);
+            constexpr T scale = T(.5) / static_cast<T>(std::uint32_t{1} << static_cast<std::uint32_t>(mantissa_bits - 1));
+            return static_cast<T>(static_cast<std::int32_t>(bits >> static_cast<std::uint32_t>(32 - mantissa_bits))) * scale;
+        }
+
+    } // namespace details::random
+
+    /**
+    * \brief Uniform number in [0, 1) from the top bits of a single engine output, without a division.
+    *
+    * The result uses as many bits as T has mantissa digits, or all engine bits if there are fewer. It is a multiple of
+    * 2^-bits and never 1, unlike std::generate_canonical with some standard libraries.
+    */
+    template <std::floating_point T, details::random::FullRangeEngine Engine>
+    constexpr T uniform_real(Engine& engine) noexcept(noexcept(engine()))
+    {
+        constexpr int engine_bits = std::bit_width(Engine::max());
+        constexpr int bits = std::min(std::numeric_limits<T>::digits, engine_bits);
+        constexpr T scale = T(.5) / static_cast<T>(std::uint64_t{1} << static_cast<std::uint32_t>(bits - 1));
+
+        return static_cast<T>(engine() >> static_cast<std::uint32_t>(engine_bits - bits)) * scale;
+    }
+
+    /**
+    * \brief Callable returning uniform_real<T>(engine), for the functions taking a const rng that returns numbers in
+    * [0, 1). The engine is referenced and must outlive the generator
+    */
+    template <std::floating_point T, details::random::FullRangeEngine Engine>
+    constexpr auto uniform_real_generator(Engine& engine) noexcept
+    {
+        return [&engine]() noexcept(noexcept(engine())) { return uniform_real<T>(engine); };
+    }
+
+} // namespace Raychel
+
+#endif //!RAYCHELMATH_RANDOM_H
@@ -0,0 +1,192 @@
+/**
+* \file rgba.h
+* \author Weckyy702 (weckyy702@gmail.com)
+* \brief Premultiplied RGBA colors and alpha compositing
+* \date 2026-10-16
+*
+* MIT License
+* Copyright (c) [2026] [Weckyy702 (weckyy702@gmail.com | https://github.com/Weckyy702)]
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+#ifndef RAYCHELMATH_RGBA_H
+#define RAYCHELMATH_RGBA_H
+
+#include "color.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <span>
+
+namespace Raychel {
+
+    /**
+    * \brief Tag for RGBA colors with premultiplied alpha
+    *
+    * The color channels are already multiplied by alpha, so compositing, filtering and accumulating are plain
+    * additions and scalings of all four lanes. A float RGBA color fills and is aligned to one 128 bit register.
+    */
+    struct RGBATag
+    {};
+
+    template <Arithmetic T>
+    struct RGBABase : public TupleBase<T, 4>
+    {
+        using Base = TupleBase<T, 4>;
+        using Base::Base, Base::data_, Base::get;
+
+        constexpr auto& r()
+        {
+            return data_[0];
+        }
+
+        [[nodiscard]] constexpr const auto& r() const
+        {
+            return data_[0];
+        }
+
+        constexpr auto& g()
+        {
+            return data_[1];
+        }
+
+        [[nodiscard]] constexpr const auto& g() const
+        {
+            return data_[1];
+        }
+
+        constexpr auto& b()
+        {
+            return data_[2];
+        }
+
+        [[nodiscard]] constexpr const auto& b() const
+        {
+            return data_[2];
+        }
+
+        constexpr auto& a()
+        {
+            return data_[3];
+        }
+
+        [[nodiscard]] constexpr const auto& a() const
+        {
+            return data_[3];
+        }
+    };
+
+    template <Arithmetic T>
+    struct TupleTraits<T, 4, RGBATag>
+    {
+        using Base = RGBABase<T>;
+    };
+
+    template <Arithmetic T>
+    using basic_rgba = Tuple<T, 4, RGBATag>;
+
+    /**
+    * \brief Premultiply a (straight) color with alpha
+    */
+    template <std::floating_point T>
+    constexpr basic_rgba<T> premultiply(const basic_color<T>& c, T alpha = 1) noexcept
+    {
+        return basic_rgba<T>{c.r() * alpha, c.g() * alpha, c.b() * alpha, alpha};
+    }
+
+    /**
+    * \brief Divide the color channels by alpha. Fully transparent colors become black
+    */
+    template <std::floating_point T>
+    constexpr basic_color<T> color_from_rgba(const basic_rgba<T>& c) noexcept
+    {
+        if (c.a() == T(0)) {
+            return basic_color<T>{};
+        }
+        const T inv_alpha = T(1) / c.a();
+        return basic_color<T>{c.r() * inv_alpha, c.g() * inv_alpha, c.b() * inv_alpha};
+    }
+
+    /**
+    * \brief Porter-Duff "over": src in front of dst
+    */
+    template <std::floating_point T>
+    constexpr basic_rgba<T> over(const basic_rgba<T>& src, const basic_rgba<T>& dst) noexcept
+    {
+        //One broadcast multiply and one add over all four lanes
+        return src + (dst * (T(1) - src.a()));
+    }
+
+    /**
+    * \brief Composite src in front of an opaque background
+    */
+    template <std::floating_point T>
+    constexpr basic_color<T> over(const basic_rgba<T>& src, const basic_color<T>& background) noexcept
+    {
+        const T coverage = T(1) - src.a();
+        return basic_color<T>{
+            src.r() + (background.r() * coverage), src.g() + (background.g() * coverage), src.b() + (background.b() * coverage)};
+    }
+
+    /**
+    * \brief Composite every color in src over the color at the same index in dst, in place. dst must hold at least
+    * src.size() colors
+    */
+    template <std::floating_point T>
+    void composite_over(std::span<const basic_rgba<T>> src, std::span<basic_rgba<T>> dst) noexcept
+    {
+        RAYCHEL_ASSERT(dst.size() >= src.size());
+        for (std::size_t i{0}; i != src.size(); ++i) {
+            dst[i] = over(src[i], dst[i]);
+        }
+    }
+
+    /**
+    * \brief Un-premultiply and quantize every color in src to interleaved 8 bit RGBA with straight alpha, the layout
+    * image formats expect. dst must hold at least 4 * src.size() bytes
+    */
+    template <std::floating_point T>
+        requires details::ColorChannel<T>
+    void pack_rgba8(std::span<const basic_rgba<T>> src, std::span<std::uint8_t> dst)
+    {
+        static_assert(sizeof(basic_rgba<T>) == 4 * sizeof(T));
+        RAYCHEL_ASSERT(dst.size() >= src.size() * 4);
+
+        //Un-premultiply blocks of colors, then quantize them with the flat kernels
+        constexpr std::size_t block_size = 64;
+        std::array<T, block_size * 4> straight{};
+
+        for (std::size_t begin{0}; begin < src.size(); begin += block_size) {
+            const auto count = std::min(block_size, src.size() - begin);
+            for (std::size_t i{0}; i != count; ++i) {
+                const auto& c = src[begin + i];
+                const auto rgb = color_from_rgba(c);
+                straight[(i * 4) + 0] = rgb.r();
+                straight[(i * 4) + 1] = rgb.g();
+                straight[(i * 4) + 2] = rgb.b();
+                straight[(i * 4) + 3] = c.a();
+            }
+            details::convert_channels(straight.data(), dst.data() + (begin * 4), count * 4);
+        }
+    }
+
+} // namespace Raychel
+
+#endif //!RAYCHELMATH_RGBA_H
@@ -0,0 +1,408 @@
+/**
+* \file sampling.h
+* \author Weckyy702 (weckyy702@gmail.com)
+* \brief Analytic mappings from the unit square to directions, with their PDFs
+* \date 2026-10-16
+*
+* MIT License
+* Copyright (c) [2026] [Weckyy702 (weckyy702@gmail.com | https://github.com/Weckyy702)]
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+#ifndef RAYCHELMATH_SAMPLING_H
+#define RAYCHELMATH_SAMPLING_H
+
+#include "UnitVector.h"
+#include "constants.h"
+#include "fastmath.h"
+#include "vec2.h"
+#include "vec3.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+/**
+* Every sampler maps a point u in [0, 1)^2 to a direction without rejection, so stratified or low discrepancy points
+* keep their structure. Local space uses +Y as the normal, like get_basis_vectors.
+*
+*   sampler                  | pdf (per unit area / solid angle)
+*   -------------------------+----------------------------------
+*   sample_concentric_disk   | 1 / pi
+*   sample_uniform_sphere    | 1 / (4 pi)
+*   sample_uniform_hemisphere| 1 / (2 pi)
+*   sample_cosine_hemisphere | cos(theta) / pi
+*   sample_uniform_cone      | 1 / (2 pi (1 - cos(theta_max)))
+*
+* Single samples use the math_* functions, so they follow the RAYCHELMATH_FASTMATH policy and are unit vectors up to
+* rounding when it is off. The batch overloads trade accuracy for vectorized loops: float (and double with AVX2) take
+* fast_sincos and fast_rsqrt there, so their results are unit vectors up to about 5e-7 for float and 3e-9 for double.
+*/
+
+namespace Raychel {
+
+    /**
+    * \brief Orthonormal basis around a normal, built once and reused for every sample around it
+    */
+    template <std::floating_point T>
+    struct SamplingFrame
+    {
+        constexpr explicit SamplingFrame(const basic_unit_vec3<T>& n) noexcept
+        {
+            const auto [i, j, k] = get_basis_vectors(n);
+            tangent = i;
+            normal = j;
+            bitangent = k;
+        }
+
+        constexpr explicit SamplingFrame(const basic_vec3<T>& n) noexcept : SamplingFrame{basic_unit_vec3<T>{n}}
+        {}
+
+        /**
+        * \brief Local space (+Y is the normal) to world space
+        */
+        [[nodiscard]] constexpr basic_vec3<T> to_world(const basic_vec3<T>& local) const noexcept
+        {
+            return (tangent * local[0]) + (normal * local[1]) + (bitangent * local[2]);
+        }
+
+        [[nodiscard]] constexpr basic_vec3<T> to_local(const basic_vec3<T>& world) const noexcept
+        {
+            return basic_vec3<T>{dot(world, tangent), dot(world, normal), dot(world, bitangent)};
+        }
+
+        basic_vec3<T> tangent;
+        basic_vec3<T> normal;
+        basic_vec3<T> bitangent;
+    };
+
+    namespace details::sampling {
+
+        //Branch free if_true / if_false. Float ternaries turn into control flow that keeps loops from vectorizing
+        template <std::floating_point T>
+        inline T select(bool condition, T if_true, T if_false) noexcept
+        {
+            if constexpr (fastmath::Supported<T>) {
+                return fastmath::select(fastmath::mask<T>(condition), if_true, if_false);
+            } else {
+                return condition ? if_true : if_false;
+            }
+        }
+
+        /*
+        * The samplers take Batch = true inside the batch loops. std::sqrt may set errno and std::sin/cos are library
+        * calls, both keep a loop from vectorizing, so there the sqrt goes through fast_rsqrt and sincos through
+        * fast_sincos. Single samples and loops that do not vectorize anyway keep the sqrt instruction, which is faster
+        * than the Newton steps in scalar code, and take sin/cos from math_sincos like the rest of the library.
+        */
+        template <typename T>
+        constexpr bool vectorized_batch = std::is_same_v<T, float>
+#if defined(RAYCHELMATH_SIMD_AVX2)
+                                          || std::is_same_v<T, double>
+#endif
+            ;
+
+        template <bool Batch, std::floating_point T>
+        inline T sqrt_non_negative(T x) noexcept
+        {
+            if constexpr (Batch && vectorized_batch<T>) {
+                //x <= 0 becomes sqrt(min), about 1e-19 for float
+                constexpr T min = std::numeric_limits<T>::min();
+                const T clamped = select(x > min, x, min);
+                return clamped * fast_rsqrt(clamped);
+            } else {
+                return std::sqrt(std::max(T(0), x));
+            }
+        }
+
+        template <bool Batch, std::floating_point T>
+        inline SinCos<T> sincos(T x) noexcept
+        {
+            if constexpr (Batch && vectorized_batch<T>) {
+                return fast_sincos(x);
+            } else {
+                return details::math_sincos(x);
+            }
+        }
+
+        template <bool Batch, std::floating_point T>
+        inline basic_vec2<T> concentric_disk(const basic_vec2<T>& u) noexcept
+        {
+            const T ox = (T(2) * u.x()) - T(1);
+            const T oy = (T(2) * u.y()) - T(1);
+
+            const bool x_major = std::abs(ox) > std::abs(oy);
+            const T r = select(x_major, ox, oy);
+            const T other = select(x_major, oy, ox);
+            const T t = quarter_pi<T> * (other / select(r == T(0), T(1), r));
+            const auto [s, c] = sincos<Batch>(select(x_major, t, half_pi<T> - t));
+
+            return basic_vec2<T>{r * c, r * s};
+        }
+
+    } // namespace details::sampling
+
+    /**
+    * \brief Map u to the unit disk, keeping strata compact (Shirley and Chiu, "A Low Distortion Map Between Disk and
+    * Square")
+    */
+    template <std::floating_point T>
+    inline basic_vec2<T> sample_concentric_disk(const basic_vec2<T>& u) noexcept
+    {
+        return details::sampling::concentric_disk<false>(u);
+    }
+
+    namespace details::sampling {
+
+        //Point on the circle of radius sin_theta at height cos_theta, phi = 2 pi u
+        template <bool Batch, std::floating_point T>
+        inline basic_vec3<T> on_circle(T cos_theta, T u) noexcept
+        {
+            const T sin_theta = sqrt_non_negative<Batch>(T(1) - (cos_theta * cos_theta));
+            const auto [s, c] = sincos<Batch>(u * (2 * pi_v<T>));
+            return basic_vec3<T>{sin_theta * c, cos_theta, sin_theta * s};
+        }
+
+        template <bool Batch, std::floating_point T>
+        inline basic_vec3<T> uniform_sphere(const basic_vec2<T>& u) noexcept
+        {
+            return on_circle<Batch>(T(1) - (T(2) * u.x()), u.y());
+        }
+
+        template <bool Batch, std::floating_point T>
+        inline basic_vec3<T> uniform_hemisphere(const basic_vec2<T>& u) noexcept
+        {
+            return on_circle<Batch>(T(1) - u.x(), u.y());
+        }
+
+        template <bool Batch, std::floating_point T>
+        inline basic_vec3<T> cosine_hemisphere(const basic_vec2<T>& u) noexcept
+        {
+            const auto d = concentric_disk<Batch>(u);
+            const T y = sqrt_non_negative<Batch>(T(1) - (d.x() * d.x()) - (d.y() * d.y()));
+            return basic_vec3<T>{d.x(), y, d.y()};
+        }
+
+        template <bool Batch, std::floating_point T>
+        inline basic_vec3<T> uniform_cone(const basic_vec2<T>& u, T cos_theta_max) noexcept
+        {
+            return on_circle<Batch>(T(1) - (u.x() * (T(1) - cos_theta_max)), u.y());
+        }
+
+    } // namespace details::sampling
+
+    template <std::floating_point T>
+    inline basic_vec3<T> sample_uniform_sphere(const basic_vec2<T>& u) noexcept
+    {
+        return details::sampling::uniform_sphere<false>(u);
+    }
+
+    /**
+    * \brief Uniform direction with local y in (0, 1]
+    */
+    template <std::floating_point T>
+    inline basic_vec3<T> sample_uniform_hemisphere(const basic_vec2<T>& u) noexcept
+    {
+        return details::sampling::uniform_hemisphere<false>(u);
+    }
+
+    /**
+    * \brief Direction with local y in [0, 1], distributed proportional to y. Projects the concentric disk onto the
+    * hemisphere (Malley's method)
+    */
+    template <std::floating_point T>
+    inline basic_vec3<T> sample_cosine_hemisphere(const basic_vec2<T>& u) noexcept
+    {
+        return details::sampling::cosine_hemisphere<false>(u);
+    }
+
+    /**
+    * \brief Uniform direction within the cone of directions whose local y is at least cos_theta_max
+    */
+    template <std::floating_point T>
+    inline basic_vec3<T> sample_uniform_cone(const basic_vec2<T>& u, T cos_theta_max) noexcept
+    {
+        return details::sampling::uniform_cone<false>(u, cos_theta_max);
+    }
+
+    //Samplers around the normal of a frame
+
+    template <std::floating_point T>
+    inline basic_vec3<T> sample_uniform_hemisphere(const SamplingFrame<T>& frame, const basic_vec2<T>& u) noexcept
+    {
+        return frame.to_world(sample_uniform_hemisphere(u));
+    }
+
+    template <std::floating_point T>
+    inline basic_vec3<T> sample_cosine_hemisphere(const SamplingFrame<T>& frame, const basic_vec2<T>& u) noexcept
+    {
+        return frame.to_world(sample_cosine_hemisphere(u));
+    }
+
+    template <std::floating_point T>
+    inline basic_vec3<T> sample_uniform_cone(const SamplingFrame<T>& frame, const basic_vec2<T>& u, T cos_theta_max) noexcept
+    {
+        return frame.to_world(sample_uniform_cone(u, cos_theta_max));
+    }
+
+    //PDFs of the samplers above. The ones taking a direction return 0 outside the sampled domain
+
+    template <std::floating_point T>
+    constexpr T concentric_disk_pdf() noexcept
+    {
+        return T(1) / pi_v<T>;
+    }
+
+    template <std::floating_point T>
+    constexpr T uniform_sphere_pdf() noexcept
+    {
+        return T(1) / (4 * pi_v<T>);
+    }
+
+    template <std::floating_point T>
+    constexpr T uniform_hemisphere_pdf() noexcept
+    {
+        return T(1) / (2 * pi_v<T>);
+    }
+
+    template <std::floating_point T>
+    constexpr T uniform_hemisphere_pdf(const SamplingFrame<T>& frame, const basic_vec3<T>& direction) noexcept
+    {
+        return dot(direction, frame.normal) >= T(0) ? uniform_hemisphere_pdf<T>() : T(0);
+    }
+
+    template <std::floating_point T>
+    constexpr T cosine_hemisphere_pdf(T cos_theta) noexcept
+    {
+        return std::max(T(0), cos_theta) / pi_v<T>;
+    }
+
+    template <std::floating_point T>
+    constexpr T cosine_hemisphere_pdf(const SamplingFrame<T>& frame, const basic_vec3<T>& direction) noexcept
+    {
+        return cosine_hemisphere_pdf(dot(direction, frame.normal));
+    }
+
+    /**
+    * \brief PDF of sample_uniform_cone. cos_theta_max must be less than 1
+    */
+    template <std::floating_point T>
+    constexpr T uniform_cone_pdf(T cos_theta_max) noexcept
+    {
+        return T(1) / (2 * pi_v<T> * (T(1) - cos_theta_max));
+    }
+
+    template <std::floating_point T>
+    constexpr T uniform_cone_pdf(const SamplingFrame<T>& frame, const basic_vec3<T>& direction, T cos_theta_max) noexcept
+    {
+        return dot(direction, frame.normal) >= cos_theta_max ? uniform_cone_pdf(cos_theta_max) : T(0);
+    }
+
+    namespace details::sampling {
+
+        //Sampling into separate coordinate arrays first lets the sincos and sqrt vectorize across the block
+        constexpr std::size_t block_size = 64;
+
+        //x, y and z of the local samples are scaled by the columns of axes
+        template <std::floating_point T, typename Sample>
+        void sample_blocks(
+            std::span<const basic_vec2<T>> u, std::span<basic_vec3<T>> out, const std::array<basic_vec3<T>, 3>& axes, Sample&& sample) noexcept
+        {
+            static_assert(sizeof(basic_vec3<T>) == 3 * sizeof(T));
+            RAYCHEL_ASSERT(out.size() >= u.size());
+            std::array<T, block_size> x{};
+            std::array<T, block_size> y{};
+            std::array<T, block_size> z{};
+
+            const auto [ax, ay, az] = axes;
+            T* dst = out.empty() ? nullptr : &out[0][0];
+            for (std::size_t begin{0}; begin < u.size(); begin += block_size) {
+                const auto count = std::min(block_size, u.size() - begin);
+                for (std::size_t i{0}; i != count; ++i) {
+                    const auto local = sample(u[begin + i]);
+                    x[i] = local[0];
+                    y[i] = local[1];
+                    z[i] = local[2];
+                }
+                for (std::size_t i{0}; i != count; ++i) {
+                    dst[((begin + i) * 3) + 0] = (ax[0] * x[i]) + (ay[0] * y[i]) + (az[0] * z[i]);
+                    dst[((begin + i) * 3) + 1] = (ax[1] * x[i]) + (ay[1] * y[i]) + (az[1] * z[i]);
+                    dst[((begin + i) * 3) + 2] = (ax[2] * x[i]) + (ay[2] * y[i]) + (az[2] * z[i]);
+                }
+            }
+        }
+
+        template <std::floating_point T>
+        constexpr std::array<basic_vec3<T>, 3> axes(const SamplingFrame<T>& frame) noexcept
+        {
+            return {frame.tangent, frame.normal, frame.bitangent};
+        }
+
+    } // namespace details::sampling
+
+    //Batch versions, out must hold at least u.size() elements. The frame is shared by every sample
+
+    template <std::floating_point T>
+    void sample_uniform_sphere(std::span<const basic_vec2<T>> u, std::span<basic_vec3<T>> out) noexcept
+    {
+        constexpr std::array<basic_vec3<T>, 3> identity{basic_vec3<T>{1, 0, 0}, basic_vec3<T>{0, 1, 0}, basic_vec3<T>{0, 0, 1}};
+        details::sampling::sample_blocks(u, out, identity, [](const basic_vec2<T>& p) { return details::sampling::uniform_sphere<true>(p); });
+    }
+
+    template <std::floating_point T>
+    void sample_uniform_hemisphere(const SamplingFrame<T>& frame, std::span<const basic_vec2<T>> u, std::span<basic_vec3<T>> out) noexcept
+    {
+        details::sampling::sample_blocks(
+            u, out, details::sampling::axes(frame), [](const basic_vec2<T>& p) { return details::sampling::uniform_hemisphere<true>(p); });
+    }
+
+    template <std::floating_point T>
+    void sample_cosine_hemisphere(const SamplingFrame<T>& frame, std::span<const basic_vec2<T>> u, std::span<basic_vec3<T>> out) noexcept
+    {
+        details::sampling::sample_blocks(
+            u, out, details::sampling::axes(frame), [](const basic_vec2<T>& p) { return details::sampling::cosine_hemisphere<true>(p); });
+    }
+
+    template <std::floating_point T>
+    void sample_uniform_cone(
+        const SamplingFrame<T>& frame, std::span<const basic_vec2<T>> u, T cos_theta_max, std::span<basic_vec3<T>> out) noexcept
+    {
+        details::sampling::sample_blocks(u, out, details::sampling::axes(frame), [cos_theta_max](const basic_vec2<T>& p) {
+            return details::sampling::uniform_cone<true>(p, cos_theta_max);
+        });
+    }
+
+    /**
+    * \brief cosine_hemisphere_pdf of every direction, pdfs must hold at least directions.size() elements
+    */
+    template <std::floating_point T>
+    void cosine_hemisphere_pdf(const SamplingFrame<T>& frame, std::span<const basic_vec3<T>> directions, std::span<T> pdfs) noexcept
+    {
+        RAYCHEL_ASSERT(pdfs.size() >= directions.size());
+        for (std::size_t i{0}; i != directions.size(); ++i) {
+            pdfs[i] = cosine_hemisphere_pdf(frame, directions[i]);
+        }
+    }
+
+} // namespace Raychel
+
+#endif //!RAYCHELMATH_SAMPLING_H
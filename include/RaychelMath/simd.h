@@ -0,0 +1,1367 @@
+/**
+* \file simd.h
+* \author Weckyy702 (weckyy702@gmail.com)
+* \brief Compile-time selected SIMD backend for small fixed-size arrays
+* \date 2026-10-16
+*
+* MIT License
+* Copyright (c) [2026] [Weckyy702 (weckyy702@gmail.com | https://github.com/Weckyy702)]
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+#ifndef RAYCHELMATH_SIMD_H
+#define RAYCHELMATH_SIMD_H
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+/*
+* Backend selection. One of the following may be defined (usually through the RAYCHELMATH_SIMD_BACKEND CMake option):
+*   RAYCHELMATH_SIMD_BACKEND_NONE: always use the scalar fallback
+*   RAYCHELMATH_SIMD_BACKEND_SSE2
+*   RAYCHELMATH_SIMD_BACKEND_AVX2
+*   RAYCHELMATH_SIMD_BACKEND_NEON
+* If none is defined, the best backend enabled by the compiler flags is used.
+*/
+
+// clang-format off
+#if defined(RAYCHELMATH_SIMD_BACKEND_NONE)
+    //scalar fallback only
+#elif defined(RAYCHELMATH_SIMD_BACKEND_AVX2)
+    #define RAYCHELMATH_SIMD_AVX2 1
+    #define RAYCHELMATH_SIMD_SSE2 1
+#elif defined(RAYCHELMATH_SIMD_BACKEND_SSE2)
+    #define RAYCHELMATH_SIMD_SSE2 1
+#elif defined(RAYCHELMATH_SIMD_BACKEND_NEON)
+    #define RAYCHELMATH_SIMD_NEON 1
+#elif defined(__AVX2__)
+    #define RAYCHELMATH_SIMD_AVX2 1
+    #define RAYCHELMATH_SIMD_SSE2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define RAYCHELMATH_SIMD_SSE2 1
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+    #define RAYCHELMATH_SIMD_NEON 1
+#endif
+
+#if defined(RAYCHELMATH_SIMD_AVX2) || defined(RAYCHELMATH_SIMD_SSE2)
+    #include <immintrin.h>
+#elif defined(RAYCHELMATH_SIMD_NEON)
+    #include <arm_neon.h>
+    #if defined(__aarch64__) || defined(_M_ARM64)
+        #define RAYCHELMATH_SIMD_NEON_F64 1
+    #endif
+#endif
+
+#if defined(_MSC_VER)
+    #define RAYCHELMATH_SIMD_INLINE __forceinline
+#else
+    #define RAYCHELMATH_SIMD_INLINE inline __attribute__((always_inline))
+#endif
+// clang-format on
+
+namespace Raychel::details::simd {
+
+    /**
+    * \brief Register abstraction for W lanes of T. The primary template (W == 1) is the scalar fallback
+    *
+    * Specializations provide load/store (unaligned), broadcast, add/sub/mul/div, sqrt, min/max, comparisons and all_equal.
+    * min(a, b) is a < b ? a : b (and max(a, b) is a > b ? a : b) in every lane like SSE minps, so a NaN in a yields b.
+    * The cmp_* functions set every bit of a lane where the comparison holds, NaN compares unequal to everything.
+    * The std::uint32_t specializations instead provide load/store, broadcast, add, bitwise or/xor, shifts by a constant
+    * and to_unit_float, which turns the top 24 bits of every lane into a float in [0, 1).
+    */
+    template <typename T, std::size_t W>
+    struct Lanes
+    {
+        static constexpr bool supported = false;
+    };
+
+    template <typename T>
+    struct Lanes<T, 1>
+    {
+        static constexpr bool supported = true;
+        using reg = T;
+
+        static RAYCHELMATH_SIMD_INLINE reg load(const T* p)
+        {
+            return *p;
+        }
+        static RAYCHELMATH_SIMD_INLINE void store(T* p, reg x)
+        {
+            *p = x;
+        }
+        static RAYCHELMATH_SIMD_INLINE reg broadcast(T x)
+        {
+            return x;
+        }
+        static RAYCHELMATH_SIMD_INLINE reg add(reg a, reg b)
+        {
+            return a + b;
+        }
+        static RAYCHELMATH_SIMD_INLINE reg sub(reg a, reg b)
+        {
+            return a - b;
+        }
+        static RAYCHELMATH_SIMD_INLINE reg mul(reg a, reg b)
+        {
+            return a * b;
+        }
+        static RAYCHELMATH_SIMD_INLINE reg div(reg a, reg b)
+        {
+            return a / b;
+        }
+        static RAYCHELMATH_SIMD_INLINE reg min(reg a, reg b)
+        {
+            return (a < b) ? a : b;
+        }
+        static RAYCHELMATH_SIMD_INLINE reg max(reg a, reg b)
+        {
+            return (a > b) ? a : b;
+        }
+        static RAYCHELMATH_SIMD_INLINE bool all_equal(reg a, reg b)
+        {
+            return a == b;
+        }
+        static RAYCHELMATH_SIMD_INLINE reg bit_or(reg a, reg b)
+        {
+            return a | b;
+        }
+        static RAYCHELMATH_SIMD_INLINE reg bit_xor(reg a, reg b)
+        {
+            return a ^ b;
+        }
+        template <int K>
+        static RAYCHELMATH_SIMD_INLINE reg shift_left(reg a)
+        {
+            return a << K;
+        }
+        template <int K>
+        static RAYCHELMATH_SIMD_INLINE reg shift_right(reg a)
+        {
+            return a >> K;
+        }
+        //int32 conversion is what the vector backends have
+        static RAYCHELMATH_SIMD_INLINE float to_unit_float(reg a)
+        {
+            return static_cast<float>(static_cast<std::int32_t>(a >> 8U)) * 0x1p-24F;
+        }
+    };
+
+#if defined(RAYCHELMATH_SIMD_SSE2)
+
+    template <>
+    struct Lanes<float, 4>
+    {
+        static constexpr bool supported = true;
+        using reg = __m128;
+
+        static RAYCHELMATH_SIMD_INLINE reg load(const float* p)
+        {
+            return _mm_loadu_ps(p);
+        }
+        static RAYCHELMATH_SIMD_INLINE void store(float* p, reg x)
+        {
+            _mm_storeu_ps(p, x);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg broadcast(float x)
+        {
+            return _mm_set1_ps(x);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg add(reg a, reg b)
+        {
+            return _mm_add_ps(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg sub(reg a, reg b)
+        {
+            return _mm_sub_ps(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg mul(reg a, reg b)
+        {
+            return _mm_mul_ps(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg div(reg a, reg b)
+        {
+            return _mm_div_ps(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg sqrt(reg a)
+        {
+            return _mm_sqrt_ps(a);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg min(reg a, reg b)
+        {
+            return _mm_min_ps(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg max(reg a, reg b)
+        {
+            return _mm_max_ps(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg cmp_eq(reg a, reg b)
+        {
+            return _mm_cmpeq_ps(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg cmp_neq(reg a, reg b)
+        {
+            return _mm_cmpneq_ps(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg cmp_lt(reg a, reg b)
+        {
+            return _mm_cmplt_ps(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg cmp_le(reg a, reg b)
+        {
+            return _mm_cmple_ps(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE bool all_equal(reg a, reg b)
+        {
+            return _mm_movemask_ps(_mm_cmpeq_ps(a, b)) == 0xF;
+        }
+    };
+
+    //two floats travel through the low half of an SSE register
+    template <>
+    struct Lanes<float, 2>
+    {
+        static constexpr bool supported = true;
+        using reg = __m128;
+
+        static RAYCHELMATH_SIMD_INLINE reg load(const float* p)
+        {
+            return _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(p))); //NOLINT: intended type punning
+        }
+        static RAYCHELMATH_SIMD_INLINE void store(float* p, reg x)
+        {
+            _mm_store_sd(reinterpret_cast<double*>(p), _mm_castps_pd(x)); //NOLINT: intended type punning
+        }
+        static RAYCHELMATH_SIMD_INLINE reg broadcast(float x)
+        {
+            return _mm_set1_ps(x);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg add(reg a, reg b)
+        {
+            return _mm_add_ps(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg sub(reg a, reg b)
+        {
+            return _mm_sub_ps(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg mul(reg a, reg b)
+        {
+            return _mm_mul_ps(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg div(reg a, reg b)
+        {
+            //only divide the lower lanes to avoid spurious FP exceptions from the unused upper ones
+            return _mm_div_ps(a, _mm_movelh_ps(b, _mm_set1_ps(1.F)));
+        }
+        static RAYCHELMATH_SIMD_INLINE reg sqrt(reg a)
+        {
+            return _mm_sqrt_ps(a);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg min(reg a, reg b)
+        {
+            return _mm_min_ps(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg max(reg a, reg b)
+        {
+            return _mm_max_ps(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg cmp_eq(reg a, reg b)
+        {
+            return _mm_cmpeq_ps(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg cmp_neq(reg a, reg b)
+        {
+            return _mm_cmpneq_ps(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg cmp_lt(reg a, reg b)
+        {
+            return _mm_cmplt_ps(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg cmp_le(reg a, reg b)
+        {
+            return _mm_cmple_ps(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE bool all_equal(reg a, reg b)
+        {
+            return (_mm_movemask_ps(_mm_cmpeq_ps(a, b)) & 0x3) == 0x3;
+        }
+    };
+
+    template <>
+    struct Lanes<double, 2>
+    {
+        static constexpr bool supported = true;
+        using reg = __m128d;
+
+        static RAYCHELMATH_SIMD_INLINE reg load(const double* p)
+        {
+            return _mm_loadu_pd(p);
+        }
+        static RAYCHELMATH_SIMD_INLINE void store(double* p, reg x)
+        {
+            _mm_storeu_pd(p, x);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg broadcast(double x)
+        {
+            return _mm_set1_pd(x);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg add(reg a, reg b)
+        {
+            return _mm_add_pd(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg sub(reg a, reg b)
+        {
+            return _mm_sub_pd(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg mul(reg a, reg b)
+        {
+            return _mm_mul_pd(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg div(reg a, reg b)
+        {
+            return _mm_div_pd(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg sqrt(reg a)
+        {
+            return _mm_sqrt_pd(a);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg min(reg a, reg b)
+        {
+            return _mm_min_pd(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg max(reg a, reg b)
+        {
+            return _mm_max_pd(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg cmp_eq(reg a, reg b)
+        {
+            return _mm_cmpeq_pd(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg cmp_neq(reg a, reg b)
+        {
+            return _mm_cmpneq_pd(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg cmp_lt(reg a, reg b)
+        {
+            return _mm_cmplt_pd(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg cmp_le(reg a, reg b)
+        {
+            return _mm_cmple_pd(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE bool all_equal(reg a, reg b)
+        {
+            return _mm_movemask_pd(_mm_cmpeq_pd(a, b)) == 0x3;
+        }
+    };
+
+    template <>
+    struct Lanes<std::uint32_t, 4>
+    {
+        static constexpr bool supported = true;
+        using reg = __m128i;
+
+        static RAYCHELMATH_SIMD_INLINE reg load(const std::uint32_t* p)
+        {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); //NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        }
+        static RAYCHELMATH_SIMD_INLINE void store(std::uint32_t* p, reg x)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(p), x); //NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        }
+        static RAYCHELMATH_SIMD_INLINE reg broadcast(std::uint32_t x)
+        {
+            return _mm_set1_epi32(static_cast<int>(x));
+        }
+        static RAYCHELMATH_SIMD_INLINE reg add(reg a, reg b)
+        {
+            return _mm_add_epi32(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg bit_or(reg a, reg b)
+        {
+            return _mm_or_si128(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg bit_xor(reg a, reg b)
+        {
+            return _mm_xor_si128(a, b);
+        }
+        template <int K>
+        static RAYCHELMATH_SIMD_INLINE reg shift_left(reg a)
+        {
+            return _mm_slli_epi32(a, K);
+        }
+        template <int K>
+        static RAYCHELMATH_SIMD_INLINE reg shift_right(reg a)
+        {
+            return _mm_srli_epi32(a, K);
+        }
+        static RAYCHELMATH_SIMD_INLINE __m128 to_unit_float(reg a)
+        {
+            return _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(a, 8)), _mm_set1_ps(0x1p-24F));
+        }
+    };
+
+#endif //RAYCHELMATH_SIMD_SSE2
+
+#if defined(RAYCHELMATH_SIMD_AVX2)
+
+    template <>
+    struct Lanes<float, 8>
+    {
+        static constexpr bool supported = true;
+        using reg = __m256;
+
+        static RAYCHELMATH_SIMD_INLINE reg load(const float* p)
+        {
+            return _mm256_loadu_ps(p);
+        }
+        static RAYCHELMATH_SIMD_INLINE void store(float* p, reg x)
+        {
+            _mm256_storeu_ps(p, x);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg broadcast(float x)
+        {
+            return _mm256_set1_ps(x);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg add(reg a, reg b)
+        {
+            return _mm256_add_ps(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg sub(reg a, reg b)
+        {
+            return _mm256_sub_ps(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg mul(reg a, reg b)
+        {
+            return _mm256_mul_ps(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg div(reg a, reg b)
+        {
+            return _mm256_div_ps(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg sqrt(reg a)
+        {
+            return _mm256_sqrt_ps(a);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg min(reg a, reg b)
+        {
+            return _mm256_min_ps(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg max(reg a, reg b)
+        {
+            return _mm256_max_ps(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg cmp_eq(reg a, reg b)
+        {
+            return _mm256_cmp_ps(a, b, _CMP_EQ_OQ);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg cmp_neq(reg a, reg b)
+        {
+            return _mm256_cmp_ps(a, b, _CMP_NEQ_UQ);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg cmp_lt(reg a, reg b)
+        {
+            return _mm256_cmp_ps(a, b, _CMP_LT_OQ);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg cmp_le(reg a, reg b)
+        {
+            return _mm256_cmp_ps(a, b, _CMP_LE_OQ);
+        }
+        static RAYCHELMATH_SIMD_INLINE bool all_equal(reg a, reg b)
+        {
+            return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)) == 0xFF;
+        }
+    };
+
+    template <>
+    struct Lanes<double, 4>
+    {
+        static constexpr bool supported = true;
+        using reg = __m256d;
+
+        static RAYCHELMATH_SIMD_INLINE reg load(const double* p)
+        {
+            return _mm256_loadu_pd(p);
+        }
+        static RAYCHELMATH_SIMD_INLINE void store(double* p, reg x)
+        {
+            _mm256_storeu_pd(p, x);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg broadcast(double x)
+        {
+            return _mm256_set1_pd(x);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg add(reg a, reg b)
+        {
+            return _mm256_add_pd(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg sub(reg a, reg b)
+        {
+            return _mm256_sub_pd(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg mul(reg a, reg b)
+        {
+            return _mm256_mul_pd(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg div(reg a, reg b)
+        {
+            return _mm256_div_pd(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg sqrt(reg a)
+        {
+            return _mm256_sqrt_pd(a);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg min(reg a, reg b)
+        {
+            return _mm256_min_pd(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg max(reg a, reg b)
+        {
+            return _mm256_max_pd(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg cmp_eq(reg a, reg b)
+        {
+            return _mm256_cmp_pd(a, b, _CMP_EQ_OQ);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg cmp_neq(reg a, reg b)
+        {
+            return _mm256_cmp_pd(a, b, _CMP_NEQ_UQ);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg cmp_lt(reg a, reg b)
+        {
+            return _mm256_cmp_pd(a, b, _CMP_LT_OQ);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg cmp_le(reg a, reg b)
+        {
+            return _mm256_cmp_pd(a, b, _CMP_LE_OQ);
+        }
+        static RAYCHELMATH_SIMD_INLINE bool all_equal(reg a, reg b)
+        {
+            return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ)) == 0xF;
+        }
+    };
+
+    template <>
+    struct Lanes<std::uint32_t, 8>
+    {
+        static constexpr bool supported = true;
+        using reg = __m256i;
+
+        static RAYCHELMATH_SIMD_INLINE reg load(const std::uint32_t* p)
+        {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); //NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        }
+        static RAYCHELMATH_SIMD_INLINE void store(std::uint32_t* p, reg x)
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), x); //NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        }
+        static RAYCHELMATH_SIMD_INLINE reg broadcast(std::uint32_t x)
+        {
+            return _mm256_set1_epi32(static_cast<int>(x));
+        }
+        static RAYCHELMATH_SIMD_INLINE reg add(reg a, reg b)
+        {
+            return _mm256_add_epi32(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg bit_or(reg a, reg b)
+        {
+            return _mm256_or_si256(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg bit_xor(reg a, reg b)
+        {
+            return _mm256_xor_si256(a, b);
+        }
+        template <int K>
+        static RAYCHELMATH_SIMD_INLINE reg shift_left(reg a)
+        {
+            return _mm256_slli_epi32(a, K);
+        }
+        template <int K>
+        static RAYCHELMATH_SIMD_INLINE reg shift_right(reg a)
+        {
+            return _mm256_srli_epi32(a, K);
+        }
+        static RAYCHELMATH_SIMD_INLINE __m256 to_unit_float(reg a)
+        {
+            return _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(a, 8)), _mm256_set1_ps(0x1p-24F));
+        }
+    };
+
+#endif //RAYCHELMATH_SIMD_AVX2
+
+#if defined(RAYCHELMATH_SIMD_NEON)
+
+    template <>
+    struct Lanes<float, 4>
+    {
+        static constexpr bool supported = true;
+        using reg = float32x4_t;
+
+        static RAYCHELMATH_SIMD_INLINE reg load(const float* p)
+        {
+            return vld1q_f32(p);
+        }
+        static RAYCHELMATH_SIMD_INLINE void store(float* p, reg x)
+        {
+            vst1q_f32(p, x);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg broadcast(float x)
+        {
+            return vdupq_n_f32(x);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg add(reg a, reg b)
+        {
+            return vaddq_f32(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg sub(reg a, reg b)
+        {
+            return vsubq_f32(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg mul(reg a, reg b)
+        {
+            return vmulq_f32(a, b);
+        }
+    #if defined(RAYCHELMATH_SIMD_NEON_F64)
+        static RAYCHELMATH_SIMD_INLINE reg div(reg a, reg b)
+        {
+            return vdivq_f32(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg sqrt(reg a)
+        {
+            return vsqrtq_f32(a);
+        }
+    #else
+        static RAYCHELMATH_SIMD_INLINE reg div(reg a, reg b)
+        {
+            //ARMv7 NEON has no vector division
+            alignas(16) float x[4];
+            alignas(16) float y[4];
+            vst1q_f32(x, a);
+            vst1q_f32(y, b);
+            for (std::size_t i{0}; i != 4; ++i) {
+                x[i] /= y[i];
+            }
+            return vld1q_f32(x);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg sqrt(reg a)
+        {
+            alignas(16) float x[4];
+            vst1q_f32(x, a);
+            for (auto& v : x) {
+                v = std::sqrt(v);
+            }
+            return vld1q_f32(x);
+        }
+    #endif
+        static RAYCHELMATH_SIMD_INLINE reg min(reg a, reg b)
+        {
+            return vbslq_f32(vcltq_f32(a, b), a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg max(reg a, reg b)
+        {
+            return vbslq_f32(vcgtq_f32(a, b), a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg cmp_eq(reg a, reg b)
+        {
+            return vreinterpretq_f32_u32(vceqq_f32(a, b));
+        }
+        static RAYCHELMATH_SIMD_INLINE reg cmp_neq(reg a, reg b)
+        {
+            return vreinterpretq_f32_u32(vmvnq_u32(vceqq_f32(a, b)));
+        }
+        static RAYCHELMATH_SIMD_INLINE reg cmp_lt(reg a, reg b)
+        {
+            return vreinterpretq_f32_u32(vcltq_f32(a, b));
+        }
+        static RAYCHELMATH_SIMD_INLINE reg cmp_le(reg a, reg b)
+        {
+            return vreinterpretq_f32_u32(vcleq_f32(a, b));
+        }
+        static RAYCHELMATH_SIMD_INLINE bool all_equal(reg a, reg b)
+        {
+            const uint32x4_t eq = vceqq_f32(a, b);
+            const uint32x2_t folded = vand_u32(vget_low_u32(eq), vget_high_u32(eq));
+            return (vget_lane_u32(folded, 0) & vget_lane_u32(folded, 1)) == 0xFFFFFFFFU;
+        }
+    };
+
+    template <>
+    struct Lanes<float, 2>
+    {
+        static constexpr bool supported = true;
+        using reg = float32x2_t;
+
+        static RAYCHELMATH_SIMD_INLINE reg load(const float* p)
+        {
+            return vld1_f32(p);
+        }
+        static RAYCHELMATH_SIMD_INLINE void store(float* p, reg x)
+        {
+            vst1_f32(p, x);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg broadcast(float x)
+        {
+            return vdup_n_f32(x);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg add(reg a, reg b)
+        {
+            return vadd_f32(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg sub(reg a, reg b)
+        {
+            return vsub_f32(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg mul(reg a, reg b)
+        {
+            return vmul_f32(a, b);
+        }
+    #if defined(RAYCHELMATH_SIMD_NEON_F64)
+        static RAYCHELMATH_SIMD_INLINE reg div(reg a, reg b)
+        {
+            return vdiv_f32(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg sqrt(reg a)
+        {
+            return vsqrt_f32(a);
+        }
+    #else
+        static RAYCHELMATH_SIMD_INLINE reg div(reg a, reg b)
+        {
+            return vset_lane_f32(
+                vget_lane_f32(a, 1) / vget_lane_f32(b, 1), vdup_n_f32(vget_lane_f32(a, 0) / vget_lane_f32(b, 0)), 1);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg sqrt(reg a)
+        {
+            return vset_lane_f32(std::sqrt(vget_lane_f32(a, 1)), vdup_n_f32(std::sqrt(vget_lane_f32(a, 0))), 1);
+        }
+    #endif
+        static RAYCHELMATH_SIMD_INLINE reg min(reg a, reg b)
+        {
+            return vbsl_f32(vclt_f32(a, b), a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg max(reg a, reg b)
+        {
+            return vbsl_f32(vcgt_f32(a, b), a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg cmp_eq(reg a, reg b)
+        {
+            return vreinterpret_f32_u32(vceq_f32(a, b));
+        }
+        static RAYCHELMATH_SIMD_INLINE reg cmp_neq(reg a, reg b)
+        {
+            return vreinterpret_f32_u32(vmvn_u32(vceq_f32(a, b)));
+        }
+        static RAYCHELMATH_SIMD_INLINE reg cmp_lt(reg a, reg b)
+        {
+            return vreinterpret_f32_u32(vclt_f32(a, b));
+        }
+        static RAYCHELMATH_SIMD_INLINE reg cmp_le(reg a, reg b)
+        {
+            return vreinterpret_f32_u32(vcle_f32(a, b));
+        }
+        static RAYCHELMATH_SIMD_INLINE bool all_equal(reg a, reg b)
+        {
+            const uint32x2_t eq = vceq_f32(a, b);
+            return (vget_lane_u32(eq, 0) & vget_lane_u32(eq, 1)) == 0xFFFFFFFFU;
+        }
+    };
+
+    #if defined(RAYCHELMATH_SIMD_NEON_F64)
+    template <>
+    struct Lanes<double, 2>
+    {
+        static constexpr bool supported = true;
+        using reg = float64x2_t;
+
+        static RAYCHELMATH_SIMD_INLINE reg load(const double* p)
+        {
+            return vld1q_f64(p);
+        }
+        static RAYCHELMATH_SIMD_INLINE void store(double* p, reg x)
+        {
+            vst1q_f64(p, x);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg broadcast(double x)
+        {
+            return vdupq_n_f64(x);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg add(reg a, reg b)
+        {
+            return vaddq_f64(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg sub(reg a, reg b)
+        {
+            return vsubq_f64(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg mul(reg a, reg b)
+        {
+            return vmulq_f64(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg div(reg a, reg b)
+        {
+            return vdivq_f64(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg sqrt(reg a)
+        {
+            return vsqrtq_f64(a);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg min(reg a, reg b)
+        {
+            return vbslq_f64(vcltq_f64(a, b), a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg max(reg a, reg b)
+        {
+            return vbslq_f64(vcgtq_f64(a, b), a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg cmp_eq(reg a, reg b)
+        {
+            return vreinterpretq_f64_u64(vceqq_f64(a, b));
+        }
+        static RAYCHELMATH_SIMD_INLINE reg cmp_neq(reg a, reg b)
+        {
+            return vreinterpretq_f64_u32(vmvnq_u32(vreinterpretq_u32_u64(vceqq_f64(a, b))));
+        }
+        static RAYCHELMATH_SIMD_INLINE reg cmp_lt(reg a, reg b)
+        {
+            return vreinterpretq_f64_u64(vcltq_f64(a, b));
+        }
+        static RAYCHELMATH_SIMD_INLINE reg cmp_le(reg a, reg b)
+        {
+            return vreinterpretq_f64_u64(vcleq_f64(a, b));
+        }
+        static RAYCHELMATH_SIMD_INLINE bool all_equal(reg a, reg b)
+        {
+            const uint64x2_t eq = vceqq_f64(a, b);
+            return (vgetq_lane_u64(eq, 0) & vgetq_lane_u64(eq, 1)) == ~std::uint64_t{0};
+        }
+    };
+    #endif
+
+    template <>
+    struct Lanes<std::uint32_t, 4>
+    {
+        static constexpr bool supported = true;
+        using reg = uint32x4_t;
+
+        static RAYCHELMATH_SIMD_INLINE reg load(const std::uint32_t* p)
+        {
+            return vld1q_u32(p);
+        }
+        static RAYCHELMATH_SIMD_INLINE void store(std::uint32_t* p, reg x)
+        {
+            vst1q_u32(p, x);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg broadcast(std::uint32_t x)
+        {
+            return vdupq_n_u32(x);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg add(reg a, reg b)
+        {
+            return vaddq_u32(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg bit_or(reg a, reg b)
+        {
+            return vorrq_u32(a, b);
+        }
+        static RAYCHELMATH_SIMD_INLINE reg bit_xor(reg a, reg b)
+        {
+            return veorq_u32(a, b);
+        }
+        template <int K>
+        static RAYCHELMATH_SIMD_INLINE reg shift_left(reg a)
+        {
+            return vshlq_n_u32(a, K);
+        }
+        template <int K>
+        static RAYCHELMATH_SIMD_INLINE reg shift_right(reg a)
+        {
+            return vshrq_n_u32(a, K);
+        }
+        static RAYCHELMATH_SIMD_INLINE float32x4_t to_unit_float(reg a)
+        {
+            return vmulq_n_f32(vcvtq_f32_u32(vshrq_n_u32(a, 8)), 0x1p-24F);
+        }
+    };
+
+#endif //RAYCHELMATH_SIMD_NEON
+
+    //Is there any vector backend at all?
+    constexpr bool enabled =
+#if defined(RAYCHELMATH_SIMD_SSE2) || defined(RAYCHELMATH_SIMD_NEON)
+        true;
+#else
+        false;
+#endif
+
+    //Widest supported register width that does not exceed Remaining
+    template <typename T, std::size_t Remaining>
+    constexpr std::size_t widest_lanes()
+    {
+        if constexpr (Remaining >= 8 && Lanes<T, 8>::supported) {
+            return 8;
+        } else if constexpr (Remaining >= 4 && Lanes<T, 4>::supported) {
+            return 4;
+        } else if constexpr (Remaining >= 2 && Lanes<T, 2>::supported) {
+            return 2;
+        } else {
+            return 1;
+        }
+    }
+
+    /**
+    * \brief true if operations on N consecutive Ts are lowered to vector instructions
+    */
+    template <typename T, std::size_t N>
+    constexpr bool accelerated =
+        enabled && (std::is_same_v<T, float> || std::is_same_v<T, double>) && (widest_lanes<T, N>() > 1);
+
+    //The kernels below split N into the widest available registers (e.g. 3 floats -> 2 + 1 on SSE)
+
+    template <typename T, std::size_t N, std::size_t Offset = 0>
+    RAYCHELMATH_SIMD_INLINE void add(T* a, const T* b)
+    {
+        if constexpr (Offset < N) {
+            using L = Lanes<T, widest_lanes<T, N - Offset>()>;
+            L::store(a + Offset, L::add(L::load(a + Offset), L::load(b + Offset)));
+            add<T, N, Offset + widest_lanes<T, N - Offset>()>(a, b);
+        }
+    }
+
+    template <typename T, std::size_t N, std::size_t Offset = 0>
+    RAYCHELMATH_SIMD_INLINE void sub(T* a, const T* b)
+    {
+        if constexpr (Offset < N) {
+            using L = Lanes<T, widest_lanes<T, N - Offset>()>;
+            L::store(a + Offset, L::sub(L::load(a + Offset), L::load(b + Offset)));
+            sub<T, N, Offset + widest_lanes<T, N - Offset>()>(a, b);
+        }
+    }
+
+    template <typename T, std::size_t N, std::size_t Offset = 0>
+    RAYCHELMATH_SIMD_INLINE void mul(T* a, const T* b)
+    {
+        if constexpr (Offset < N) {
+            using L = Lanes<T, widest_lanes<T, N - Offset>()>;
+            L::store(a + Offset, L::mul(L::load(a + Offset), L::load(b + Offset)));
+            mul<T, N, Offset + widest_lanes<T, N - Offset>()>(a, b);
+        }
+    }
+
+    template <typename T, std::size_t N, std::size_t Offset = 0>
+    RAYCHELMATH_SIMD_INLINE void div(T* a, const T* b)
+    {
+        if constexpr (Offset < N) {
+            using L = Lanes<T, widest_lanes<T, N - Offset>()>;
+            L::store(a + Offset, L::div(L::load(a + Offset), L::load(b + Offset)));
+            div<T, N, Offset + widest_lanes<T, N - Offset>()>(a, b);
+        }
+    }
+
+    template <typename T, std::size_t N, std::size_t Offset = 0>
+    RAYCHELMATH_SIMD_INLINE void min(T* a, const T* b)
+    {
+        if constexpr (Offset < N) {
+            using L = Lanes<T, widest_lanes<T, N - Offset>()>;
+            L::store(a + Offset, L::min(L::load(a + Offset), L::load(b + Offset)));
+            min<T, N, Offset + widest_lanes<T, N - Offset>()>(a, b);
+        }
+    }
+
+    template <typename T, std::size_t N, std::size_t Offset = 0>
+    RAYCHELMATH_SIMD_INLINE void max(T* a, const T* b)
+    {
+        if constexpr (Offset < N) {
+            using L = Lanes<T, widest_lanes<T, N - Offset>()>;
+            L::store(a + Offset, L::max(L::load(a + Offset), L::load(b + Offset)));
+            max<T, N, Offset + widest_lanes<T, N - Offset>()>(a, b);
+        }
+    }
+
+    template <typename T, std::size_t N, std::size_t Offset = 0>
+    RAYCHELMATH_SIMD_INLINE void mul_scalar(T* a, T s)
+    {
+        if constexpr (Offset < N) {
+            using L = Lanes<T, widest_lanes<T, N - Offset>()>;
+            L::store(a + Offset, L::mul(L::load(a + Offset), L::broadcast(s)));
+            mul_scalar<T, N, Offset + widest_lanes<T, N - Offset>()>(a, s);
+        }
+    }
+
+    template <typename T, std::size_t N, std::size_t Offset = 0>
+    RAYCHELMATH_SIMD_INLINE void div_scalar(T* a, T s)
+    {
+        if constexpr (Offset < N) {
+            using L = Lanes<T, widest_lanes<T, N - Offset>()>;
+            L::store(a + Offset, L::div(L::load(a + Offset), L::broadcast(s)));
+            div_scalar<T, N, Offset + widest_lanes<T, N - Offset>()>(a, s);
+        }
+    }
+
+    template <typename T, std::size_t N, std::size_t Offset = 0>
+    RAYCHELMATH_SIMD_INLINE void sqrt(T* a)
+    {
+        if constexpr (Offset < N) {
+            constexpr auto W = widest_lanes<T, N - Offset>();
+            using L = Lanes<T, W>;
+            if constexpr (W == 1) {
+                a[Offset] = std::sqrt(a[Offset]);
+            } else {
+                L::store(a + Offset, L::sqrt(L::load(a + Offset)));
+            }
+            sqrt<T, N, Offset + W>(a);
+        }
+    }
+
+    enum class Comparison { equal, not_equal, less, less_equal };
+
+    /**
+    * \brief Lane-wise a <C> b, out receives the bits of a lane mask (all ones where the comparison holds) in each T
+    */
+    template <Comparison C, typename T, std::size_t N, std::size_t Offset = 0>
+    RAYCHELMATH_SIMD_INLINE void compare(T* out, const T* a, const T* b)
+    {
+        if constexpr (Offset < N) {
+            constexpr auto W = widest_lanes<T, N - Offset>();
+            using L = Lanes<T, W>;
+            if constexpr (W == 1) {
+                using Bits = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+                bool result{};
+                if constexpr (C == Comparison::equal) {
+                    result = a[Offset] == b[Offset];
+                } else if constexpr (C == Comparison::not_equal) {
+                    result = a[Offset] != b[Offset];
+                } else if constexpr (C == Comparison::less) {
+                    result = a[Offset] < b[Offset];
+                } else {
+                    result = a[Offset] <= b[Offset];
+                }
+                out[Offset] = std::bit_cast<T>(result ? ~Bits{0} : Bits{0});
+            } else {
+                const auto x = L::load(a + Offset);
+                const auto y = L::load(b + Offset);
+                if constexpr (C == Comparison::equal) {
+                    L::store(out + Offset, L::cmp_eq(x, y));
+                } else if constexpr (C == Comparison::not_equal) {
+                    L::store(out + Offset, L::cmp_neq(x, y));
+                } else if constexpr (C == Comparison::less) {
+                    L::store(out + Offset, L::cmp_lt(x, y));
+                } else {
+                    L::store(out + Offset, L::cmp_le(x, y));
+                }
+            }
+            compare<C, T, N, Offset + W>(out, a, b);
+        }
+    }
+
+    template <typename T, std::size_t N, std::size_t Offset = 0>
+    RAYCHELMATH_SIMD_INLINE bool equal(const T* a, const T* b)
+    {
+        if constexpr (Offset < N) {
+            using L = Lanes<T, widest_lanes<T, N - Offset>()>;
+            return L::all_equal(L::load(a + Offset), L::load(b + Offset)) &&
+                   equal<T, N, Offset + widest_lanes<T, N - Offset>()>(a, b);
+        } else {
+            return true;
+        }
+    }
+
+    //Kernels for 3 component vectors padded to 4 lanes (see vec3a.h). The padding lane must be 0
+
+    template <typename T>
+    RAYCHELMATH_SIMD_INLINE T dot3_padded(const T* a, const T* b)
+    {
+        return (a[0] * b[0]) + (a[1] * b[1]) + (a[2] * b[2]);
+    }
+
+    template <typename T>
+    RAYCHELMATH_SIMD_INLINE void cross3_padded(T* out, const T* a, const T* b)
+    {
+        const T x = (a[1] * b[2]) - (a[2] * b[1]);
+        const T y = (a[2] * b[0]) - (a[0] * b[2]);
+        const T z = (a[0] * b[1]) - (a[1] * b[0]);
+        out[0] = x;
+        out[1] = y;
+        out[2] = z;
+        out[3] = T{};
+    }
+
+#if defined(RAYCHELMATH_SIMD_SSE2)
+    //Clears the padding lane, which may hold NaN after element-wise arithmetic such as v * inf
+    RAYCHELMATH_SIMD_INLINE __m128 mask_padding(__m128 v)
+    {
+        return _mm_and_ps(v, _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1)));
+    }
+
+    RAYCHELMATH_SIMD_INLINE float dot3_padded(const float* a, const float* b)
+    {
+        const __m128 m = mask_padding(_mm_mul_ps(_mm_load_ps(a), _mm_load_ps(b)));
+        const __m128 swapped = _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1));
+        const __m128 pairs = _mm_add_ps(m, swapped);
+        return _mm_cvtss_f32(_mm_add_ss(pairs, _mm_movehl_ps(swapped, pairs)));
+    }
+
+    RAYCHELMATH_SIMD_INLINE void cross3_padded(float* out, const float* a, const float* b)
+    {
+        const __m128 va = _mm_load_ps(a);
+        const __m128 vb = _mm_load_ps(b);
+        //a * b.yzx - a.yzx * b is the cross product in zxy order
+        const __m128 a_yzx = _mm_shuffle_ps(va, va, _MM_SHUFFLE(3, 0, 2, 1));
+        const __m128 b_yzx = _mm_shuffle_ps(vb, vb, _MM_SHUFFLE(3, 0, 2, 1));
+        const __m128 c = _mm_sub_ps(_mm_mul_ps(va, b_yzx), _mm_mul_ps(a_yzx, vb));
+        _mm_store_ps(out, mask_padding(_mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1))));
+    }
+#endif
+
+#if defined(RAYCHELMATH_SIMD_AVX2)
+    //Clears the padding lane, which may hold NaN after element-wise arithmetic such as v * inf
+    RAYCHELMATH_SIMD_INLINE __m256d mask_padding(__m256d v)
+    {
+        return _mm256_blend_pd(v, _mm256_setzero_pd(), 0b1000);
+    }
+
+    RAYCHELMATH_SIMD_INLINE double dot3_padded(const double* a, const double* b)
+    {
+        const __m256d m = mask_padding(_mm256_mul_pd(_mm256_load_pd(a), _mm256_load_pd(b)));
+        const __m128d halves = _mm_add_pd(_mm256_castpd256_pd128(m), _mm256_extractf128_pd(m, 1));
+        return _mm_cvtsd_f64(_mm_add_sd(halves, _mm_unpackhi_pd(halves, halves)));
+    }
+
+    RAYCHELMATH_SIMD_INLINE void cross3_padded(double* out, const double* a, const double* b)
+    {
+        const __m256d va = _mm256_load_pd(a);
+        const __m256d vb = _mm256_load_pd(b);
+        const __m256d a_yzx = _mm256_permute4x64_pd(va, _MM_SHUFFLE(3, 0, 2, 1));
+        const __m256d b_yzx = _mm256_permute4x64_pd(vb, _MM_SHUFFLE(3, 0, 2, 1));
+        const __m256d c = _mm256_sub_pd(_mm256_mul_pd(va, b_yzx), _mm256_mul_pd(a_yzx, vb));
+        _mm256_store_pd(out, mask_padding(_mm256_permute4x64_pd(c, _MM_SHUFFLE(3, 0, 2, 1))));
+    }
+#endif
+
+#if defined(RAYCHELMATH_SIMD_NEON_F64)
+    RAYCHELMATH_SIMD_INLINE float dot3_padded(const float* a, const float* b)
+    {
+        //clear the padding lane, which may hold NaN after element-wise arithmetic such as v * inf
+        return vaddvq_f32(vsetq_lane_f32(0.F, vmulq_f32(vld1q_f32(a), vld1q_f32(b)), 3));
+    }
+#endif
+
+    /*
+    * Kernels for color channels stored as flat arrays. quantize stores round(clamp(x, 0, 1) * max(U)) with NaN mapped
+    * to 0, dequantize stores x / max(U) and rescale converts between integer channel depths with exact rounding.
+    * The SSE2 paths handle 16 (8 for uint16_t) channels per iteration and produce the same results as the scalar tail.
+    */
+
+    template <typename T, typename U>
+    RAYCHELMATH_SIMD_INLINE U quantize_one(T x)
+    {
+        constexpr auto max = static_cast<T>(std::numeric_limits<U>::max());
+        //the argument order makes NaN compare false and become 0
+        const T clamped = std::min(T(1), std::max(T(0), x));
+        return static_cast<U>((clamped * max) + T(0.5));
+    }
+
+    template <typename U, typename T>
+    RAYCHELMATH_SIMD_INLINE T dequantize_one(U x)
+    {
+        return static_cast<T>(x) / static_cast<T>(std::numeric_limits<U>::max());
+    }
+
+    template <typename From, typename To>
+    RAYCHELMATH_SIMD_INLINE To rescale_one(From x)
+    {
+        //x * to_max must not overflow, which 32 bits guarantee for up to 16 bit channels
+        using Wide = std::conditional_t<(sizeof(From) + sizeof(To) <= 4), std::uint32_t, std::uint64_t>;
+        constexpr auto from_max = static_cast<Wide>(std::numeric_limits<From>::max());
+        constexpr auto to_max = static_cast<Wide>(std::numeric_limits<To>::max());
+        return static_cast<To>(((static_cast<Wide>(x) * to_max) + (from_max / 2)) / from_max);
+    }
+
+#if defined(RAYCHELMATH_SIMD_SSE2)
+    //clamp(x, 0, 1) * scale + 0.5, truncated. _mm_max_ps returns its second operand for NaN, so NaN becomes 0
+    RAYCHELMATH_SIMD_INLINE __m128i quantize_sse2(const float* p, __m128 scale)
+    {
+        const __m128 x = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(p), _mm_setzero_ps()), _mm_set1_ps(1.0F));
+        return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(x, scale), _mm_set1_ps(0.5F)));
+    }
+
+    //Same for four doubles, the results end up in the four 32 bit lanes
+    RAYCHELMATH_SIMD_INLINE __m128i quantize_sse2(const double* p, __m128d scale)
+    {
+        const __m128d zero = _mm_setzero_pd();
+        const __m128d one = _mm_set1_pd(1.0);
+        const __m128d half = _mm_set1_pd(0.5);
+        const __m128d lo = _mm_min_pd(_mm_max_pd(_mm_loadu_pd(p), zero), one);
+        const __m128d hi = _mm_min_pd(_mm_max_pd(_mm_loadu_pd(p + 2), zero), one);
+        return _mm_unpacklo_epi64(
+            _mm_cvttpd_epi32(_mm_add_pd(_mm_mul_pd(lo, scale), half)), _mm_cvttpd_epi32(_mm_add_pd(_mm_mul_pd(hi, scale), half)));
+    }
+
+    template <typename T>
+    RAYCHELMATH_SIMD_INLINE void quantize16_sse2(const T* in, std::uint8_t* out)
+    {
+        const auto scale = Lanes<T, 16 / sizeof(T)>::broadcast(T(255));
+        const __m128i lo = _mm_packs_epi32(quantize_sse2(in, scale), quantize_sse2(in + 4, scale));
+        const __m128i hi = _mm_packs_epi32(quantize_sse2(in + 8, scale), quantize_sse2(in + 12, scale));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(lo, hi)); //NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+
+    template <typename T>
+    RAYCHELMATH_SIMD_INLINE void quantize8_sse2(const T* in, std::uint16_t* out)
+    {
+        //SSE2 only has a signed 32 -> 16 bit pack, so shift the values into the signed range and flip the sign bit back
+        const auto scale = Lanes<T, 16 / sizeof(T)>::broadcast(T(65535));
+        const __m128i bias = _mm_set1_epi32(32768);
+        const __m128i a = _mm_sub_epi32(quantize_sse2(in, scale), bias);
+        const __m128i b = _mm_sub_epi32(quantize_sse2(in + 4, scale), bias);
+        const __m128i packed = _mm_xor_si128(_mm_packs_epi32(a, b), _mm_set1_epi16(static_cast<short>(0x8000)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), packed); //NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+
+    RAYCHELMATH_SIMD_INLINE void dequantize16_sse2(const std::uint8_t* in, float* out)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128 max = _mm_set1_ps(255.0F);
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in)); //NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        const __m128i lo = _mm_unpacklo_epi8(bytes, zero);
+        const __m128i hi = _mm_unpackhi_epi8(bytes, zero);
+        _mm_storeu_ps(out, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), max));
+        _mm_storeu_ps(out + 4, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), max));
+        _mm_storeu_ps(out + 8, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), max));
+        _mm_storeu_ps(out + 12, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), max));
+    }
+
+    RAYCHELMATH_SIMD_INLINE void dequantize8_sse2(const std::uint16_t* in, float* out)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128 max = _mm_set1_ps(65535.0F);
+        const __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in)); //NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        _mm_storeu_ps(out, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(words, zero)), max));
+        _mm_storeu_ps(out + 4, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(words, zero)), max));
+    }
+#endif
+
+    template <typename T, typename U>
+    inline void quantize(const T* in, U* out, std::size_t count)
+    {
+        std::size_t i{0};
+#if defined(RAYCHELMATH_SIMD_SSE2)
+        if constexpr ((std::is_same_v<T, float> || std::is_same_v<T, double>) && std::is_same_v<U, std::uint8_t>) {
+            for (; i + 16 <= count; i += 16) {
+                quantize16_sse2(in + i, out + i);
+            }
+        } else if constexpr ((std::is_same_v<T, float> || std::is_same_v<T, double>) && std::is_same_v<U, std::uint16_t>) {
+            for (; i + 8 <= count; i += 8) {
+                quantize8_sse2(in + i, out + i);
+            }
+        }
+#endif
+        for (; i != count; ++i) {
+            out[i] = quantize_one<T, U>(in[i]);
+        }
+    }
+
+    template <typename U, typename T>
+    inline void dequantize(const U* in, T* out, std::size_t count)
+    {
+        std::size_t i{0};
+#if defined(RAYCHELMATH_SIMD_SSE2)
+        if constexpr (std::is_same_v<T, float> && std::is_same_v<U, std::uint8_t>) {
+            for (; i + 16 <= count; i += 16) {
+                dequantize16_sse2(in + i, out + i);
+            }
+        } else if constexpr (std::is_same_v<T, float> && std::is_same_v<U, std::uint16_t>) {
+            for (; i + 8 <= count; i += 8) {
+                dequantize8_sse2(in + i, out + i);
+            }
+        }
+#endif
+        for (; i != count; ++i) {
+            out[i] = dequantize_one<U, T>(in[i]);
+        }
+    }
+
+    template <typename From, typename To>
+    inline void rescale(const From* in, To* out, std::size_t count)
+    {
+        for (std::size_t i{0}; i != count; ++i) {
+            out[i] = rescale_one<From, To>(in[i]);
+        }
+    }
+
+    /*
+    * xoshiro128++ for W streams stored lane by lane (see RandomStreams.h): state holds W words of s0, then W words of
+    * s1 and so on. Every step advances all streams once and writes W outputs to out, either the raw bits or floats in
+    * [0, 1) made from the top 24 bits. The streams are split into the widest integer registers, each of which keeps its
+    * state in registers for all steps.
+    */
+
+    template <typename L>
+    RAYCHELMATH_SIMD_INLINE typename L::reg xoshiro128pp_next(typename L::reg& s0, typename L::reg& s1, typename L::reg& s2, typename L::reg& s3)
+    {
+        const auto sum = L::add(s0, s3);
+        const auto res = L::add(L::bit_or(L::template shift_left<7>(sum), L::template shift_right<25>(sum)), s0);
+        const auto t = L::template shift_left<9>(s1);
+
+        s2 = L::bit_xor(s2, s0);
+        s3 = L::bit_xor(s3, s1);
+        s1 = L::bit_xor(s1, s2);
+        s0 = L::bit_xor(s0, s3);
+        s2 = L::bit_xor(s2, t);
+        s3 = L::bit_or(L::template shift_left<11>(s3), L::template shift_right<21>(s3));
+
+        return res;
+    }
+
+    template <std::size_t W, typename Out, std::size_t Offset = 0>
+    inline void xoshiro128pp(std::uint32_t* state, Out* out, std::size_t steps)
+    {
+        static_assert(std::is_same_v<Out, std::uint32_t> || std::is_same_v<Out, float>);
+        if constexpr (Offset < W) {
+            constexpr auto Width = widest_lanes<std::uint32_t, W - Offset>();
+            using L = Lanes<std::uint32_t, Width>;
+
+            auto s0 = L::load(state + Offset);
+            auto s1 = L::load(state + W + Offset);
+            auto s2 = L::load(state + (2 * W) + Offset);
+            auto s3 = L::load(state + (3 * W) + Offset);
+            for (std::size_t i{0}; i != steps; ++i) {
+                const auto bits = xoshiro128pp_next<L>(s0, s1, s2, s3);
+                if constexpr (std::is_same_v<Out, float>) {
+                    Lanes<float, Width>::store(out + (i * W) + Offset, L::to_unit_float(bits));
+                } else {
+                    L::store(out + (i * W) + Offset, bits);
+                }
+            }
+            L::store(state + Offset, s0);
+            L::store(state + W + Offset, s1);
+            L::store(state + (2 * W) + Offset, s2);
+            L::store(state + (3 * W) + Offset, s3);
+
+            xoshiro128pp<W, Out, Offset + Width>(state, out, steps);
+        }
+    }
+
+} // namespace Raychel::details::simd
+
+#endif //!RAYCHELMATH_SIMD_H
@@ -0,0 +1,375 @@
+/**
+* \file srgb.h
+* \author Weckyy702 (weckyy702@gmail.com)
+* \brief sRGB transfer functions
+* \date 2026-10-16
+*
+* MIT License
+* Copyright (c) [2026] [Weckyy702 (weckyy702@gmail.com | https://github.com/Weckyy702)]
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+#ifndef RAYCHELMATH_SRGB_H
+#define RAYCHELMATH_SRGB_H
+
+#include "color.h"
+#include "constexpr_math.h"
+#include "fastmath.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <span>
+
+namespace Raychel {
+
+    namespace details::srgb {
+        //Constants of the piecewise sRGB curve from IEC 61966-2-1
+        constexpr double encode_threshold = 0.0031308;
+        constexpr double decode_threshold = 0.04045;
+        constexpr double linear_slope = 12.92;
+        constexpr double offset = 0.055;
+        constexpr double gamma = 2.4;
+    } // namespace details::srgb
+
+    /**
+    * \brief Convert an sRGB encoded value to linear light. Values outside [0, 1] follow the curve without clamping
+    */
+    template <std::floating_point T>
+    constexpr T srgb_to_linear(T x) noexcept
+    {
+        using namespace details::srgb;
+        if (x <= T(decode_threshold)) {
+            return x / T(linear_slope);
+        }
+        return details::math_pow((x + T(offset)) / T(1. + offset), T(gamma));
+    }
+
+    /**
+    * \brief Convert a linear light value to sRGB. Values outside [0, 1] follow the curve without clamping
+    */
+    template <std::floating_point T>
+    constexpr T linear_to_srgb(T x) noexcept
+    {
+        using namespace details::srgb;
+        if (x <= T(encode_threshold)) {
+            return x * T(linear_slope);
+        }
+        return (T(1. + offset) * details::math_pow(x, T(1. / gamma))) - T(offset);
+    }
+
+    template <std::floating_point T>
+    constexpr basic_color<T> srgb_to_linear(const basic_color<T>& c) noexcept
+    {
+        return basic_color<T>{srgb_to_linear(c[0]), srgb_to_linear(c[1]), srgb_to_linear(c[2])};
+    }
+
+    template <std::floating_point T>
+    constexpr basic_color<T> linear_to_srgb(const basic_color<T>& c) noexcept
+    {
+        return basic_color<T>{linear_to_srgb(c[0]), linear_to_srgb(c[1]), linear_to_srgb(c[2])};
+    }
+
+    namespace details::srgb {
+
+        //Linear values of all 8 bit sRGB codes
+        template <std::floating_point T>
+        inline constexpr auto decode_table = [] {
+            std::array<T, 256> table{};
+            for (std::size_t i{0}; i != table.size(); ++i) {
+                table[i] = static_cast<T>(srgb_to_linear(static_cast<double>(i) / 255.));
+            }
+            return table;
+        }();
+
+        template <typename T>
+        struct Quadratic
+        {
+            T c0, c1, c2;
+        };
+
+        //Every octave is split into 2^segment_bits segments of equal width, selected by the top mantissa bits of x
+        constexpr std::uint32_t segment_bits = 4;
+        constexpr std::uint32_t segment_shift = 23 - segment_bits;
+
+        /*
+        * Quadratics through three Chebyshev nodes of curve on every segment of [2^first_exponent, 1], plus one segment
+        * starting at 1 so x == 1 needs no special case. The coefficients are in t = x - (start of the segment).
+        */
+        template <std::floating_point T, int first_exponent>
+        constexpr auto make_segments(double (*curve)(double) noexcept)
+        {
+            constexpr std::size_t per_octave = std::size_t{1} << segment_bits;
+            std::array<Quadratic<T>, (static_cast<std::size_t>(-first_exponent) * per_octave) + 1> segments{};
+
+            const double node_offset = constexpr_sqrt(3.) / 4.;
+            for (std::size_t i{0}; i != segments.size(); ++i) {
+                const auto octave = std::bit_cast<double>(static_cast<std::uint64_t>(1023 + first_exponent + static_cast<int>(i / per_octave)) << 52U);
+                const double h = octave / static_cast<double>(per_octave);
+                const double x0 = octave + (h * static_cast<double>(i % per_octave));
+
+                const double t0 = h * (.5 - node_offset);
+                const double t1 = h * .5;
+                const double t2 = h * (.5 + node_offset);
+                const double y0 = curve(x0 + t0);
+
+                //Newton form p(t) = y0 + d01 * (t - t0) + d012 * (t - t0) * (t - t1)
+                const double d01 = (curve(x0 + t1) - y0) / (t1 - t0);
+                const double d12 = (curve(x0 + t2) - curve(x0 + t1)) / (t2 - t1);
+                const double d012 = (d12 - d01) / (t2 - t0);
+
+                segments[i] = Quadratic<T>{
+                    static_cast<T>(y0 - (d01 * t0) + (d012 * t0 * t1)),
+                    static_cast<T>(d01 - (d012 * (t0 + t1))),
+                    static_cast<T>(d012),
+                };
+            }
+            return segments;
+        }
+
+        constexpr double encode_curve(double x) noexcept
+        {
+            return ((1. + offset) * constexpr_pow(x, 1. / gamma)) - offset;
+        }
+
+        constexpr double decode_curve(double x) noexcept
+        {
+            return constexpr_pow((x + offset) / (1. + offset), gamma);
+        }
+
+        //The curved part of the encoding starts in [2^-9, 2^-8), the one of the decoding in [2^-5, 2^-4)
+        constexpr int encode_first_exponent = -9;
+        constexpr int decode_first_exponent = -5;
+
+        template <fastmath::Supported T>
+        inline constexpr auto encode_segments = make_segments<T, encode_first_exponent>(encode_curve);
+
+        template <fastmath::Supported T>
+        inline constexpr auto decode_segments = make_segments<T, decode_first_exponent>(decode_curve);
+
+        //Clamp to [0, 1] with NaN mapped to 0. std::min and std::max compile to branches, which are slow on unsorted data
+        template <fastmath::Supported T>
+        inline T clamp_unit(T x) noexcept
+        {
+            const T positive = fastmath::select(fastmath::mask<T>(x > T(0)), x, T(0));
+            return fastmath::select(fastmath::mask<T>(positive < T(1)), positive, T(1));
+        }
+
+        //x must be in [2^first_exponent, 1]. Only integer operations and one table load, so loops over it vectorize
+        template <int first_exponent, fastmath::Supported T, std::size_t N>
+        inline T evaluate_segments(const std::array<Quadratic<T>, N>& segments, T x) noexcept
+        {
+            constexpr auto first_bits = static_cast<std::uint32_t>(127 + first_exponent) << 23U;
+
+            const auto bits = std::bit_cast<std::uint32_t>(static_cast<float>(x));
+            const auto& s = segments[(bits - first_bits) >> segment_shift];
+            const T t = x - static_cast<T>(std::bit_cast<float>((bits >> segment_shift) << segment_shift));
+            return s.c0 + (t * (s.c1 + (t * s.c2)));
+        }
+
+    } // namespace details::srgb
+
+    /**
+    * \brief Approximate linear_to_srgb for x clamped to [0, 1], with NaN mapped to 0
+    *
+    * The curved part is a table of quadratics indexed by the float bits of x. float and double results are within 5e-7
+    * of linear_to_srgb, which is about 1/8000 of an 8 bit step. long double uses linear_to_srgb.
+    */
+    template <std::floating_point T>
+    inline T fast_linear_to_srgb(T x) noexcept
+    {
+        using namespace details::srgb;
+
+        if constexpr (details::fastmath::Supported<T>) {
+            using details::fastmath::mask, details::fastmath::select;
+            constexpr T curve_start = T(1) / T(1U << static_cast<unsigned>(-encode_first_exponent));
+
+            const T c = clamp_unit(x);
+            const T curve = evaluate_segments<encode_first_exponent>(encode_segments<T>, select(mask<T>(c > curve_start), c, curve_start));
+            return select(mask<T>(c <= T(encode_threshold)), c * T(linear_slope), curve);
+        } else {
+            return linear_to_srgb(std::min(T(1), std::max(T(0), x)));
+        }
+    }
+
+    /**
+    * \brief Approximate srgb_to_linear for x clamped to [0, 1], with NaN mapped to 0
+    *
+    * Works like fast_linear_to_srgb. float and double results are within 1.5e-6 of srgb_to_linear.
+    */
+    template <std::floating_point T>
+    inline T fast_srgb_to_linear(T x) noexcept
+    {
+        using namespace details::srgb;
+
+        if constexpr (details::fastmath::Supported<T>) {
+            using details::fastmath::mask, details::fastmath::select;
+            constexpr T curve_start = T(1) / T(1U << static_cast<unsigned>(-decode_first_exponent));
+
+            const T c = clamp_unit(x);
+            const T curve = evaluate_segments<decode_first_exponent>(decode_segments<T>, select(mask<T>(c > curve_start), c, curve_start));
+            return select(mask<T>(c <= T(decode_threshold)), c * T(1. / linear_slope), curve);
+        } else {
+            return srgb_to_linear(std::min(T(1), std::max(T(0), x)));
+        }
+    }
+
+    template <std::floating_point T>
+    inline basic_color<T> fast_linear_to_srgb(const basic_color<T>& c) noexcept
+    {
+        return basic_color<T>{fast_linear_to_srgb(c[0]), fast_linear_to_srgb(c[1]), fast_linear_to_srgb(c[2])};
+    }
+
+    template <std::floating_point T>
+    inline basic_color<T> fast_srgb_to_linear(const basic_color<T>& c) noexcept
+    {
+        return basic_color<T>{fast_srgb_to_linear(c[0]), fast_srgb_to_linear(c[1]), fast_srgb_to_linear(c[2])};
+    }
+
+    /**
+    * \brief Decode an 8 bit sRGB value with a table computed at compile time. The results are exact
+    */
+    template <std::floating_point T>
+    constexpr T srgb8_to_linear(std::uint8_t x) noexcept
+    {
+        return details::srgb::decode_table<T>[x];
+    }
+
+    template <std::floating_point T>
+    constexpr basic_color<T> srgb8_to_linear(const basic_color<std::uint8_t>& c) noexcept
+    {
+        return basic_color<T>{srgb8_to_linear<T>(c[0]), srgb8_to_linear<T>(c[1]), srgb8_to_linear<T>(c[2])};
+    }
+
+    /**
+    * \brief Encode x with fast_linear_to_srgb and round to 8 bits. Matches rounding linear_to_srgb except for values
+    * within 1.3e-4 of a step from the rounding boundary, which can end up one step off
+    */
+    template <std::floating_point T>
+    inline std::uint8_t linear_to_srgb8(T x) noexcept
+    {
+        //fast_linear_to_srgb already clamps, and its error is too small to push the result past 255.5
+        return static_cast<std::uint8_t>((fast_linear_to_srgb(x) * T(255)) + T(0.5));
+    }
+
+    template <std::floating_point T>
+    inline basic_color<std::uint8_t> linear_to_srgb8(const basic_color<T>& c) noexcept
+    {
+        return basic_color<std::uint8_t>{linear_to_srgb8(c[0]), linear_to_srgb8(c[1]), linear_to_srgb8(c[2])};
+    }
+
+    namespace details::srgb {
+        template <std::floating_point T>
+        inline void encode8(const T* in, std::uint8_t* out, std::size_t count) noexcept
+        {
+            for (std::size_t i{0}; i != count; ++i) {
+                out[i] = linear_to_srgb8(in[i]);
+            }
+        }
+    } // namespace details::srgb
+
+    /*
+    * Span versions. dst must hold at least as many colors as src. They process the colors as flat arrays of channels so
+    * the loops vectorize.
+    */
+
+    template <std::floating_point T>
+    void fast_linear_to_srgb(std::span<const basic_color<T>> src, std::span<basic_color<T>> dst) noexcept
+    {
+        RAYCHEL_ASSERT(dst.size() >= src.size());
+        const auto* in = details::channels(src);
+        auto* out = details::channels(dst);
+        for (std::size_t i{0}; i != src.size() * 3; ++i) {
+            out[i] = fast_linear_to_srgb(in[i]);
+        }
+    }
+
+    template <std::floating_point T>
+    void fast_srgb_to_linear(std::span<const basic_color<T>> src, std::span<basic_color<T>> dst) noexcept
+    {
+        RAYCHEL_ASSERT(dst.size() >= src.size());
+        const auto* in = details::channels(src);
+        auto* out = details::channels(dst);
+        for (std::size_t i{0}; i != src.size() * 3; ++i) {
+            out[i] = fast_srgb_to_linear(in[i]);
+        }
+    }
+
+    template <std::floating_point T>
+    void srgb8_to_linear(std::span<const basic_color<std::uint8_t>> src, std::span<basic_color<T>> dst) noexcept
+    {
+        RAYCHEL_ASSERT(dst.size() >= src.size());
+        const auto* in = details::channels(src);
+        auto* out = details::channels(dst);
+        for (std::size_t i{0}; i != src.size() * 3; ++i) {
+            out[i] = srgb8_to_linear<T>(in[i]);
+        }
+    }
+
+    /**
+    * \brief Encode and quantize every color in src in a single pass
+    */
+    template <std::floating_point T>
+    void linear_to_srgb8(std::span<const basic_color<T>> src, std::span<basic_color<std::uint8_t>> dst) noexcept
+    {
+        RAYCHEL_ASSERT(dst.size() >= src.size());
+        details::srgb::encode8(details::channels(src), details::channels(dst), src.size() * 3);
+    }
+
+    /**
+    * \brief Encode every color in src to interleaved 8 bit sRGB. dst must hold at least 3 * src.size() bytes
+    */
+    template <std::floating_point T>
+    void pack_srgb8(std::span<const basic_color<T>> src, std::span<std::uint8_t> dst) noexcept
+    {
+        RAYCHEL_ASSERT(dst.size() >= src.size() * 3);
+        details::srgb::encode8(details::channels(src), dst.data(), src.size() * 3);
+    }
+
+    /**
+    * \brief Encode every color in src to interleaved 8 bit sRGB with a constant alpha. dst must hold at least
+    * 4 * src.size() bytes
+    */
+    template <std::floating_point T>
+    void pack_srgba8(std::span<const basic_color<T>> src, std::span<std::uint8_t> dst, std::uint8_t alpha = 255) noexcept
+    {
+        RAYCHEL_ASSERT(dst.size() >= src.size() * 4);
+
+        //Same blocking as pack_rgba8
+        constexpr std::size_t block_size = 64;
+        std::array<std::uint8_t, block_size * 3> rgb{};
+
+        const auto* in = details::channels(src);
+        auto* out = dst.data();
+        for (std::size_t begin{0}; begin < src.size(); begin += block_size) {
+            const auto count = std::min(block_size, src.size() - begin);
+            details::srgb::encode8(in + (begin * 3), rgb.data(), count * 3);
+            for (std::size_t i{0}; i != count; ++i) {
+                out[((begin + i) * 4) + 0] = rgb[(i * 3) + 0];
+                out[((begin + i) * 4) + 1] = rgb[(i * 3) + 1];
+                out[((begin + i) * 4) + 2] = rgb[(i * 3) + 2];
+                out[((begin + i) * 4) + 3] = alpha;
+            }
+        }
+    }
+
+} // namespace Raychel
+
+#endif //!RAYCHELMATH_SRGB_H
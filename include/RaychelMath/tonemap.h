@@ -0,0 +1,326 @@
+/**
+* \file tonemap.h
+* \author Weckyy702 (weckyy702@gmail.com)
+* \brief Tone mapping operators for HDR colors
+* \date 2026-10-16
+*
+* MIT License
+* Copyright (c) [2026] [Weckyy702 (weckyy702@gmail.com | https://github.com/Weckyy702)]
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+#ifndef RAYCHELMATH_TONEMAP_H
+#define RAYCHELMATH_TONEMAP_H
+
+#include "PacketTuple.h"
+#include "color.h"
+#include "fastmath.h"
+#include "srgb.h"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <numbers>
+#include <span>
+#include <type_traits>
+
+/**
+* Tone mapping operators map linear HDR colors to linear display colors, which are then encoded with linear_to_srgb.
+* Every operator is a small aggregate holding its parameters, e.g. basic_aces<float>{.exposure = 2.F}, and can be
+* called with a basic_color<T> or with a basic_color_packet<T, W> to map W colors at once. The exposure is applied
+* first, and negative and NaN channels become 0.
+*
+* tonemap() maps a span of colors using packets, and tonemap_srgb8/tonemap_pack_srgba8 tone map, encode and quantize
+* in a single pass over the colors.
+*/
+
+namespace Raychel {
+
+    namespace details::tonemap {
+
+        //These follow the fast math policy of fastmath.h, packets evaluate them lane by lane
+        template <std::floating_point T>
+        constexpr T log2(T x) noexcept
+        {
+            return details::math_log(x) * std::numbers::log2e_v<T>;
+        }
+
+        template <std::floating_point T, std::size_t W>
+        basic_packet<T, W> log2(const basic_packet<T, W>& x) noexcept
+        {
+            return map_lanes(x, [](T lane) { return log2(lane); });
+        }
+
+        template <std::floating_point T>
+        constexpr T pow(T x, T y) noexcept
+        {
+            return details::math_pow(x, y);
+        }
+
+        template <std::floating_point T, std::size_t W>
+        basic_packet<T, W> pow(const basic_packet<T, W>& x, T y) noexcept
+        {
+            return map_lanes(x, [y](T lane) { return pow(lane, y); });
+        }
+
+        //x * exposure, with negative values and NaN mapped to 0
+        template <typename V, std::floating_point T>
+        constexpr V expose(const V& x, T exposure) noexcept
+        {
+            return max_value(V(T(0)), x * exposure);
+        }
+
+        template <typename V, std::floating_point T>
+        constexpr V clamp_unit(const V& x) noexcept
+        {
+            return min_value(V(T(1)), max_value(V(T(0)), x));
+        }
+
+        template <typename V, typename F>
+        constexpr basic_color<V> map_channels(const basic_color<V>& c, F&& f)
+        {
+            return basic_color<V>{f(c[0]), f(c[1]), f(c[2])};
+        }
+
+        //Number of colors tonemap() maps at once
+        constexpr std::size_t packet_width = 4;
+
+    } // namespace details::tonemap
+
+    /**
+    * \brief Reinhard's operator x / (1 + x) on every channel. Approaches 1 but never reaches it
+    */
+    template <std::floating_point T>
+    struct basic_reinhard
+    {
+        T exposure{1};
+
+        template <details::ChannelOf<T> V>
+        constexpr basic_color<V> operator()(const basic_color<V>& c) const noexcept
+        {
+            return details::tonemap::map_channels(c, [this](const V& x) {
+                const V y = details::tonemap::expose(x, exposure);
+                return y / (T(1) + y);
+            });
+        }
+    };
+
+    /**
+    * \brief Reinhard's operator with a white point, x * (1 + x / white^2) / (1 + x) on every channel. Exposed values of
+    * white map to 1, larger values go beyond 1 and are clamped when quantizing
+    */
+    template <std::floating_point T>
+    struct basic_reinhard_extended
+    {
+        T exposure{1};
+        T white{4};
+
+        template <details::ChannelOf<T> V>
+        constexpr basic_color<V> operator()(const basic_color<V>& c) const noexcept
+        {
+            const T inv_white2 = T(1) / (white * white);
+            return details::tonemap::map_channels(c, [this, inv_white2](const V& x) {
+                const V y = details::tonemap::expose(x, exposure);
+                return (y * (T(1) + (y * inv_white2))) / (T(1) + y);
+            });
+        }
+    };
+
+    /**
+    * \brief Krzysztof Narkowicz's rational fit of the ACES filmic curve on every channel, clamped to [0, 1]
+    *
+    * The fit includes the exposure of the ACES reference, so an exposure of about .6 matches the look of the full
+    * ACES pipeline.
+    */
+    template <std::floating_point T>
+    struct basic_aces
+    {
+        T exposure{1};
+
+        template <details::ChannelOf<T> V>
+        constexpr basic_color<V> operator()(const basic_color<V>& c) const noexcept
+        {
+            return details::tonemap::map_channels(c, [this](const V& x) {
+                const V y = details::tonemap::expose(x, exposure);
+                const V res = (y * ((T(2.51) * y) + T(.03))) / ((y * ((T(2.43) * y) + T(.59))) + T(.14));
+                return details::tonemap::clamp_unit<V, T>(res);
+            });
+        }
+    };
+
+    /**
+    * \brief John Hable's filmic curve from Uncharted 2 on every channel, scaled so exposed values of white map to 1
+    */
+    template <std::floating_point T>
+    struct basic_uncharted2
+    {
+        T exposure{2};
+        T white{11.2};
+
+        template <typename V>
+        static constexpr V curve(const V& x) noexcept
+        {
+            constexpr T a = .15; //shoulder strength
+            constexpr T b = .50; //linear strength
+            constexpr T c = .10; //linear angle
+            constexpr T d = .20; //toe strength
+            constexpr T e = .02; //toe numerator
+            constexpr T f = .30; //toe denominator
+            return ((x * ((a * x) + (c * b)) + (d * e)) / (x * ((a * x) + b) + (d * f))) - (e / f);
+        }
+
+        template <details::ChannelOf<T> V>
+        constexpr basic_color<V> operator()(const basic_color<V>& c) const noexcept
+        {
+            const T scale = T(1) / curve(white);
+            return details::tonemap::map_channels(c, [this, scale](const V& x) {
+                return curve(details::tonemap::expose(x, exposure)) * scale;
+            });
+        }
+    };
+
+    /**
+    * \brief The widely used minimal version of Troy Sobotka's AgX: an inset matrix, a log2 encoding between
+    * 10 stops below middle grey and white, a sigmoid polynomial, the outset matrix and a 2.2 gamma back to linear
+    *
+    * Unlike the other operators AgX mixes the channels, so bright saturated colors desaturate towards white instead of
+    * clipping. The default white point is 6.5 stops above middle grey. The log2 and pow calls follow the fast math
+    * policy (see fastmath.h).
+    */
+    template <std::floating_point T>
+    struct basic_agx
+    {
+        T exposure{1};
+        T white{T(.18 * 90.50966799187809)};
+
+        template <details::ChannelOf<T> V>
+        constexpr basic_color<V> operator()(const basic_color<V>& c) const noexcept
+        {
+            using namespace details;
+            using namespace details::tonemap;
+
+            constexpr T min_ev = T(-12.473931188332412); //log2(.18) - 10
+            const T max_ev = log2(white);
+            const T inv_range = T(1) / (max_ev - min_ev);
+
+            const V r = expose(c[0], exposure);
+            const V g = expose(c[1], exposure);
+            const V b = expose(c[2], exposure);
+
+            //Rows of the inset matrix
+            const basic_color<V> inset{
+                (r * T(.842479062253094)) + (g * T(.0784335999999992)) + (b * T(.0792237451477643)),
+                (r * T(.0423282422610123)) + (g * T(.878468636469772)) + (b * T(.0791661274605434)),
+                (r * T(.0423756549057051)) + (g * T(.0784336)) + (b * T(.879142973793104)),
+            };
+
+            const auto contrast = [&](const V& x) {
+                const V ev = min_value(V(max_ev), max_value(V(min_ev), log2(max_value(V(T(1e-10)), x))));
+                const V t = (ev - min_ev) * inv_range;
+                const V t2 = t * t;
+                const V t4 = t2 * t2;
+                // clang-format off
+                return (T(15.5) * t4 * t2) - (T(40.14) * t4 * t) + (T(31.96) * t4) - (T(6.868) * t2 * t) + (T(.4298) * t2) + (T(.1191) * t) - T(.00232);
+                // clang-format on
+            };
+            const V cr = contrast(inset[0]);
+            const V cg = contrast(inset[1]);
+            const V cb = contrast(inset[2]);
+
+            //Rows of the outset matrix, followed by the 2.2 gamma
+            const auto linearize = [](const V& x) { return pow(max_value(V(T(0)), x), T(2.2)); };
+            return basic_color<V>{
+                linearize((cr * T(1.19687900512017)) - (cg * T(.0980208811401368)) - (cb * T(.0990297440797205))),
+                linearize((cg * T(1.15190312990417)) - (cr * T(.0528968517574562)) - (cb * T(.0989611768448433))),
+                linearize((cb * T(1.15107367264116)) - (cr * T(.0529716355144438)) - (cg * T(.0980434501171241))),
+            };
+        }
+    };
+
+    /**
+    * \brief Operators that map basic_color<T> and basic_colorx4<T>
+    */
+    template <typename Operator, typename T>
+    concept ToneMapOperator = std::floating_point<T> && requires(const Operator& op, const basic_color<T>& c, const basic_colorx4<T>& p) {
+        { op(c) } -> std::same_as<basic_color<T>>;
+        { op(p) } -> std::same_as<basic_colorx4<T>>;
+    };
+
+    /**
+    * \brief Tone map every color in src and write the results to dst. dst must hold at least src.size() colors
+    */
+    template <std::floating_point T, ToneMapOperator<T> Operator>
+    void tonemap(const Operator& op, std::span<const basic_color<T>> src, std::span<basic_color<T>> dst)
+    {
+        RAYCHEL_ASSERT(dst.size() >= src.size());
+        constexpr auto W = details::tonemap::packet_width;
+
+        std::size_t i{0};
+        for (; i + W <= src.size(); i += W) {
+            store_packet(op(load_packet<W>(src.subspan(i).template first<W>())), dst.subspan(i).template first<W>());
+        }
+        for (; i != src.size(); ++i) {
+            dst[i] = op(src[i]);
+        }
+    }
+
+    namespace details::tonemap {
+        //Tone map blocks of colors small enough to stay in cache, then hand every block to encode
+        template <std::floating_point T, typename Operator, typename Encode>
+        void tonemap_blocks(const Operator& op, std::span<const basic_color<T>> src, Encode&& encode)
+        {
+            constexpr std::size_t block_size = 64;
+            std::array<basic_color<T>, block_size> block{};
+
+            for (std::size_t begin{0}; begin < src.size(); begin += block_size) {
+                const auto count = std::min(block_size, src.size() - begin);
+                ::Raychel::tonemap<T>(op, src.subspan(begin, count), block);
+                encode(begin, std::span<const basic_color<T>>{block.data(), count});
+            }
+        }
+    } // namespace details::tonemap
+
+    /**
+    * \brief Tone map, sRGB encode and quantize every color in src in a single pass
+    */
+    template <std::floating_point T, ToneMapOperator<T> Operator>
+    void tonemap_srgb8(const Operator& op, std::span<const basic_color<T>> src, std::span<basic_color<std::uint8_t>> dst)
+    {
+        RAYCHEL_ASSERT(dst.size() >= src.size());
+        details::tonemap::tonemap_blocks<T>(op, src, [dst](std::size_t begin, std::span<const basic_color<T>> block) {
+            linear_to_srgb8<T>(block, dst.subspan(begin, block.size()));
+        });
+    }
+
+    /**
+    * \brief Tone map every color in src and write it as interleaved 8 bit sRGB with a constant alpha, in a single
+    * pass. dst must hold at least 4 * src.size() bytes
+    */
+    template <std::floating_point T, ToneMapOperator<T> Operator>
+    void tonemap_pack_srgba8(const Operator& op, std::span<const basic_color<T>> src, std::span<std::uint8_t> dst, std::uint8_t alpha = 255)
+    {
+        RAYCHEL_ASSERT(dst.size() >= src.size() * 4);
+        details::tonemap::tonemap_blocks<T>(op, src, [dst, alpha](std::size_t begin, std::span<const basic_color<T>> block) {
+            pack_srgba8<T>(block, dst.subspan(begin * 4, block.size() * 4), alpha);
+        });
+    }
+
+} // namespace Raychel
+
+#endif //!RAYCHELMATH_TONEMAP_H
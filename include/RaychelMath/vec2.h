@@ -29,6 +29,7 @@
 #define RAYCHEL_VEC2_H
 
 #include "Tuple.h"
+#include "fastmath.h"
 #include "forward.h"
 #include "math.h"
 namespace Raychel {
@@ -84,9 +85,9 @@ namespace Raychel {
     }
 
     template <Arithmetic T>
-    T mag(const basic_vec2<T>& v)
+    constexpr T mag(const basic_vec2<T>& v)
     {
-        return std::sqrt(mag_sq(v));
+        return details::math_sqrt(mag_sq(v));
     }
 
     template <Arithmetic T>
@@ -96,13 +97,13 @@ namespace Raychel {
     }
 
     template <std::floating_point T>
-    basic_vec2<T> normalize(const basic_vec2<T>& v)
+    constexpr basic_vec2<T> normalize(const basic_vec2<T>& v)
     {
         return v / mag(v);
     }
 
     template <Arithmetic T>
-    T dist(const basic_vec2<T>& a, const basic_vec2<T>& b)
+    constexpr T dist(const basic_vec2<T>& a, const basic_vec2<T>& b)
     {
         return mag(a - b);
     }
@@ -122,10 +123,10 @@ namespace Raychel {
 	*\return basic_vec2Imp<T>
 	*/
     template <std::floating_point T, std::convertible_to<T> T_>
-    basic_vec2<T> rotate(const basic_vec2<T>& v, T_ theta)
+    constexpr basic_vec2<T> rotate(const basic_vec2<T>& v, T_ theta)
     {
-        using std::sin, std::cos;
-        return basic_vec2<T>{v[0] * cos(theta) - v[1] * sin(theta), v[0] * sin(theta) + v[1] * sin(theta)};
+        const auto [s, c] = details::math_sincos(static_cast<T>(theta));
+        return basic_vec2<T>{v[0] * c - v[1] * s, v[0] * s + v[1] * c};
     }
 
     /**
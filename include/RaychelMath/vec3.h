@@ -29,6 +29,7 @@
 #define RAYCHEL_VEC3_H
 
 #include "Tuple.h"
+#include "fastmath.h"
 #include "math.h"
 
 #include <cmath>
@@ -94,9 +95,9 @@ namespace Raychel {
     }
 
     template <Arithmetic T>
-    T mag(const basic_vec3<T>& v) noexcept
+    constexpr T mag(const basic_vec3<T>& v) noexcept
     {
-        return static_cast<T>(std::sqrt(mag_sq(v)));
+        return static_cast<T>(details::math_sqrt(mag_sq(v)));
     }
 
     template <Arithmetic T>
@@ -106,7 +107,7 @@ namespace Raychel {
     }
 
     template <Arithmetic T>
-    T dist(const basic_vec3<T>& a, const basic_vec3<T>& b) noexcept
+    constexpr T dist(const basic_vec3<T>& a, const basic_vec3<T>& b) noexcept
     {
         return mag(a - b);
     }
@@ -118,9 +119,11 @@ namespace Raychel {
     }
 
     template <std::floating_point T>
-    basic_vec3<T> normalize(const basic_vec3<T>& v) noexcept
+    constexpr basic_vec3<T> normalize(const basic_vec3<T>& v) noexcept
     {
-        RAYCHEL_ASSERT(v != basic_vec3<T>{});
+        if (!std::is_constant_evaluated()) {
+            RAYCHEL_ASSERT(v != basic_vec3<T>{});
+        }
         return v / mag(v);
     }
 
@@ -0,0 +1,244 @@
+/**
+* \file vec3a.h
+* \author Weckyy702 (weckyy702@gmail.com)
+* \brief Header for 3 dimensional vectors padded to 4 lanes
+* \date 2026-10-16
+*
+* MIT License
+* Copyright (c) [2026] [Weckyy702 (weckyy702@gmail.com | https://github.com/Weckyy702)]
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+#ifndef RAYCHELMATH_VEC3A_H
+#define RAYCHELMATH_VEC3A_H
+
+#include "vec3.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Raychel {
+
+    /**
+    * \brief Tag for 3D vectors that occupy 4 lanes
+    *
+    * The fourth lane is padding. In exchange for the extra memory, a vec3a is aligned to its size (capped at 32 bytes)
+    * so it can be loaded with a single aligned vector load and never straddles a cache line.
+    * Use basic_vec3 for buffers where memory footprint matters more than per-op latency.
+    *
+    * The constructors, the vec3 conversions and cross keep the padding at 0. Element-wise arithmetic does not (v * inf
+    * and v / 0 put NaN there), so dot, mag, cross and the comparisons ignore the padding.
+    */
+    struct Vec3aTag
+    {};
+    template <>
+    struct tuple_convertable<Vec3aTag, TupleTag> : std::true_type
+    {};
+    template <>
+    struct tuple_convertable<Vec3aTag, Vec3Tag> : std::true_type
+    {};
+    template <>
+    struct tuple_convertable<Vec3Tag, Vec3aTag> : std::true_type
+    {};
+
+    namespace details {
+        template <typename T>
+        constexpr std::size_t vec3a_alignment = std::min<std::size_t>(sizeof(T) * 4, 32U);
+    } // namespace details
+
+    template <Arithmetic T>
+    struct alignas(details::vec3a_alignment<T>) Vec3aBase : public TupleBase<T, 4>
+    {
+        using Base = TupleBase<T, 4>;
+        using Base::data_;
+
+        constexpr Vec3aBase() = default;
+
+        template <std::convertible_to<T>... Us>
+        requires(sizeof...(Us) <= 3) constexpr explicit Vec3aBase(Us&&... us) : Base{static_cast<T>(us)...}
+        {}
+
+        //Only the first three values are used, the padding lane is always 0
+        template <std::size_t N_>
+        constexpr Vec3aBase(const std::array<T, N_>& values)
+        {
+            std::copy_n(values.begin(), std::min<std::size_t>(N_, 3U), data_.begin());
+        }
+
+        constexpr auto& x()
+        {
+            return data_[0];
+        }
+
+        constexpr const auto& x() const
+        {
+            return data_[0];
+        }
+
+        constexpr auto& y()
+        {
+            return data_[1];
+        }
+
+        constexpr const auto& y() const
+        {
+            return data_[1];
+        }
+
+        constexpr auto& z()
+        {
+            return data_[2];
+        }
+
+        constexpr const auto& z() const
+        {
+            return data_[2];
+        }
+    };
+
+    template <Arithmetic T>
+    struct TupleTraits<T, 4, Vec3aTag>
+    {
+        using Base = Vec3aBase<T>;
+    };
+
+    template <Arithmetic T>
+    using basic_vec3a = Tuple<T, 4, Vec3aTag>;
+
+    /**
+    * \brief Convert a vec3 into its padded representation
+    */
+    template <Arithmetic T>
+    constexpr basic_vec3a<T> vec3a_from_vec3(const basic_vec3<T>& v) noexcept
+    {
+        return static_cast<basic_vec3a<T>>(v);
+    }
+
+    /**
+    * \brief Drop the padding lane of a vec3a
+    */
+    template <Arithmetic T>
+    constexpr basic_vec3<T> vec3_from_vec3a(const basic_vec3a<T>& v) noexcept
+    {
+        return static_cast<basic_vec3<T>>(v);
+    }
+
+    template <Arithmetic T>
+    constexpr bool operator==(const basic_vec3a<T>& a, const basic_vec3a<T>& b) noexcept
+    {
+        return (a[0] == b[0]) && (a[1] == b[1]) && (a[2] == b[2]);
+    }
+
+    template <Arithmetic T>
+    constexpr bool operator!=(const basic_vec3a<T>& a, const basic_vec3a<T>& b) noexcept
+    {
+        return !(a == b);
+    }
+
+    template <Arithmetic T>
+    constexpr T dot(const basic_vec3a<T>& a, const basic_vec3a<T>& b) noexcept
+    {
+        if constexpr (details::simd::accelerated<T, 4>) {
+            if (!std::is_constant_evaluated()) {
+                return details::simd::dot3_padded(a.data(), b.data());
+            }
+        }
+        return (a[0] * b[0]) + (a[1] * b[1]) + (a[2] * b[2]);
+    }
+
+    template <Arithmetic T>
+    constexpr T mag_sq(const basic_vec3a<T>& v) noexcept
+    {
+        return dot(v, v);
+    }
+
+    template <Arithmetic T>
+    constexpr T mag(const basic_vec3a<T>& v) noexcept
+    {
+        return static_cast<T>(details::math_sqrt(mag_sq(v)));
+    }
+
+    template <Arithmetic T>
+    constexpr T dist(const basic_vec3a<T>& a, const basic_vec3a<T>& b) noexcept
+    {
+        return mag(a - b);
+    }
+
+    template <Arithmetic T>
+    constexpr T dist_sq(const basic_vec3a<T>& a, const basic_vec3a<T>& b) noexcept
+    {
+        return mag_sq(a - b);
+    }
+
+    template <std::floating_point T>
+    constexpr basic_vec3a<T> normalize(const basic_vec3a<T>& v) noexcept
+    {
+        if (!std::is_constant_evaluated()) {
+            RAYCHEL_ASSERT(v != basic_vec3a<T>{});
+        }
+        return v / mag(v);
+    }
+
+    // clang-format off
+
+    template <Arithmetic T>
+    constexpr basic_vec3a<T> cross(const basic_vec3a<T>& a, const basic_vec3a<T>& b) noexcept
+    {
+        if constexpr (details::simd::accelerated<T, 4>) {
+            if (!std::is_constant_evaluated()) {
+                basic_vec3a<T> res;
+                details::simd::cross3_padded(res.data(), a.data(), b.data());
+                return res;
+            }
+        }
+        return basic_vec3a<T> {
+            (a[1] * b[2]) - (a[2] * b[1]),
+            (a[2] * b[0]) - (a[0] * b[2]),
+            (a[0] * b[1]) - (a[1] * b[0])
+        };
+    }
+
+    // clang-format on
+
+    template <Arithmetic T>
+    constexpr basic_vec3a<T> lerp(const basic_vec3a<T>& a, const basic_vec3a<T>& b, T x) noexcept
+    {
+        return (x * b) + ((1 - x) * a);
+    }
+
+    //vec3a is printed and parsed like a vec3, the padding lane is not part of the text representation
+    template <Arithmetic T>
+    inline std::ostream& operator<<(std::ostream& os, const basic_vec3a<T>& obj)
+    {
+        return os << vec3_from_vec3a(obj);
+    }
+
+    template <Arithmetic T>
+    inline std::istream& operator>>(std::istream& is, basic_vec3a<T>& obj)
+    {
+        basic_vec3<T> v;
+        if (is >> v) {
+            obj = vec3a_from_vec3(v);
+        }
+        return is;
+    }
+
+} // namespace Raychel
+
+#endif //!RAYCHELMATH_VEC3A_H
@@ -45,8 +45,8 @@ namespace Raychel {
     template <Arithmetic T>
     constexpr basic_vec3<T> rotate_x(const basic_vec3<T>& v, T theta) noexcept
     {
-        using std::sin, std::cos;
-        return basic_vec3<T>{v[0], v[1] * cos(theta) - v[2] * sin(theta), v[1] * sin(theta) + v[2] * cos(theta)};
+        const auto [s, c] = details::math_sincos(theta);
+        return basic_vec3<T>{v[0], v[1] * c - v[2] * s, v[1] * s + v[2] * c};
     }
 
     /**
@@ -60,8 +60,8 @@ namespace Raychel {
     template <std::floating_point T>
     constexpr basic_vec3<T> rotate_y(const basic_vec3<T>& v, T theta) noexcept
     {
-        using std::sin, std::cos;
-        return basic_vec3<T>{v[0] * cos(theta) + v[2] * sin(theta), v[1], -v[0] * sin(theta) + v[2] * cos(theta)};
+        const auto [s, c] = details::math_sincos(theta);
+        return basic_vec3<T>{v[0] * c + v[2] * s, v[1], -v[0] * s + v[2] * c};
     }
 
     /**
@@ -75,8 +75,8 @@ namespace Raychel {
     template <std::floating_point T>
     constexpr basic_vec3<T> rotate_z(const basic_vec3<T>& v, T theta) noexcept
     {
-        using std::sin, std::cos;
-        return basic_vec3<T>{v[0] * cos(theta) - v[1] * sin(theta), v[0] * sin(theta) + v[1] * cos(theta), v[2]};
+        const auto [s, c] = details::math_sincos(theta);
+        return basic_vec3<T>{v[0] * c - v[1] * s, v[0] * s + v[1] * c, v[2]};
     }
     /**
 	*\brief Reflect vector along normal
@@ -100,7 +100,7 @@ namespace Raychel {
     * \return
     */
     template <std::floating_point T>
-    basic_vec3<T> get_tangent(const basic_vec3<T>& normal) noexcept
+    constexpr basic_vec3<T> get_tangent(const basic_vec3<T>& normal) noexcept
     {
         auto tangent = basic_vec3<T>{normal[2], normal[2], -normal[0] - normal[1]};
         if (mag_sq(tangent) == 0) {
@@ -117,7 +117,7 @@ namespace Raychel {
     * \return +x, +y, +z axis as a tuple
     */
     template <std::floating_point T>
-    std::array<basic_vec3<T>, 3> get_basis_vectors(const basic_vec3<T>& normal) noexcept
+    constexpr std::array<basic_vec3<T>, 3> get_basis_vectors(const basic_vec3<T>& normal) noexcept
     {
         const auto j = normalize(normal);
         const auto k = get_tangent(j);
@@ -157,15 +157,14 @@ namespace Raychel {
     template <std::floating_point T, std::invocable RNG_t>
     basic_vec3<T> get_random_direction_on_cone_angle(const basic_vec3<T>& normal, T half_cone_angle, const RNG_t& rng) noexcept
     {
-        using std::sin, std::cos;
         if (half_cone_angle != 0) {
             half_cone_angle = std::clamp<T>(half_cone_angle, 0, half_pi<T>);
-            const auto theta = rng() * half_cone_angle;
-            const auto phi = rng() * pi_v<T>;
+            const auto [sin_theta, cos_theta] = details::math_sincos(rng() * half_cone_angle);
+            const auto [sin_phi, cos_phi] = details::math_sincos(rng() * pi_v<T>);
 
             const auto [i, j, k] = get_basis_vectors(normal);
 
-            return normalize((i * sin(theta) * sin(phi)) + (j * cos(theta)) + (k * cos(phi) * sin(theta)));
+            return normalize((i * sin_theta * sin_phi) + (j * cos_theta) + (k * cos_phi * sin_theta));
         }
         return normal;
     }
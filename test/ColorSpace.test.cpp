@@ -0,0 +1,143 @@
+#include "RaychelMath/ColorSpace.h"
+
+#include "catch2/catch.hpp"
+
+#include "helpers.h"
+
+#include <cmath>
+#include <span>
+#include <vector>
+
+#define RAYCHEL_COLOR_SPACE_TEST_TYPES float, double, long double
+
+#define RAYCHEL_BEGIN_TEST(test_name, test_tag)                                                                                  \
+    TEMPLATE_TEST_CASE(test_name, test_tag, RAYCHEL_COLOR_SPACE_TEST_TYPES)                                                      \
+    {                                                                                                                            \
+        using namespace Raychel;                                                                                                 \
+        using color = basic_color<TestType>;
+
+#define RAYCHEL_END_TEST }
+
+//clang-format doesn't like these macros
+// clang-format off
+
+namespace {
+
+    //Random colors plus grey, black and white, which have no hue
+    template <typename T>
+    std::vector<Raychel::basic_color<T>> test_colors(std::size_t count)
+    {
+        auto colors = Raychel::test::random_colors<T>(count, 0., 1.);
+        colors.emplace_back(T(0), T(0), T(0));
+        colors.emplace_back(T(1), T(1), T(1));
+        colors.emplace_back(T(.5), T(.5), T(.5));
+        return colors;
+    }
+
+    template <typename T>
+    constexpr T tolerance = std::is_same_v<T, float> ? T(2e-5) : T(1e-10);
+
+} // namespace
+
+RAYCHEL_BEGIN_TEST("Color space conversions of known colors", "[RaychelMath][ColorSpace]")
+
+    const auto eps = tolerance<TestType>;
+
+    const auto white = xyz_from_color(color{1, 1, 1});
+    REQUIRE(white.x() == Approx(.95047));
+    REQUIRE(white.y() == Approx(1));
+    REQUIRE(white.z() == Approx(1.08883));
+
+    //the Y channel is the luminance of the color
+    const color c{.2, .7, .4};
+    REQUIRE(xyz_from_color(c).y() == Approx(luminance(c)).epsilon(1e-4));
+
+    REQUIRE(test::close(lab_from_color(color{1, 1, 1}), basic_lab<TestType>{100, 0, 0}, TestType(1e-3)));
+    REQUIRE(test::close(lab_from_color(color{0, 0, 0}), basic_lab<TestType>{0, 0, 0}, eps));
+    const auto red = lab_from_color(color{1, 0, 0});
+    REQUIRE(red.l() == Approx(53.24).epsilon(1e-3));
+    REQUIRE(red.a() == Approx(80.09).epsilon(1e-3));
+    REQUIRE(red.b() == Approx(67.20).epsilon(1e-3));
+
+    REQUIRE(test::close(hsv_from_color(color{1, 0, 0}), basic_hsv<TestType>{0, 1, 1}, eps));
+    REQUIRE(test::close(hsv_from_color(color{0, .5, 0}), basic_hsv<TestType>{TestType(1) / 3, 1, .5}, eps));
+    REQUIRE(test::close(hsv_from_color(color{0, 0, 1}), basic_hsv<TestType>{TestType(2) / 3, 1, 1}, eps));
+    REQUIRE(test::close(hsv_from_color(color{1, 0, .5}), basic_hsv<TestType>{TestType(11) / 12, 1, 1}, eps));
+    REQUIRE(test::close(hsv_from_color(color{.5, .5, .5}), basic_hsv<TestType>{0, 0, .5}, eps));
+    REQUIRE(test::close(hsv_from_color(color{0, 0, 0}), basic_hsv<TestType>{0, 0, 0}, eps));
+
+    REQUIRE(test::close(hsl_from_color(color{1, 0, 0}), basic_hsl<TestType>{0, 1, .5}, eps));
+    REQUIRE(test::close(hsl_from_color(color{0, .5, .5}), basic_hsl<TestType>{.5, 1, .25}, eps));
+    REQUIRE(test::close(hsl_from_color(color{.75, .25, .25}), basic_hsl<TestType>{0, .5, .5}, eps));
+    REQUIRE(test::close(hsl_from_color(color{1, 1, 1}), basic_hsl<TestType>{0, 0, 1}, eps));
+
+    REQUIRE(test::close(ycocg_from_color(color{1, 1, 1}), basic_ycocg<TestType>{1, 0, 0}, eps));
+    REQUIRE(test::close(ycocg_from_color(color{1, 0, 0}), basic_ycocg<TestType>{.25, .5, -.25}, eps));
+    REQUIRE(test::close(ycocg_from_color(color{0, 1, 0}), basic_ycocg<TestType>{.5, 0, .5}, eps));
+
+    static_assert(hsv_from_color(color{0, 0, 1}).h() == TestType(2) / 3);
+    static_assert(color_from_hsl(basic_hsl<TestType>{0, 1, .5}) == color{1, 0, 0});
+    static_assert(color_from_ycocg(ycocg_from_color(color{.25, .5, .75})) == color{.25, .5, .75});
+    static_assert(lab_from_color(color{1, 1, 1}).l() > TestType(99.99));
+
+RAYCHEL_END_TEST
+
+RAYCHEL_BEGIN_TEST("Color space round trips", "[RaychelMath][ColorSpace]")
+
+    const auto eps = tolerance<TestType>;
+
+    for (const color& c : test_colors<TestType>(1'000)) {
+        REQUIRE(test::close(color_from_xyz(xyz_from_color(c)), c, eps));
+        REQUIRE(test::close(color_from_lab(lab_from_color(c)), c, eps));
+        REQUIRE(test::close(color_from_hsv(hsv_from_color(c)), c, eps));
+        REQUIRE(test::close(color_from_hsl(hsl_from_color(c)), c, eps));
+        REQUIRE(test::close(color_from_ycocg(ycocg_from_color(c)), c, eps));
+
+        const auto lab = lab_from_color(c);
+        REQUIRE(test::close(xyz_from_lab(lab_from_xyz(xyz_from_color(c))), xyz_from_color(c), eps));
+        REQUIRE(lab.l() >= TestType(-1e-3));
+        REQUIRE(lab.l() <= TestType(100.001));
+
+        const auto hsv = hsv_from_color(c);
+        const auto hsl = hsl_from_color(c);
+        REQUIRE(hsv.h() >= 0);
+        REQUIRE(hsv.h() < 1);
+        REQUIRE(hsl.h() == hsv.h());
+        REQUIRE(hsl.s() <= 1 + eps);
+    }
+
+RAYCHEL_END_TEST
+
+TEMPLATE_TEST_CASE("Color space spans", "[RaychelMath][ColorSpace]", float, double)
+{
+    using namespace Raychel;
+    using T = TestType;
+
+    const auto colors = test_colors<T>(1'001);
+    const auto eps = tolerance<T>;
+
+    //packets use the same formulas as scalars, but may be contracted to FMAs differently
+    const auto check = [&](auto forward, auto backward, auto scalar_forward) {
+        using Converted = std::invoke_result_t<decltype(scalar_forward), const basic_color<T>&>;
+        std::vector<Converted> converted(colors.size());
+        std::vector<basic_color<T>> restored(colors.size());
+        forward(std::span<const basic_color<T>>{colors}, std::span<Converted>{converted});
+        backward(std::span<const Converted>{converted}, std::span<basic_color<T>>{restored});
+        for (std::size_t i{0}; i != colors.size(); ++i) {
+            REQUIRE(test::close(converted[i], scalar_forward(colors[i]), T(10) * eps));
+            REQUIRE(test::close(restored[i], colors[i], eps));
+        }
+    };
+
+    check([](auto src, auto dst) { xyz_from_color<T>(src, dst); }, [](auto src, auto dst) { color_from_xyz<T>(src, dst); }, [](const auto& c) { return xyz_from_color(c); });
+    check([](auto src, auto dst) { lab_from_color<T>(src, dst); }, [](auto src, auto dst) { color_from_lab<T>(src, dst); }, [](const auto& c) { return lab_from_color(c); });
+    check([](auto src, auto dst) { hsv_from_color<T>(src, dst); }, [](auto src, auto dst) { color_from_hsv<T>(src, dst); }, [](const auto& c) { return hsv_from_color(c); });
+    check([](auto src, auto dst) { hsl_from_color<T>(src, dst); }, [](auto src, auto dst) { color_from_hsl<T>(src, dst); }, [](const auto& c) { return hsl_from_color(c); });
+    check([](auto src, auto dst) { ycocg_from_color<T>(src, dst); }, [](auto src, auto dst) { color_from_ycocg<T>(src, dst); }, [](const auto& c) { return ycocg_from_color(c); });
+
+    //a packet of colors converts like each of its lanes
+    const auto packet = hsv_from_color(load_packet<4>(std::span<const basic_color<T>, 4>{colors.data(), 4}));
+    for (std::size_t lane{0}; lane != 4; ++lane) {
+        REQUIRE(test::close(extract(packet, lane), hsv_from_color(colors[lane]), eps));
+    }
+}
@@ -0,0 +1,142 @@
+#include "RaychelMath/Matrix.h"
+#include "RaychelMath/Transform.h"
+#include "RaychelMath/equivalent.h"
+
+#include "catch2/catch.hpp"
+
+#include "fastmath_policy.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#define RAYCHEL_MATRIX_TEST_TYPES float, double, long double
+
+#define RAYCHEL_BEGIN_TEST(test_name, test_tag)                                                                                  \
+    TEMPLATE_TEST_CASE(test_name, test_tag, RAYCHEL_MATRIX_TEST_TYPES)                                                           \
+    {                                                                                                                            \
+        using namespace Raychel;                                                                                                 \
+        using vec3 = basic_vec3<TestType>;                                                                                       \
+        using mat3 = basic_mat3<TestType>;                                                                                       \
+        using mat4 = basic_mat4<TestType>;
+
+#define RAYCHEL_END_TEST }
+
+//clang-format doesn't like these macros
+// clang-format off
+
+namespace {
+    template <typename T>
+    bool vec_equivalent(const Raychel::basic_vec3<T>& a, const Raychel::basic_vec3<T>& b)
+    {
+        //a few ulps are lost in the matrix products, so use a slightly wider margin than equivalent()
+        constexpr T margin = std::numeric_limits<T>::epsilon() * 64 + Raychel::test::policy_margin<T>;
+        for (std::size_t i{0}; i != 3; ++i) {
+            if (std::abs(a[i] - b[i]) > margin * std::max<T>(1, std::abs(b[i]))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename T, std::size_t N, typename Tag>
+    bool mat_equivalent(const Raychel::Tuple<T, N, Tag>& a, const Raychel::Tuple<T, N, Tag>& b)
+    {
+        constexpr T margin = std::numeric_limits<T>::epsilon() * 64 + Raychel::test::policy_margin<T>;
+        for (std::size_t i{0}; i != N; ++i) {
+            if (std::abs(a[i] - b[i]) > margin * std::max<T>(1, std::abs(b[i]))) {
+                return false;
+            }
+        }
+        return true;
+    }
+} // namespace
+
+RAYCHEL_BEGIN_TEST("Creating matrices", "[RaychelMath][Matrix]")
+
+    constexpr mat3 identity{};
+    STATIC_REQUIRE(identity(0, 0) == 1);
+    STATIC_REQUIRE(identity(1, 0) == 0);
+    STATIC_REQUIRE(identity(2, 2) == 1);
+
+    const auto m = mat3_from_rows(vec3{1, 2, 3}, vec3{4, 5, 6}, vec3{7, 8, 9});
+    REQUIRE(m(0, 1) == 2);
+    REQUIRE(m(1, 0) == 4);
+    REQUIRE(m.row(2) == vec3{7, 8, 9});
+    REQUIRE(m.column(1) == vec3{2, 5, 8});
+    REQUIRE(m == mat3_from_columns(vec3{1, 4, 7}, vec3{2, 5, 8}, vec3{3, 6, 9}));
+    REQUIRE(transpose(m) == mat3_from_columns(vec3{1, 2, 3}, vec3{4, 5, 6}, vec3{7, 8, 9}));
+
+    const mat4 m4{};
+    REQUIRE(m4(3, 3) == 1);
+    REQUIRE(m4(3, 0) == 0);
+    REQUIRE(transpose(m4) == m4);
+
+RAYCHEL_END_TEST
+
+RAYCHEL_BEGIN_TEST("Matrix multiplication", "[RaychelMath][Matrix]")
+
+    const auto a = mat3_from_rows(vec3{1, 2, 3}, vec3{0, 1, 4}, vec3{5, 6, 0});
+    const auto b = mat3_from_rows(vec3{2, 0, 1}, vec3{1, 3, 0}, vec3{0, 1, 1});
+
+    REQUIRE(a * mat3{} == a);
+    REQUIRE(mat3{} * a == a);
+    REQUIRE(a * b == mat3_from_rows(vec3{4, 9, 4}, vec3{1, 7, 4}, vec3{16, 18, 5}));
+    REQUIRE(a * vec3{1, 1, 1} == vec3{6, 5, 11});
+
+    auto c = a;
+    c *= b;
+    REQUIRE(c == a * b);
+
+    const auto m4 = mat4_from_affine(a, vec3{1, 2, 3});
+    REQUIRE(m4 * mat4{} == m4);
+    REQUIRE(linear_part(m4 * m4) == a * a);
+    REQUIRE(m4 * Tuple<TestType, 4>{1, 1, 1, 1} == Tuple<TestType, 4>{7, 7, 14, 1});
+    REQUIRE(transform_point(m4, vec3{1, 1, 1}) == vec3{7, 7, 14});
+    REQUIRE(transform_direction(m4, vec3{1, 1, 1}) == vec3{6, 5, 11});
+
+RAYCHEL_END_TEST
+
+RAYCHEL_BEGIN_TEST("Matrix determinant and inverse", "[RaychelMath][Matrix]")
+
+    const auto a = mat3_from_rows(vec3{1, 2, 3}, vec3{0, 1, 4}, vec3{5, 6, 0});
+    REQUIRE(determinant(a) == 1);
+    REQUIRE(determinant(mat3{}) == 1);
+
+    const auto inv = inverse(a);
+    REQUIRE(mat_equivalent(inv, mat3_from_rows(vec3{-24, 18, 5}, vec3{20, -15, -4}, vec3{-5, 4, 1})));
+    REQUIRE(mat_equivalent(a * inv, mat3{}));
+
+    const auto m4 = mat4_from_affine(a, vec3{1, -2, 3});
+    REQUIRE(equivalent<TestType>(determinant(m4), 1));
+    REQUIRE(mat_equivalent(m4 * affine_inverse(m4), mat4{}));
+
+    const vec3 p{0.5, 7, -3};
+    REQUIRE(vec_equivalent(transform_point(affine_inverse(m4), transform_point(m4, p)), p));
+
+    mat4 general{};
+    general(3, 0) = 2;
+    general(0, 3) = 1;
+    REQUIRE(determinant(general) == -1);
+
+RAYCHEL_END_TEST
+
+RAYCHEL_BEGIN_TEST("Matrices from quaternions and transforms", "[RaychelMath][Matrix]")
+
+    const auto q = rotate_around(vec3{1, 2, -1}, TestType(0.7));
+    const auto r = mat3_from_quaternion(q);
+    const vec3 v{3, -1, 2};
+
+    REQUIRE(vec_equivalent(r * v, v * q));
+    REQUIRE(equivalent<TestType>(determinant(r), 1));
+    REQUIRE(mat_equivalent(r * transpose(r), mat3{}));
+
+    //non-unit quaternions describe the same rotation
+    REQUIRE(mat_equivalent(mat3_from_quaternion(q * TestType(3)), r));
+
+    const basic_transform<TestType> t{vec3{1, 2, 3}, q};
+    const mat4 m = mat4_from_transform(t);
+    REQUIRE(vec_equivalent(transform_point(m, v), apply(t, v)));
+    REQUIRE(vec_equivalent(transform_point(rigid_inverse(m), apply(t, v)), v));
+
+RAYCHEL_END_TEST
@@ -0,0 +1,184 @@
+#include "RaychelMath/Packet.h"
+#include "RaychelMath/PacketTuple.h"
+#include "RaychelMath/equivalent.h"
+
+#include "catch2/catch.hpp"
+
+#include "fastmath_policy.h"
+
+#include <array>
+#include <cmath>
+#include <limits>
+
+#define RAYCHEL_PACKET_TEST_TYPES float, double
+
+#define RAYCHEL_BEGIN_TEST(test_name, test_tag)                                                                                  \
+    TEMPLATE_TEST_CASE(test_name, test_tag, RAYCHEL_PACKET_TEST_TYPES)                                                           \
+    {                                                                                                                            \
+        using namespace Raychel;                                                                                                 \
+        using packet = basic_packet4<TestType>;
+
+#define RAYCHEL_END_TEST }
+
+//clang-format doesn't like these macros
+// clang-format off
+
+namespace {
+    template <typename T>
+    bool vec_equivalent(const Raychel::basic_vec3<T>& a, const Raychel::basic_vec3<T>& b)
+    {
+        using Raychel::test::policy_equivalent;
+        return policy_equivalent<T>(a[0], b[0]) && policy_equivalent<T>(a[1], b[1]) && policy_equivalent<T>(a[2], b[2]);
+    }
+} // namespace
+
+RAYCHEL_BEGIN_TEST("Packet arithmetic", "[RaychelMath][Packet]")
+
+    STATIC_REQUIRE(Arithmetic<packet>);
+    STATIC_REQUIRE(alignof(packet) == 4 * sizeof(TestType));
+
+    const packet a{1, 2, 3, 4};
+    const packet b{2};
+
+    REQUIRE(all((a + b) == packet{3, 4, 5, 6}));
+    REQUIRE(all((a - b) == packet{-1, 0, 1, 2}));
+    REQUIRE(all((a * b) == packet{2, 4, 6, 8}));
+    REQUIRE(all((a / b) == packet{0.5, 1, 1.5, 2}));
+    REQUIRE(all((1 - a) == packet{0, -1, -2, -3}));
+    REQUIRE(all(-a == packet{-1, -2, -3, -4}));
+    REQUIRE(hsum(a) == 10);
+
+    std::array<TestType, 4> storage{};
+    a.store(storage.data());
+    REQUIRE(storage[3] == 4);
+    REQUIRE(all(packet::load(storage.data()) == a));
+
+RAYCHEL_END_TEST
+
+RAYCHEL_BEGIN_TEST("Packet masks, select and blend", "[RaychelMath][Packet]")
+
+    const packet a{1, 5, 3, 7};
+    const packet b{4, 4, 4, 4};
+
+    using vec3 = basic_vec3<TestType>;
+    using vec3x4 = basic_vec3x4<TestType>;
+
+    const auto m = a < b;
+    REQUIRE(m[0]);
+    REQUIRE(!m[1]);
+    REQUIRE(m[2]);
+    REQUIRE(!m[3]);
+    REQUIRE(any(m));
+    REQUIRE(!all(m));
+    REQUIRE(none(m & !m));
+    REQUIRE(all(m | !m));
+
+    REQUIRE(all(select(m, a, b) == packet{1, 4, 3, 4}));
+    REQUIRE(all(min(a, b) == packet{1, 4, 3, 4}));
+    REQUIRE(all(max(a, b) == packet{4, 5, 4, 7}));
+
+    //NaN in the first argument propagates, NaN in the second one is ignored, in the vector paths as well
+    const auto nan = std::numeric_limits<TestType>::quiet_NaN();
+    const packet n{nan, 1, nan, 1};
+    const packet one{1};
+    const auto min_n = min(n, one);
+    const auto max_n = max(n, one);
+    REQUIRE((std::isnan(min_n[0]) && std::isnan(max_n[0]) && min_n[1] == 1 && max_n[1] == 1));
+    REQUIRE(all(min(one, n) == one));
+    REQUIRE(all(max(one, n) == one));
+    REQUIRE(all(abs(-a) == a));
+
+    //comparisons match the scalar operators in every lane, NaN is only unequal
+    REQUIRE((a <= b) == (a < b));
+    REQUIRE((a > b) == !(a <= b));
+    REQUIRE((a >= packet{3}) == (packet{3} <= a));
+    REQUIRE((a != b) == !(a == b));
+    REQUIRE((!(n == n)[0] && (n == n)[1]));
+    REQUIRE(((n != n)[0] && !(n != n)[1]));
+    REQUIRE((!(n < one)[0] && !(n >= one)[2] && (n >= one)[3]));
+    STATIC_REQUIRE(all(packet{1, 2, 3, 4} < packet{2, 3, 4, 5}));
+
+    REQUIRE(all(blend<0b0101U>(a, b) == packet{4, 5, 4, 7}));
+
+    const vec3x4 va{a, a, a};
+    const vec3x4 vb{b, b, b};
+    const auto v = select(m, va, vb);
+    REQUIRE(extract(v, 0) == vec3{1, 1, 1});
+    REQUIRE(extract(v, 1) == vec3{4, 4, 4});
+
+RAYCHEL_END_TEST
+
+TEMPLATE_TEST_CASE("Packet vector operations", "[RaychelMath][Packet]", RAYCHEL_PACKET_TEST_TYPES)
+{
+    using namespace Raychel;
+    using vec3 = basic_vec3<TestType>;
+
+    const std::array<vec3, 4> as{vec3{1, 2, 3}, vec3{-4, 0, 2}, vec3{0, 0, 1}, vec3{7, -1, 5}};
+    const std::array<vec3, 4> bs{vec3{3, 2, 1}, vec3{1, 1, 1}, vec3{0, 1, 0}, vec3{-2, 3, 0.5}};
+
+    const auto a = load_packet<4>(std::span<const vec3, 4>{as});
+    const auto b = load_packet<4>(std::span<const vec3, 4>{bs});
+
+    const auto d = dot(a, b);
+    const auto c = cross(a, b);
+    const auto n = normalize(a);
+    const auto l = lerp(a, b, TestType(0.25));
+    const auto r = reflect(a, normalize(b));
+    const auto neg = -a;
+
+    for (std::size_t i{0}; i != 4; ++i) {
+        REQUIRE(equivalent<TestType>(d[i], dot(as[i], bs[i])));
+        REQUIRE(extract(c, i) == cross(as[i], bs[i]));
+        REQUIRE(vec_equivalent(extract(n, i), normalize(as[i])));
+        REQUIRE(vec_equivalent(extract(l, i), lerp(as[i], bs[i], TestType(0.25))));
+        REQUIRE(vec_equivalent(extract(r, i), reflect(as[i], normalize(bs[i]))));
+        REQUIRE(extract(neg, i) == as[i] * -1);
+    }
+
+    std::array<vec3, 4> out{};
+    store_packet(a, std::span<vec3, 4>{out});
+    REQUIRE(out == as);
+}
+
+TEMPLATE_TEST_CASE("Packet quaternion rotation", "[RaychelMath][Packet]", RAYCHEL_PACKET_TEST_TYPES)
+{
+    using namespace Raychel;
+    using vec3 = basic_vec3<TestType>;
+    using quaternion = basic_quaternion<TestType>;
+
+    const std::array<vec3, 4> vs{vec3{1, 0, 0}, vec3{0, 1, 0}, vec3{1, 2, 3}, vec3{-3, 0.5, 2}};
+    const std::array<quaternion, 4> qs{
+        rotate_around(vec3{0, 0, 1}, half_pi<TestType>),
+        rotate_around(vec3{1, 0, 0}, pi_v<TestType>),
+        rotate_around(vec3{1, 1, 0}, TestType(0.3)),
+        quaternion{2, 0, 0, 0}};
+
+    const auto v = load_packet<4>(std::span<const vec3, 4>{vs});
+    const auto q = load_packet<4>(std::span<const quaternion, 4>{qs});
+
+    const auto rotated = v * q;
+    const auto rotated_same = v * qs[2];
+
+    for (std::size_t i{0}; i != 4; ++i) {
+        REQUIRE(vec_equivalent(extract(rotated, i), vs[i] * qs[i]));
+        REQUIRE(vec_equivalent(extract(rotated_same, i), vs[i] * qs[2]));
+    }
+}
+
+TEMPLATE_TEST_CASE("Packet SoA interop", "[RaychelMath][Packet]", RAYCHEL_PACKET_TEST_TYPES)
+{
+    using namespace Raychel;
+    using vec3 = basic_vec3<TestType>;
+
+    TupleSoA<TestType, 3, Vec3Tag> soa{};
+    for (int i = 0; i != 8; ++i) {
+        soa.push_back(vec3{i, 2 * i, 3 * i});
+    }
+
+    auto v = load_packet<8>(soa, 0);
+    REQUIRE(extract(v, 5) == vec3{5, 10, 15});
+
+    v *= TestType(2);
+    store_packet(v, soa, 0);
+    REQUIRE(soa[7].load() == vec3{14, 28, 42});
+}
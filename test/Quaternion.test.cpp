@@ -5,6 +5,8 @@
 #include "RaychelMath/Quaternion.h"
 #include "RaychelMath/equivalent.h"
 
+#include "fastmath_policy.h"
+
 //clang-format doesn't like these macros
 // clang-format off
 
@@ -46,15 +48,15 @@ RAYCHEL_BEGIN_TEST("Creating Quaternions", "[RaychelMath][Quaternion]")
     REQUIRE(c[2] == 0);
     REQUIRE(c[3] == 0);
 
-    REQUIRE(equivalent<TestType>(d[0], one_over_sqrt2));
-    REQUIRE(equivalent<TestType>(d[1], 0.5));
+    REQUIRE(test::policy_equivalent<TestType>(d[0], one_over_sqrt2));
+    REQUIRE(test::policy_equivalent<TestType>(d[1], 0.5));
     REQUIRE(d[2] == 0);
-    REQUIRE(equivalent<TestType>(d[3], 0.5));
+    REQUIRE(test::policy_equivalent<TestType>(d[3], 0.5));
 
-    REQUIRE(equivalent<TestType>(e[0], cos_eighth_pi));
-    REQUIRE(equivalent<TestType>(e[1], -.36 * sin_eighth_pi));
-    REQUIRE(equivalent<TestType>(e[2], .48 * sin_eighth_pi));
-    REQUIRE(equivalent<TestType>(e[3], .8 * sin_eighth_pi));
+    REQUIRE(test::policy_equivalent<TestType>(e[0], cos_eighth_pi));
+    REQUIRE(test::policy_equivalent<TestType>(e[1], -.36 * sin_eighth_pi));
+    REQUIRE(test::policy_equivalent<TestType>(e[2], .48 * sin_eighth_pi));
+    REQUIRE(test::policy_equivalent<TestType>(e[3], .8 * sin_eighth_pi));
 
 RAYCHEL_END_TEST
 
@@ -181,27 +183,27 @@ RAYCHEL_BEGIN_TEST("Quaternion multiplication: Vector", "[RaychelMath][Quaternio
 
     const auto x_r = x * a;
 
-    REQUIRE(equivalent<TestType>(x_r[0], 0.6));
-    REQUIRE(equivalent<TestType>(x_r[1], 0));
-    REQUIRE(equivalent<TestType>(x_r[2], -0.8));
+    REQUIRE(test::policy_equivalent<TestType>(x_r[0], 0.6));
+    REQUIRE(test::policy_equivalent<TestType>(x_r[1], 0));
+    REQUIRE(test::policy_equivalent<TestType>(x_r[2], -0.8));
 
     const auto y_r = y * a;
 
-    REQUIRE(equivalent<TestType>(y_r[0], 0));
-    REQUIRE(equivalent<TestType>(y_r[1], -1));
-    REQUIRE(equivalent<TestType>(y_r[2], 0));
+    REQUIRE(test::policy_equivalent<TestType>(y_r[0], 0));
+    REQUIRE(test::policy_equivalent<TestType>(y_r[1], -1));
+    REQUIRE(test::policy_equivalent<TestType>(y_r[2], 0));
 
     const auto z_r = z * a;
 
-    REQUIRE(equivalent<TestType>(z_r[0], -0.8));
-    REQUIRE(equivalent<TestType>(z_r[1], 0));
-    REQUIRE(equivalent<TestType>(z_r[2], -0.6));
+    REQUIRE(test::policy_equivalent<TestType>(z_r[0], -0.8));
+    REQUIRE(test::policy_equivalent<TestType>(z_r[1], 0));
+    REQUIRE(test::policy_equivalent<TestType>(z_r[2], -0.6));
 
     const auto v_r = v * a;
 
-    REQUIRE(equivalent<TestType>(v_r[0], 4.207));
-    REQUIRE(equivalent<TestType>(v_r[1], 7.99));
-    REQUIRE(equivalent<TestType>(v_r[2], -12.276));
+    REQUIRE(test::policy_equivalent<TestType>(v_r[0], 4.207));
+    REQUIRE(test::policy_equivalent<TestType>(v_r[1], 7.99));
+    REQUIRE(test::policy_equivalent<TestType>(v_r[2], -12.276));
 
 RAYCHEL_END_TEST
 
@@ -296,11 +298,11 @@ RAYCHEL_BEGIN_TEST("Quaternion magnitude", "[RaychelMath][Quaternion]")
 
     const auto res = mag(q);
 
-    REQUIRE(res == sqrt_299);
+    REQUIRE(test::policy_equal(res, sqrt_299));
 
     q = Quaternion{};
 
-    REQUIRE(mag(q) == 1);
+    REQUIRE(test::policy_equal<TestType>(mag(q), 1));
 
     q = Quaternion{0, 0, 0, 0};
 
@@ -330,7 +332,7 @@ RAYCHEL_BEGIN_TEST("Quaternion normalization", "[RaychelMath][Quaternion]")
 
     auto res = normalize(q);
 
-    REQUIRE(equivalent<TestType>(mag(res), 1.0));
+    REQUIRE(test::policy_equivalent<TestType>(mag(res), 1.0));
 
 RAYCHEL_END_TEST
 
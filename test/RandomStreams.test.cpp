@@ -0,0 +1,120 @@
+#include "catch2/catch.hpp"
+
+#include "RaychelMath/RandomStreams.h"
+#include "RaychelMath/vector.h"
+
+#include <cmath>
+#include <vector>
+
+//clang-format doesn't like these macros
+// clang-format off
+
+TEST_CASE("Xoshiro128PlusPlus reference output", "[RaychelMath][Random]")
+{
+    using namespace Raychel;
+    using state = Xoshiro128PlusPlus::state_type;
+
+    STATIC_REQUIRE(StdRandomNumberEngine<Xoshiro128PlusPlus>);
+
+    Xoshiro128PlusPlus rng{state{1, 2, 3, 4}};
+    REQUIRE(rng() == 0x00000281U);
+    REQUIRE(rng() == 0x00180387U);
+    REQUIRE(rng() == 0xC0183387U);
+    REQUIRE(rng() == 0xD1AE3B02U);
+
+    Xoshiro128PlusPlus jumped{state{1, 2, 3, 4}};
+    jumped.jump();
+    REQUIRE(jumped() == 0xBA8C0DDCU);
+
+    Xoshiro128PlusPlus long_jumped{state{1, 2, 3, 4}};
+    long_jumped.long_jump();
+    REQUIRE(long_jumped() == 0x99CC2935U);
+}
+
+TEMPLATE_TEST_CASE_SIG("RandomStreams lanes", "[RaychelMath][RandomStreams]", ((std::size_t W), W), 4, 8)
+{
+    using namespace Raychel;
+
+    RandomStreams<W> streams{17};
+
+    //every lane runs its own jumped copy of the scalar engine
+    std::array<Xoshiro128PlusPlus, W> engines{};
+    Xoshiro128PlusPlus engine{17};
+    for (auto& e : engines) {
+        e = engine;
+        engine.jump();
+    }
+    for (std::size_t i{0}; i != W; ++i) {
+        REQUIRE(streams.lane(i) == engines[i]);
+    }
+
+    for (int step = 0; step != 100; ++step) {
+        const auto bits = streams();
+        for (std::size_t i{0}; i != W; ++i) {
+            REQUIRE(bits[i] == engines[i]());
+        }
+    }
+
+    auto jumped = streams;
+    jumped.long_jump();
+    for (std::size_t i{0}; i != W; ++i) {
+        engines[i].long_jump();
+        REQUIRE(jumped.lane(i) == engines[i]);
+    }
+
+    REQUIRE(RandomStreams<W>{} == RandomStreams<W>{RandomStreams<W>::default_seed});
+    REQUIRE(RandomStreams<W>{1} != RandomStreams<W>{2});
+}
+
+TEMPLATE_TEST_CASE("RandomStreams uniform numbers", "[RaychelMath][RandomStreams]", float, double)
+{
+    using namespace Raychel;
+
+    RandomStreams<8> a{3};
+    RandomStreams<8> b{3};
+
+    //fill matches consecutive packets, including a partial group at the end
+    std::vector<TestType> values(8 * 100 + 5);
+    a.fill(std::span<TestType>{values});
+    for (std::size_t begin{0}; begin < values.size(); begin += 8) {
+        const auto packet = b.template uniform<TestType>();
+        for (std::size_t i{0}; i != 8 && begin + i != values.size(); ++i) {
+            REQUIRE(values[begin + i] == packet[i]);
+        }
+    }
+    REQUIRE(a == b);
+
+    std::vector<TestType> many(100'000);
+    a.fill(std::span<TestType>{many});
+    TestType sum{0};
+    for (const auto x : many) {
+        REQUIRE((x >= 0 && x < 1));
+        sum += x;
+    }
+    REQUIRE(std::abs((sum / static_cast<TestType>(many.size())) - TestType(.5)) < TestType(.01));
+
+    //the largest output must not round up to 1
+    REQUIRE(details::random::uniform_from_bits<TestType>(~std::uint32_t{0}) < 1);
+}
+
+TEMPLATE_TEST_CASE("BufferedUniformReal", "[RaychelMath][RandomStreams]", float, double)
+{
+    using namespace Raychel;
+
+    BufferedUniformReal<TestType, 4> buffered{5};
+    RandomStreams<4> streams{5};
+
+    std::vector<TestType> expected(3 * BufferedUniformReal<TestType, 4>::buffer_size);
+    streams.fill(std::span<TestType>{expected});
+    for (const auto x : expected) {
+        REQUIRE(buffered() == x);
+    }
+
+    //the generator plugs into the functions taking a const rng
+    const auto rng = buffered.generator();
+    STATIC_REQUIRE(std::invocable<decltype(rng)>);
+    const basic_vec3<TestType> normal{0, 0, 1};
+    for (int i = 0; i != 100; ++i) {
+        REQUIRE(dot(get_random_direction_on_hemisphere(normal, rng), normal) >= 0);
+    }
+}
@@ -0,0 +1,151 @@
+#include "RaychelMath/Rotation.h"
+#include "RaychelMath/vector.h"
+
+#include "catch2/catch.hpp"
+
+#include "fastmath_policy.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#define RAYCHEL_ROTATION_TEST_TYPES float, double, long double
+
+#define RAYCHEL_BEGIN_TEST(test_name, test_tag)                                                                                  \
+    TEMPLATE_TEST_CASE(test_name, test_tag, RAYCHEL_ROTATION_TEST_TYPES)                                                         \
+    {                                                                                                                            \
+        using namespace Raychel;
+
+#define RAYCHEL_END_TEST }
+
+//clang-format doesn't like these macros
+// clang-format off
+
+namespace {
+    template <typename T, std::size_t N, typename Tag>
+    bool tuple_equivalent(const Raychel::Tuple<T, N, Tag>& a, const Raychel::Tuple<T, N, Tag>& b)
+    {
+        constexpr T margin = std::numeric_limits<T>::epsilon() * 64 + Raychel::test::policy_margin<T>;
+        for (std::size_t i{0}; i != N; ++i) {
+            if (std::abs(a[i] - b[i]) > margin * std::max<T>(1, std::abs(b[i]))) {
+                return false;
+            }
+        }
+        return true;
+    }
+} // namespace
+
+RAYCHEL_BEGIN_TEST("Axis rotations match rotate_x/y/z", "[RaychelMath][Rotation]")
+
+    using vec3 = basic_vec3<TestType>;
+
+    const vec3 v{0.3, -1.5, 2};
+
+    for (const TestType angle : {TestType(0), TestType(0.25), TestType(-1.3), TestType(2.9), pi_v<TestType>}) {
+        REQUIRE(tuple_equivalent(basic_rotation_x<TestType>{angle}(v), rotate_x(v, angle)));
+        REQUIRE(tuple_equivalent(basic_rotation_y<TestType>{angle}(v), rotate_y(v, angle)));
+        REQUIRE(tuple_equivalent(apply(basic_rotation_z<TestType>{angle}, v), rotate_z(v, angle)));
+    }
+
+    //the default rotation does nothing
+    REQUIRE(basic_rotation_y<TestType>{}(v) == v);
+
+    const basic_rotation_z<TestType> r{TestType(0.7)};
+    REQUIRE(tuple_equivalent(inverse(r)(r(v)), v));
+
+RAYCHEL_END_TEST
+
+RAYCHEL_BEGIN_TEST("Composing axis rotations", "[RaychelMath][Rotation]")
+
+    using vec3 = basic_vec3<TestType>;
+
+    const vec3 v{0.3, -1.5, 2};
+    const auto a = TestType(0.4), b = TestType(-2.1);
+
+    //same axis: the angles add
+    const auto ab = basic_rotation_x<TestType>{a} * basic_rotation_x<TestType>{b};
+    REQUIRE(tuple_equivalent(ab(v), rotate_x(v, a + b)));
+
+    const basic_rotation_x<TestType> rx{a};
+    const basic_rotation_y<TestType> ry{b};
+    const basic_rotation_z<TestType> rz{TestType(1.2)};
+    const auto expected = rz(ry(rx(v)));
+
+    REQUIRE(tuple_equivalent(mat3_from_rotation(rx) * v, rx(v)));
+    REQUIRE(tuple_equivalent((mat3_from_rotation(rz) * mat3_from_rotation(ry) * mat3_from_rotation(rx)) * v, expected));
+
+    for (const TestType angle : {TestType(0), TestType(1e-3), TestType(0.8), TestType(-2.5), TestType(3.1)}) {
+        const basic_rotation_y<TestType> r{angle};
+        const auto q = quaternion_from_rotation(r);
+        REQUIRE(tuple_equivalent(v * q, r(v)));
+        REQUIRE(tuple_equivalent(q.quaternion(), rotate_around(vec3{0, 1, 0}, angle)));
+    }
+
+    const auto q = quaternion_from_rotation(rz) * quaternion_from_rotation(ry) * quaternion_from_rotation(rx);
+    REQUIRE(tuple_equivalent(v * q, expected));
+
+RAYCHEL_END_TEST
+
+RAYCHEL_BEGIN_TEST("Batch axis rotations", "[RaychelMath][Rotation]")
+
+    using vec3 = basic_vec3<TestType>;
+
+    const basic_rotation_y<TestType> r{TestType(1.1)};
+
+    std::vector<vec3> points;
+    for (int i{0}; i != 37; ++i) {
+        points.emplace_back(TestType(i) * TestType(0.25), TestType(-i), TestType(3 - i));
+    }
+
+    std::vector<vec3> out(points.size());
+    apply_points<TestType>(r, points, out);
+    for (std::size_t i{0}; i != points.size(); ++i) {
+        REQUIRE(tuple_equivalent(out[i], r(points[i])));
+    }
+
+    TupleSoA<TestType, 3, Vec3Tag> soa{std::span<const vec3>{points}};
+    TupleSoA<TestType, 3, Vec3Tag> soa_out;
+    apply_points(r, soa, soa_out);
+    REQUIRE(soa_out.size() == points.size());
+    for (std::size_t i{0}; i != points.size(); ++i) {
+        REQUIRE(tuple_equivalent(vec3{soa_out[i]}, out[i]));
+    }
+
+    //in place
+    apply_points<TestType>(r, points, points);
+    apply_points(r, soa, soa);
+    for (std::size_t i{0}; i != points.size(); ++i) {
+        REQUIRE(points[i] == out[i]);
+        REQUIRE(tuple_equivalent(vec3{soa[i]}, out[i]));
+    }
+
+RAYCHEL_END_TEST
+
+RAYCHEL_BEGIN_TEST("2D rotations", "[RaychelMath][Rotation]")
+
+    using vec2 = basic_vec2<TestType>;
+
+    const vec2 v{0.5, -2};
+    const basic_rotation2d<TestType> r{TestType(0.9)};
+
+    REQUIRE(tuple_equivalent(r(v), rotate(v, TestType(0.9))));
+    REQUIRE(rotate(v, r) == r(v));
+    REQUIRE(tuple_equivalent(basic_rotation2d<TestType>{half_pi<TestType>}(vec2{0, 1}), vec2{-1, 0}));
+    REQUIRE(tuple_equivalent((r * inverse(r))(v), v));
+    REQUIRE(tuple_equivalent((r * r)(v), rotate(v, TestType(1.8))));
+
+    std::vector<vec2> points{vec2{1, 0}, vec2{0, 1}, vec2{-3, 4}, v};
+    std::vector<vec2> out(points.size());
+    apply_points<TestType>(r, points, out);
+
+    TupleSoA<TestType, 2, vec2Tag> soa{std::span<const vec2>{points}};
+    apply_points(r, soa, soa);
+    for (std::size_t i{0}; i != points.size(); ++i) {
+        REQUIRE(tuple_equivalent(out[i], r(points[i])));
+        REQUIRE(tuple_equivalent(vec2{soa[i]}, out[i]));
+    }
+
+RAYCHEL_END_TEST
+
+// clang-format on
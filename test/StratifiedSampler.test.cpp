@@ -0,0 +1,138 @@
+#include "catch2/catch.hpp"
+
+#include "RaychelMath/StratifiedSampler.h"
+#include "RaychelMath/random.h"
+#include "RaychelMath/sampling.h"
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+//clang-format doesn't like these macros
+// clang-format off
+
+namespace {
+
+    //Every cell of the grid, and for correlated multi-jittering every row and column of the fine grid, holds exactly
+    //one of the first sample_count() points
+    template <typename T>
+    bool check_strata(const Raychel::StratifiedSampler& sampler, std::uint32_t strata_x, std::uint32_t strata_y, bool n_rooks)
+    {
+        const auto count = sampler.sample_count();
+        std::vector<int> cells(count);
+        std::vector<int> columns(count);
+        std::vector<int> rows(count);
+        for (std::uint32_t i{0}; i != count; ++i) {
+            const auto p = sampler.sample<T>(i);
+            if (p.x() < 0 || p.x() >= 1 || p.y() < 0 || p.y() >= 1) {
+                return false;
+            }
+            ++cells[(static_cast<std::size_t>(p.y() * strata_y) * strata_x) + static_cast<std::size_t>(p.x() * strata_x)];
+            ++columns[static_cast<std::size_t>(p.x() * count)];
+            ++rows[static_cast<std::size_t>(p.y() * count)];
+        }
+        const auto once = [](const std::vector<int>& counts) { return std::all_of(counts.begin(), counts.end(), [](int c) { return c == 1; }); };
+        return once(cells) && (!n_rooks || (once(columns) && once(rows)));
+    }
+
+} // namespace
+
+TEMPLATE_TEST_CASE("Stratified sampler patterns", "[RaychelMath][StratifiedSampler]", float, double)
+{
+    using namespace Raychel;
+
+    STATIC_REQUIRE(std::is_trivially_copyable_v<StratifiedSampler>);
+
+    for (const auto& [strata_x, strata_y] : {std::pair{1U, 1U}, std::pair{4U, 4U}, std::pair{3U, 7U}, std::pair{16U, 9U}}) {
+        for (const std::uint32_t seed : {0U, 1U, 77U}) {
+            const StratifiedSampler stratified{strata_x, strata_y, StratifiedPattern::stratified, seed};
+            const StratifiedSampler jittered{strata_x, strata_y, StratifiedPattern::jittered, seed};
+            const StratifiedSampler cmj{strata_x, strata_y, StratifiedPattern::correlated_multi_jittered, seed};
+
+            REQUIRE(cmj.sample_count() == strata_x * strata_y);
+            REQUIRE(check_strata<TestType>(stratified, strata_x, strata_y, false));
+            REQUIRE(check_strata<TestType>(jittered, strata_x, strata_y, false));
+            REQUIRE(check_strata<TestType>(cmj, strata_x, strata_y, true));
+        }
+    }
+
+    const StratifiedSampler stratified{2, 2, StratifiedPattern::stratified};
+    REQUIRE(stratified.sample<TestType>(3) == basic_vec2<TestType>{.75, .75});
+    REQUIRE(stratified.pattern() == StratifiedPattern::stratified);
+}
+
+TEST_CASE("Stratified sampler seeding", "[RaychelMath][StratifiedSampler]")
+{
+    using namespace Raychel;
+
+    StratifiedSampler a{8, 8};
+    StratifiedSampler b{8, 8};
+    a.seed(10, 20);
+    b.seed(10, 20);
+    StratifiedSampler other_pixel{8, 8};
+    other_pixel.seed(11, 20);
+    StratifiedSampler other_frame{8, 8};
+    other_frame.seed(10, 20, 1);
+
+    int same_pixel{0};
+    int same_frame{0};
+    for (std::uint32_t i{0}; i != 64; ++i) {
+        REQUIRE(a.sample(i) == b.sample(i));
+        same_pixel += a.sample(i) == other_pixel.sample(i) ? 1 : 0;
+        same_frame += a.sample(i) == other_frame.sample(i) ? 1 : 0;
+    }
+    REQUIRE(same_pixel < 4);
+    REQUIRE(same_frame < 4);
+
+    //indices past sample_count() start a new pattern that is stratified as well
+    int repeated{0};
+    for (std::uint32_t i{0}; i != 64; ++i) {
+        repeated += a.sample(i) == a.sample(64 + i) ? 1 : 0;
+    }
+    REQUIRE(repeated < 4);
+
+    std::vector<basic_vec2<float>> points(200);
+    a.fill(std::span<basic_vec2<float>>{points}, 50);
+    for (std::uint32_t i{0}; i != points.size(); ++i) {
+        REQUIRE(points[i] == a.sample(50 + i));
+    }
+}
+
+TEST_CASE("Stratified samples on the hemisphere", "[RaychelMath][StratifiedSampler]")
+{
+    using namespace Raychel;
+
+    //Irradiance from a sky that gets brighter towards +x, the integral of (1 + x) cos(theta) over the hemisphere is
+    //pi. The stratified estimate is much closer than the white noise one
+    const SamplingFrame<double> frame{basic_vec3<double>{0, 1, 0}};
+    const auto estimate = [&frame](std::span<const basic_vec2<double>> u) {
+        std::vector<basic_vec3<double>> directions(u.size());
+        sample_cosine_hemisphere(frame, u, std::span<basic_vec3<double>>{directions});
+        double sum{0};
+        for (const auto& v : directions) {
+            sum += (1 + v.x()) * v.y() / cosine_hemisphere_pdf(frame, v);
+        }
+        return sum / static_cast<double>(u.size());
+    };
+
+    StratifiedSampler sampler{16, 16};
+    Xoshiro256PlusPlus engine{9};
+    std::vector<basic_vec2<double>> u(sampler.sample_count());
+    double stratified_error{0};
+    double random_error{0};
+    for (std::uint32_t pixel{0}; pixel != 16; ++pixel) {
+        sampler.seed(pixel, 0);
+        sampler.fill(std::span<basic_vec2<double>>{u});
+        const auto stratified = estimate(u);
+
+        for (auto& p : u) {
+            p = basic_vec2<double>{uniform_real<double>(engine), uniform_real<double>(engine)};
+        }
+        const auto random = estimate(u);
+
+        stratified_error += (stratified - pi_v<double>) * (stratified - pi_v<double>);
+        random_error += (random - pi_v<double>) * (random - pi_v<double>);
+    }
+    REQUIRE(stratified_error < random_error / 100);
+}
@@ -0,0 +1,111 @@
+#include "RaychelMath/Transform.h"
+#include "RaychelMath/equivalent.h"
+
+#include "catch2/catch.hpp"
+
+#include "fastmath_policy.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#define RAYCHEL_TRANSFORM_TEST_TYPES float, double, long double
+
+#define RAYCHEL_BEGIN_TEST(test_name, test_tag)                                                                                  \
+    TEMPLATE_TEST_CASE(test_name, test_tag, RAYCHEL_TRANSFORM_TEST_TYPES)                                                        \
+    {                                                                                                                            \
+        using namespace Raychel;                                                                                                 \
+        using vec3 = basic_vec3<TestType>;                                                                                       \
+        using Transform = basic_transform<TestType>;                                                                             \
+        using CompiledTransform = basic_compiled_transform<TestType>;
+
+#define RAYCHEL_END_TEST }
+
+//clang-format doesn't like these macros
+// clang-format off
+
+namespace {
+    template <typename T>
+    bool vec_equivalent(const Raychel::basic_vec3<T>& a, const Raychel::basic_vec3<T>& b)
+    {
+        constexpr T margin = std::numeric_limits<T>::epsilon() * 64 + Raychel::test::policy_margin<T>;
+        for (std::size_t i{0}; i != 3; ++i) {
+            if (std::abs(a[i] - b[i]) > margin * std::max<T>(1, std::abs(b[i]))) {
+                return false;
+            }
+        }
+        return true;
+    }
+} // namespace
+
+RAYCHEL_BEGIN_TEST("Compiled transforms", "[RaychelMath][Transform]")
+
+    const Transform t{vec3{1, -2, 0.5}, rotate_around(vec3{0.3, 1, -2}, TestType(1.1))};
+    const CompiledTransform c{t};
+
+    const vec3 v{4, 2, -7};
+
+    REQUIRE(vec_equivalent(apply(c, v), apply(t, v)));
+    REQUIRE(vec_equivalent(apply_direction(c, v), v * t.rotation));
+    REQUIRE(vec_equivalent(inverse_apply(c, apply(t, v)), v));
+    REQUIRE(vec_equivalent(inverse_apply_direction(c, apply_direction(c, v)), v));
+    REQUIRE(vec_equivalent(transform_point(mat4_from_transform(c), v), apply(t, v)));
+
+    //the default compiled transform does nothing
+    REQUIRE(apply(CompiledTransform{}, v) == v);
+
+RAYCHEL_END_TEST
+
+RAYCHEL_BEGIN_TEST("Batch transforms", "[RaychelMath][Transform]")
+
+    const Transform t{vec3{1, -2, 0.5}, rotate_around(vec3{0.3, 1, -2}, TestType(1.1))};
+    const CompiledTransform c{t};
+
+    std::vector<vec3> points;
+    for (int i = 0; i != 17; ++i) {
+        points.push_back(vec3{i, 3 - i, i * i});
+    }
+
+    std::vector<vec3> out(points.size());
+    apply_points(c, std::span<const vec3>{points}, std::span{out});
+    for (std::size_t i{0}; i != points.size(); ++i) {
+        REQUIRE(vec_equivalent(out[i], apply(t, points[i])));
+    }
+
+    inverse_apply_points(c, std::span<const vec3>{out}, std::span{out});
+    for (std::size_t i{0}; i != points.size(); ++i) {
+        REQUIRE(vec_equivalent(out[i], points[i]));
+    }
+
+    apply_directions(c, std::span<const vec3>{points}, std::span{out});
+    for (std::size_t i{0}; i != points.size(); ++i) {
+        REQUIRE(vec_equivalent(out[i], apply_direction(c, points[i])));
+    }
+
+    inverse_apply_directions(c, std::span<const vec3>{out}, std::span{out});
+    for (std::size_t i{0}; i != points.size(); ++i) {
+        REQUIRE(vec_equivalent(out[i], points[i]));
+    }
+
+    const TupleSoA<TestType, 3, Vec3Tag> soa{std::span<const vec3>{points}};
+    TupleSoA<TestType, 3, Vec3Tag> soa_out{};
+
+    apply_points(c, soa, soa_out);
+    REQUIRE(soa_out.size() == points.size());
+    for (std::size_t i{0}; i != points.size(); ++i) {
+        REQUIRE(vec_equivalent(soa_out[i].load(), apply(t, points[i])));
+    }
+
+    inverse_apply_points(c, soa_out, soa_out);
+    for (std::size_t i{0}; i != points.size(); ++i) {
+        REQUIRE(vec_equivalent(soa_out[i].load(), points[i]));
+    }
+
+    apply_directions(c, soa, soa_out);
+    inverse_apply_directions(c, soa_out, soa_out);
+    for (std::size_t i{0}; i != points.size(); ++i) {
+        REQUIRE(vec_equivalent(soa_out[i].load(), points[i]));
+    }
+
+RAYCHEL_END_TEST
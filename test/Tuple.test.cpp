@@ -295,4 +295,45 @@ RAYCHEL_BEGIN_TEST("Tuple swizzle", "[RaychelMath][Tuple]")
     }
 RAYCHEL_END_TEST
 
+TEMPLATE_PRODUCT_TEST_CASE("Tuple operators match the scalar implementation", "[RaychelMath][Tuple]", std::tuple, ((float, std::integral_constant<std::size_t, 2>), (float, std::integral_constant<std::size_t, 3>), (float, std::integral_constant<std::size_t, 4>), (float, std::integral_constant<std::size_t, 8>), (double, std::integral_constant<std::size_t, 2>), (double, std::integral_constant<std::size_t, 3>), (double, std::integral_constant<std::size_t, 4>), (double, std::integral_constant<std::size_t, 8>)))
+{
+    using T = std::tuple_element_t<0, TestType>;
+    constexpr auto N = std::tuple_element_t<1, TestType>::value;
+    using Tuple = Raychel::Tuple<T, N>;
+
+    Tuple a{};
+    Tuple b{};
+    for (std::size_t i{0}; i != N; ++i) {
+        a[i] = static_cast<T>(i) * T(1.5) - T(2);
+        b[i] = static_cast<T>(N - i) * T(0.25);
+    }
+
+    Tuple sum{a};
+    sum += b;
+    Tuple diff{a};
+    diff -= b;
+    Tuple prod{a};
+    prod *= T(3.5);
+    Tuple quot{a};
+    quot /= T(3);
+
+    for (std::size_t i{0}; i != N; ++i) {
+        REQUIRE(sum[i] == a[i] + b[i]);
+        REQUIRE(diff[i] == a[i] - b[i]);
+        REQUIRE(prod[i] == a[i] * T(3.5));
+        REQUIRE(quot[i] == a[i] / T(3));
+    }
+
+    REQUIRE(a == a);
+    REQUIRE(a != b);
+
+    Tuple c{a};
+    c[N - 1] = c[N - 1] + T(1);
+    REQUIRE(a != c);
+
+    if constexpr ((sizeof(T) * N) <= 16 && (N & (N - 1)) == 0) {
+        STATIC_REQUIRE(alignof(Tuple) == sizeof(T) * N);
+    }
+}
+
 // clang-format on
@@ -0,0 +1,134 @@
+#include "RaychelMath/TupleExpression.h"
+#include "RaychelMath/equivalent.h"
+#include "RaychelMath/vec3.h"
+#include "RaychelMath/vector.h"
+
+#include "catch2/catch.hpp"
+
+#include <ostream>
+
+#define RAYCHEL_EXPRESSION_TEST_TYPES int, float, double, long double
+
+#define RAYCHEL_BEGIN_TEST(test_name, test_tag)                                                                                  \
+    TEMPLATE_TEST_CASE(test_name, test_tag, RAYCHEL_EXPRESSION_TEST_TYPES)                                                       \
+    {                                                                                                                            \
+        using namespace Raychel;                                                                                                 \
+        using vec3 = basic_vec3<TestType>;
+
+#define RAYCHEL_END_TEST }
+
+namespace {
+
+    //Satisfies Raychel::Arithmetic without being a built-in arithmetic type
+    struct Scalar
+    {
+        double value{0};
+
+        friend constexpr Scalar operator+(Scalar a, Scalar b) noexcept { return Scalar{a.value + b.value}; }
+        friend constexpr Scalar operator-(Scalar a, Scalar b) noexcept { return Scalar{a.value - b.value}; }
+        friend constexpr Scalar operator*(Scalar a, Scalar b) noexcept { return Scalar{a.value * b.value}; }
+        friend constexpr Scalar operator/(Scalar a, Scalar b) noexcept { return Scalar{a.value / b.value}; }
+        friend constexpr bool operator==(Scalar a, Scalar b) noexcept = default;
+
+        friend std::ostream& operator<<(std::ostream& os, Scalar s) { return os << s.value; }
+    };
+
+} // namespace
+
+//clang-format doesn't like these macros
+// clang-format off
+
+RAYCHEL_BEGIN_TEST("Evaluating tuple expressions", "[RaychelMath][TupleExpression]")
+
+    const vec3 a{1, 2, 3};
+    const vec3 b{4, 5, 6};
+
+    {
+        const vec3 r = lazy(a) + b;
+        REQUIRE(r == a + b);
+    }
+
+    {
+        const vec3 r = a - lazy(b);
+        REQUIRE(r == a - b);
+    }
+
+    {
+        const vec3 r = lazy(a) * 2 + lazy(b) * 3 - a;
+        REQUIRE(r == (a * 2) + (b * 3) - a);
+    }
+
+    {
+        const vec3 r = 2 * (lazy(b) - a) / 3;
+        REQUIRE(r == ((b - a) * 2) / 3);
+    }
+
+    {
+        const auto r = eval(lazy(a) + vec3{1, 1, 1});
+        STATIC_REQUIRE(std::is_same_v<std::remove_cv_t<decltype(r)>, vec3>);
+        REQUIRE(r == vec3{2, 3, 4});
+    }
+
+    if constexpr (std::is_signed_v<TestType>) {
+        const vec3 r = -lazy(a) + b;
+        REQUIRE(r == b - a);
+    }
+
+    REQUIRE(dot(lazy(a) + b, lazy(a)) == dot(a + b, a));
+
+    //Expressions can be materialized into tuples with a compatible tag
+    const Tuple<TestType, 3> t = lazy(a) + b;
+    REQUIRE(t == Tuple<TestType, 3>{5, 7, 9});
+
+RAYCHEL_END_TEST
+
+RAYCHEL_BEGIN_TEST("Constexpr tuple expressions", "[RaychelMath][TupleExpression]")
+
+    constexpr vec3 a{1, 2, 3};
+    constexpr vec3 b{4, 5, 6};
+
+    constexpr vec3 r = lazy(a) * 2 + b;
+    STATIC_REQUIRE(r == vec3{6, 9, 12});
+
+    constexpr auto d = dot(lazy(a), b);
+    STATIC_REQUIRE(d == 32);
+
+RAYCHEL_END_TEST
+
+TEMPLATE_TEST_CASE("Expression lerp and reflect", "[RaychelMath][TupleExpression]", float, double, long double)
+{
+    using namespace Raychel;
+    using vec3 = basic_vec3<TestType>;
+
+    const vec3 a{1, -2, 3};
+    const vec3 b{-4, 5, 0.5};
+    const TestType x = 0.3;
+
+    const vec3 l = lazy(b) * x + lazy(a) * (1 - x);
+    const auto expected_l = lerp(a, b, x);
+    REQUIRE(equivalent<TestType>(l[0], expected_l[0]));
+    REQUIRE(equivalent<TestType>(l[1], expected_l[1]));
+    REQUIRE(equivalent<TestType>(l[2], expected_l[2]));
+
+    const auto n = normalize(vec3{1, 1, 0});
+    const vec3 r = lazy(a) - lazy(n) * (2 * dot(a, n));
+    const auto expected_r = reflect(a, n);
+    REQUIRE(equivalent<TestType>(r[0], expected_r[0]));
+    REQUIRE(equivalent<TestType>(r[1], expected_r[1]));
+    REQUIRE(equivalent<TestType>(r[2], expected_r[2]));
+}
+
+TEST_CASE("User-defined scalars in tuple expressions", "[RaychelMath][TupleExpression]")
+{
+    using namespace Raychel;
+    using tuple = Tuple<Scalar, 3>;
+
+    const tuple a{Scalar{1}, Scalar{2}, Scalar{3}};
+    const tuple b{Scalar{4}, Scalar{5}, Scalar{6}};
+
+    const tuple r = lazy(a) * Scalar{2} + lazy(b) / Scalar{2};
+    REQUIRE(r == tuple{Scalar{4}, Scalar{6.5}, Scalar{9}});
+
+    const tuple l = Scalar{3} * (lazy(b) - a);
+    REQUIRE(l == tuple{Scalar{9}, Scalar{9}, Scalar{9}});
+}
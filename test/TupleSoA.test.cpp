@@ -0,0 +1,156 @@
+#include "RaychelMath/TupleSoA.h"
+#include "RaychelMath/equivalent.h"
+#include "RaychelMath/vec3.h"
+
+#include "catch2/catch.hpp"
+
+#include "fastmath_policy.h"
+
+#include <vector>
+
+#define RAYCHEL_SOA_TEST_TYPES int, float, double, long double
+#define RAYCHEL_SOA_FLOATING_TYPES float, double, long double
+
+#define RAYCHEL_BEGIN_TEST(test_name, test_tag)                                                                                  \
+    TEMPLATE_TEST_CASE(test_name, test_tag, RAYCHEL_SOA_TEST_TYPES)                                                              \
+    {                                                                                                                            \
+        using namespace Raychel;                                                                                                 \
+        using vec3 = basic_vec3<TestType>;                                                                                       \
+        using SoA = TupleSoA<TestType, 3, Vec3Tag>;
+
+#define RAYCHEL_END_TEST }
+
+//clang-format doesn't like these macros
+// clang-format off
+
+RAYCHEL_BEGIN_TEST("Creating SoA containers", "[RaychelMath][TupleSoA]")
+
+    {
+        const SoA soa{};
+        REQUIRE(soa.size() == 0);
+        REQUIRE(soa.empty());
+    }
+
+    {
+        const SoA soa(12);
+        REQUIRE(soa.size() == 12);
+        for (std::size_t i{0}; i != 3; ++i) {
+            REQUIRE(soa.lane(i).size() == 12);
+        }
+        REQUIRE(soa[7].load() == vec3{});
+    }
+
+    {
+        SoA soa{};
+        soa.push_back(vec3{1, 2, 3});
+        soa.push_back(vec3{4, 5, 6});
+
+        REQUIRE(soa.size() == 2);
+        REQUIRE(soa.lane(0)[1] == 4);
+        REQUIRE(soa.lane(1)[0] == 2);
+        REQUIRE(soa.lane(2)[1] == 6);
+    }
+
+RAYCHEL_END_TEST
+
+RAYCHEL_BEGIN_TEST("SoA round trip", "[RaychelMath][TupleSoA]")
+
+    const std::vector<vec3> values{vec3{1, 2, 3}, vec3{4, 5, 6}, vec3{7, 8, 9}};
+
+    const SoA soa{std::span<const vec3>{values}};
+    REQUIRE(soa.size() == 3);
+    REQUIRE(soa.lane(0)[2] == 7);
+    REQUIRE(soa.lane(2)[0] == 3);
+
+    std::vector<vec3> out(3);
+    soa.store(std::span{out});
+    REQUIRE(out == values);
+
+    REQUIRE(soa.to_aos() == values);
+
+RAYCHEL_END_TEST
+
+RAYCHEL_BEGIN_TEST("SoA element proxies", "[RaychelMath][TupleSoA]")
+
+    SoA soa(2);
+
+    soa[0] = vec3{1, 2, 3};
+    REQUIRE(soa[0][0] == 1);
+    REQUIRE(soa[0].template get<2>() == 3);
+
+    soa[1] = soa[0];
+    soa[1] += vec3{1, 1, 1};
+    REQUIRE(soa[1].load() == vec3{2, 3, 4});
+    REQUIRE(soa[0].load() == vec3{1, 2, 3});
+
+    soa[1] *= 2;
+    const vec3 v = soa[1];
+    REQUIRE(v == vec3{4, 6, 8});
+
+    soa[1] -= vec3{4, 6, 8};
+    REQUIRE(soa[1].load() == vec3{});
+
+    soa[0][1] = 12;
+    REQUIRE(soa.lane(1)[0] == 12);
+
+RAYCHEL_END_TEST
+
+RAYCHEL_BEGIN_TEST("SoA bulk arithmetic", "[RaychelMath][TupleSoA]")
+
+    const std::vector<vec3> a_values{vec3{1, 2, 3}, vec3{4, 5, 6}};
+    const std::vector<vec3> b_values{vec3{2, 2, 2}, vec3{1, 0, 1}};
+
+    const SoA a{std::span<const vec3>{a_values}};
+    const SoA b{std::span<const vec3>{b_values}};
+
+    const auto sum = a + b;
+    REQUIRE(sum[0].load() == vec3{3, 4, 5});
+    REQUIRE(sum[1].load() == vec3{5, 5, 7});
+
+    const auto diff = a - b;
+    REQUIRE(diff[0].load() == a_values[0] - b_values[0]);
+    REQUIRE(diff[1].load() == a_values[1] - b_values[1]);
+
+    const auto scaled = a * 2;
+    REQUIRE(scaled[1].load() == vec3{8, 10, 12});
+    REQUIRE((2 * a)[1].load() == vec3{8, 10, 12});
+
+    const auto divided = scaled / 2;
+    REQUIRE(divided.to_aos() == a_values);
+
+    const auto d = dot(a, b);
+    REQUIRE(d.size() == 2);
+    REQUIRE(d[0] == dot(a_values[0], b_values[0]));
+    REQUIRE(d[1] == dot(a_values[1], b_values[1]));
+
+    REQUIRE(mag_sq(a)[1] == mag_sq(a_values[1]));
+
+    const auto c = cross(a, b);
+    REQUIRE(c[0].load() == cross(a_values[0], b_values[0]));
+    REQUIRE(c[1].load() == cross(a_values[1], b_values[1]));
+
+RAYCHEL_END_TEST
+
+TEMPLATE_TEST_CASE("SoA magnitude and normalization", "[RaychelMath][TupleSoA]", RAYCHEL_SOA_FLOATING_TYPES)
+{
+    using namespace Raychel;
+    using vec3 = basic_vec3<TestType>;
+    using SoA = TupleSoA<TestType, 3, Vec3Tag>;
+
+    const std::vector<vec3> values{vec3{1, 2, 2}, vec3{12, 15, 16}, vec3{0, 0, 4}};
+    const SoA soa{std::span<const vec3>{values}};
+
+    const auto m = mag(soa);
+    REQUIRE(m[0] == 3);
+    REQUIRE(m[1] == 25);
+    REQUIRE(m[2] == 4);
+
+    const auto n = normalize(soa);
+    for (std::size_t i{0}; i != values.size(); ++i) {
+        const auto expected = normalize(values[i]);
+        const vec3 actual = n[i];
+        REQUIRE(test::policy_equivalent<TestType>(actual[0], expected[0]));
+        REQUIRE(test::policy_equivalent<TestType>(actual[1], expected[1]));
+        REQUIRE(test::policy_equivalent<TestType>(actual[2], expected[2]));
+    }
+}
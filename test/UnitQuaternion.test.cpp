@@ -0,0 +1,96 @@
+#include "RaychelMath/UnitQuaternion.h"
+#include "RaychelMath/equivalent.h"
+
+#include "catch2/catch.hpp"
+
+#include "fastmath_policy.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#define RAYCHEL_UNIT_QUATERNION_TEST_TYPES float, double, long double
+
+#define RAYCHEL_BEGIN_TEST(test_name, test_tag)                                                                                  \
+    TEMPLATE_TEST_CASE(test_name, test_tag, RAYCHEL_UNIT_QUATERNION_TEST_TYPES)                                                  \
+    {                                                                                                                            \
+        using namespace Raychel;                                                                                                 \
+        using vec3 = basic_vec3<TestType>;                                                                                       \
+        using Quaternion = basic_quaternion<TestType>;                                                                           \
+        using UnitQuaternion = basic_unit_quaternion<TestType>;
+
+#define RAYCHEL_END_TEST }
+
+//clang-format doesn't like these macros
+// clang-format off
+
+namespace {
+    template <typename T>
+    bool vec_equivalent(const Raychel::basic_vec3<T>& a, const Raychel::basic_vec3<T>& b)
+    {
+        constexpr T margin = std::numeric_limits<T>::epsilon() * 64 + Raychel::test::policy_margin<T>;
+        for (std::size_t i{0}; i != 3; ++i) {
+            if (std::abs(a[i] - b[i]) > margin * std::max<T>(1, std::abs(b[i]))) {
+                return false;
+            }
+        }
+        return true;
+    }
+} // namespace
+
+RAYCHEL_BEGIN_TEST("Creating unit quaternions", "[RaychelMath][UnitQuaternion]")
+
+    constexpr UnitQuaternion identity{};
+    STATIC_REQUIRE(identity[0] == 1);
+    STATIC_REQUIRE(identity[1] == 0);
+
+    const UnitQuaternion q{Quaternion{1, 5, -7, 4}};
+    REQUIRE(test::policy_equivalent<TestType>(mag(q.quaternion()), 1));
+
+    const auto r = unit_rotate_around(vec3{0, 0, 2}, half_pi<TestType>);
+    REQUIRE(r.quaternion() == rotate_around(vec3{0, 0, 2}, half_pi<TestType>));
+
+    const Quaternion& as_quaternion = r;
+    REQUIRE(as_quaternion == r.quaternion());
+
+RAYCHEL_END_TEST
+
+RAYCHEL_BEGIN_TEST("Unit quaternion rotation", "[RaychelMath][UnitQuaternion]")
+
+    const Quaternion raw{0.3, -1.2, 0.7, 2};
+    const UnitQuaternion q{raw};
+    const vec3 v{3, -1, 2};
+
+    REQUIRE(vec_equivalent(v * q, v * raw));
+    REQUIRE(vec_equivalent(v * UnitQuaternion{}, v));
+
+    const auto r = unit_rotate_around(vec3{0, 0, 1}, half_pi<TestType>);
+    REQUIRE(vec_equivalent(vec3{1, 0, 0} * r, vec3{0, 1, 0}));
+
+    REQUIRE(vec_equivalent((v * q) * inverse(q), v));
+    REQUIRE(vec_equivalent(mat3_from_quaternion(q) * v, v * q));
+
+RAYCHEL_END_TEST
+
+RAYCHEL_BEGIN_TEST("Unit quaternion composition", "[RaychelMath][UnitQuaternion]")
+
+    const auto a = unit_rotate_around(vec3{1, 2, 3}, TestType(0.4));
+    const auto b = unit_rotate_around(vec3{-1, 0, 1}, TestType(1.3));
+    const vec3 v{1, 1, -2};
+
+    const Quaternion product = a.quaternion() * b.quaternion();
+    REQUIRE(vec_equivalent(v * (a * b), v * product));
+    REQUIRE(vec_equivalent(v * ((a * b) / b), v * a));
+
+    //drift stays bounded when composing many times
+    auto q = UnitQuaternion{};
+    const auto step = unit_rotate_around(vec3{0.3, 1, 0.2}, TestType(0.001));
+    for (int i = 0; i != 10'000; ++i) {
+        q *= step;
+    }
+    REQUIRE(std::abs(mag_sq(q.quaternion()) - 1) < std::numeric_limits<TestType>::epsilon() * 16);
+
+    const auto renormalized = renormalize(UnitQuaternion::from_normalized(a.quaternion() * TestType(1.0001)));
+    REQUIRE(std::abs(mag_sq(renormalized.quaternion()) - 1) < TestType(1e-6));
+
+RAYCHEL_END_TEST
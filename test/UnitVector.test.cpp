@@ -0,0 +1,123 @@
+#include "RaychelMath/UnitVector.h"
+#include "RaychelMath/equivalent.h"
+
+#include "catch2/catch.hpp"
+
+#include "fastmath_policy.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#define RAYCHEL_UNIT_VECTOR_TEST_TYPES float, double, long double
+
+#define RAYCHEL_BEGIN_TEST(test_name, test_tag)                                                                                  \
+    TEMPLATE_TEST_CASE(test_name, test_tag, RAYCHEL_UNIT_VECTOR_TEST_TYPES)                                                      \
+    {                                                                                                                            \
+        using namespace Raychel;                                                                                                 \
+        using vec3 = basic_vec3<TestType>;                                                                                       \
+        using UnitVec3 = basic_unit_vec3<TestType>;
+
+#define RAYCHEL_END_TEST }
+
+//clang-format doesn't like these macros
+// clang-format off
+
+namespace {
+    template <typename T>
+    bool vec_equivalent(const Raychel::basic_vec3<T>& a, const Raychel::basic_vec3<T>& b)
+    {
+        constexpr T margin = std::numeric_limits<T>::epsilon() * 64 + Raychel::test::policy_margin<T>;
+        for (std::size_t i{0}; i != 3; ++i) {
+            if (std::abs(a[i] - b[i]) > margin * std::max<T>(1, std::abs(b[i]))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename T>
+    bool is_unit(const Raychel::basic_vec3<T>& v)
+    {
+        return std::abs(Raychel::mag_sq(v) - 1) < std::numeric_limits<T>::epsilon() * 16 + Raychel::test::policy_margin<T>;
+    }
+} // namespace
+
+RAYCHEL_BEGIN_TEST("Creating unit vectors", "[RaychelMath][UnitVector]")
+
+    constexpr UnitVec3 up{};
+    STATIC_REQUIRE(up.y() == 1);
+    STATIC_REQUIRE(up.x() == 0);
+
+    const UnitVec3 v{vec3{3, 0, 4}};
+    REQUIRE(vec_equivalent(v.vector(), vec3{3, 0, 4} / TestType(5)));
+    REQUIRE(is_unit(v.vector()));
+
+    const auto w = UnitVec3::from_normalized(vec3{0, 0, -1});
+    REQUIRE(w.z() == -1);
+    REQUIRE((-w).z() == 1);
+
+    const vec3& as_vector = v;
+    REQUIRE(as_vector == v.vector());
+    REQUIRE(dot(v, w) == dot(v.vector(), w.vector()));
+
+RAYCHEL_END_TEST
+
+RAYCHEL_BEGIN_TEST("Unit vector basis", "[RaychelMath][UnitVector]")
+
+    const vec3 normals[] = {vec3{0, 1, 0}, vec3{0, 0, 1}, vec3{0, 0, -1}, vec3{1, 2, 3}, vec3{-4, 0.5, -0.1}, vec3{0.001, -1, 0.002}};
+
+    for (const auto& raw : normals) {
+        const UnitVec3 n{raw};
+        const auto [i, j, k] = get_basis_vectors(n);
+
+        REQUIRE(j == n.vector());
+        REQUIRE(is_unit(i));
+        REQUIRE(is_unit(k));
+        REQUIRE(std::abs(dot(i, j)) < std::numeric_limits<TestType>::epsilon() * 16 + test::policy_margin<TestType>);
+        REQUIRE(std::abs(dot(j, k)) < std::numeric_limits<TestType>::epsilon() * 16 + test::policy_margin<TestType>);
+        REQUIRE(std::abs(dot(i, k)) < std::numeric_limits<TestType>::epsilon() * 16 + test::policy_margin<TestType>);
+
+        //same handedness as the vec3 overload
+        REQUIRE(vec_equivalent(cross(j, k), i));
+        REQUIRE(get_tangent(n).vector() == k);
+    }
+
+RAYCHEL_END_TEST
+
+RAYCHEL_BEGIN_TEST("Unit vector rotation and reflection", "[RaychelMath][UnitVector]")
+
+    const UnitVec3 axis{vec3{1, -2, 0.5}};
+    const auto q = rotate_around(axis, TestType(0.7));
+    REQUIRE(test::policy_equivalent<TestType>(mag_sq(q.quaternion()), 1));
+
+    const UnitVec3 v{vec3{0.2, 0.4, -1}};
+    REQUIRE(vec_equivalent(v.vector() * q.quaternion(), v.vector() * rotate_around(axis.vector(), TestType(0.7))));
+    const UnitVec3 rotated = v * q;
+    REQUIRE(vec_equivalent(rotated.vector(), v.vector() * q.quaternion()));
+
+    const auto n = UnitVec3::from_normalized(vec3{0, 1, 0});
+    const UnitVec3 reflected = reflect(v, n);
+    REQUIRE(vec_equivalent(reflected.vector(), vec3{v.x(), -v.y(), v.z()}));
+    REQUIRE(reflect(vec3{1, -1, 0}, n) == vec3{1, 1, 0});
+
+RAYCHEL_END_TEST
+
+RAYCHEL_BEGIN_TEST("Random directions around unit normals", "[RaychelMath][UnitVector]")
+
+    TestType state = 0.1;
+    const auto rng = [&state] {
+        state = std::fmod(state + TestType(0.618034), TestType(1));
+        return state;
+    };
+
+    const UnitVec3 n{vec3{1, 1, 0}};
+    REQUIRE(get_random_direction_on_cone_angle(n, TestType(0), rng) == n);
+
+    for (int i = 0; i < 32; ++i) {
+        const auto d = get_random_direction_on_cone_angle(n, TestType(0.5), rng);
+        REQUIRE(std::abs(mag_sq(d.vector()) - 1) < std::numeric_limits<TestType>::epsilon() * 32 + test::policy_margin<TestType>);
+        REQUIRE(dot(d, n) >= std::cos(TestType(0.5)) - TestType(1e-5));
+    }
+
+RAYCHEL_END_TEST
@@ -1,6 +1,9 @@
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <limits>
 #include <type_traits>
+#include <vector>
 #include "catch2/catch.hpp"
 
 #include "RaychelMath/color.h"
@@ -312,3 +315,123 @@ RAYCHEL_BEGIN_TEST("Color from temperature", "[RaychelMath][ColorRGB]")
     expect_color(60'000, c{151, 185, 255});
 
 RAYCHEL_END_TEST
+
+TEMPLATE_TEST_CASE("Color from temperature lookup table", "[RaychelMath][ColorRGB]", float, double)
+{
+    using namespace Raychel;
+
+    //the table is built at compile time and matches the exact function
+    static_assert(color_from_temperature_lut<TestType>(TestType(1'000)).r() == 1);
+    static_assert(color_from_temperature<TestType>(6'600) == basic_color<TestType>{1, 1, 1});
+
+    //the bounds documented for the default resolution
+    for (std::uint32_t kelvin = 0; kelvin <= 45'000; ++kelvin) {
+        const auto exact = color_from_temperature<TestType>(kelvin);
+        const auto curve = details::temperature_curve(std::clamp(kelvin, 1'000U, 40'000U) / 100.) / 255.;
+        const auto approx = color_from_temperature_lut<TestType>(static_cast<TestType>(kelvin));
+        for (std::size_t i{0}; i != 3; ++i) {
+            REQUIRE(std::abs(exact[i] - approx[i]) <= TestType(1.2) / 255);
+            REQUIRE(std::abs(curve[i] - approx[i]) <= 0.6 / 255);
+        }
+    }
+
+    //NaN is looked up as the lowest temperature instead of indexing out of the table
+    REQUIRE(color_from_temperature_lut<TestType>(std::numeric_limits<TestType>::quiet_NaN()) == color_from_temperature_lut<TestType>(TestType(1'000)));
+
+    std::vector<TestType> temperatures{500, 1'000, 1'900, 6'600, 6'601, 12'345.5, 40'000, 1e6};
+    std::vector<basic_color<TestType>> colors(temperatures.size());
+    color_from_temperature_lut<TestType>(temperatures, colors);
+    for (std::size_t i{0}; i != temperatures.size(); ++i) {
+        REQUIRE(colors[i] == color_from_temperature_lut<TestType>(temperatures[i]));
+    }
+
+    //higher resolutions are closer to the curve
+    const auto coarse = basic_temperature_lut<TestType, 16>{}(TestType(3'000));
+    const auto fine = basic_temperature_lut<TestType, 1024>{}(TestType(3'000));
+    const auto curve = details::temperature_curve(30) / 255.;
+    REQUIRE(std::abs(fine[1] - curve[1]) < std::abs(coarse[1] - curve[1]));
+}
+
+TEMPLATE_TEST_CASE("Batch color conversion", "[RaychelMath][ColorRGB]", float, double)
+{
+    using namespace Raychel;
+    using u8 = std::uint8_t;
+    using u16 = std::uint16_t;
+
+    //odd sizes so both the vector loops and the scalar tails run
+    std::vector<basic_color<TestType>> colors;
+    for (int i = 0; i != 101; ++i) {
+        const auto x = static_cast<TestType>(i - 10) / TestType(80);
+        colors.emplace_back(x, TestType(1) - x, x * x);
+    }
+    colors.emplace_back(std::numeric_limits<TestType>::quiet_NaN(), TestType(0.5), TestType(1.0) / 510);
+
+    const auto expected_channel = [](TestType x, long max) -> long {
+        if (std::isnan(x)) {
+            return 0;
+        }
+        return std::lround(std::clamp<TestType>(x, 0, 1) * static_cast<TestType>(max));
+    };
+
+    std::vector<basic_color<u8>> colors_u8(colors.size());
+    std::vector<basic_color<u16>> colors_u16(colors.size());
+    convert_colors<u8, TestType>(colors, colors_u8);
+    convert_colors<u16, TestType>(colors, colors_u16);
+    for (std::size_t i{0}; i != colors.size(); ++i) {
+        for (std::size_t c{0}; c != 3; ++c) {
+            REQUIRE(colors_u8[i][c] == expected_channel(colors[i][c], 255));
+            REQUIRE(colors_u16[i][c] == expected_channel(colors[i][c], 65'535));
+        }
+    }
+
+    std::vector<basic_color<TestType>> back(colors.size());
+    convert_colors<TestType, u8>(colors_u8, back);
+    for (std::size_t i{0}; i != colors.size(); ++i) {
+        REQUIRE(back[i] == convert_color<TestType>(colors_u8[i]));
+    }
+    convert_colors<TestType, u16>(colors_u16, back);
+    for (std::size_t i{0}; i != colors.size(); ++i) {
+        REQUIRE(back[i] == convert_color<TestType>(colors_u16[i]));
+    }
+
+    std::vector<u8> rgb(colors.size() * 3);
+    std::vector<u8> rgba(colors.size() * 4);
+    pack_rgb8<TestType>(colors, rgb);
+    pack_rgba8<TestType>(colors, rgba, 17);
+    for (std::size_t i{0}; i != colors.size(); ++i) {
+        for (std::size_t c{0}; c != 3; ++c) {
+            REQUIRE(rgb[(i * 3) + c] == colors_u8[i][c]);
+            REQUIRE(rgba[(i * 4) + c] == colors_u8[i][c]);
+        }
+        REQUIRE(rgba[(i * 4) + 3] == 17);
+    }
+}
+
+TEST_CASE("Batch integer color rescaling", "[RaychelMath][ColorRGB]")
+{
+    using namespace Raychel;
+    using u8 = std::uint8_t;
+    using u16 = std::uint16_t;
+
+    std::vector<basic_color<u16>> wide;
+    for (long v = 0; v < 65'536; v += 3) {
+        wide.emplace_back(static_cast<u16>(v), static_cast<u16>(v + 1), static_cast<u16>(v + 2));
+    }
+
+    std::vector<basic_color<u8>> narrow(wide.size());
+    convert_colors<u8, u16>(wide, narrow);
+    for (std::size_t i{0}; i != wide.size(); ++i) {
+        for (std::size_t c{0}; c != 3; ++c) {
+            REQUIRE(narrow[i][c] == std::lround(wide[i][c] / 257.0));
+        }
+    }
+
+    std::vector<basic_color<u16>> widened(narrow.size());
+    convert_colors<u16, u8>(narrow, widened);
+    for (std::size_t i{0}; i != narrow.size(); ++i) {
+        for (std::size_t c{0}; c != 3; ++c) {
+            REQUIRE(widened[i][c] == narrow[i][c] * 257);
+        }
+    }
+}
+
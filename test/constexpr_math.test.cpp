@@ -0,0 +1,113 @@
+#include "RaychelMath/Quaternion.h"
+#include "RaychelMath/UnitVector.h"
+#include "RaychelMath/constants.h"
+#include "RaychelMath/constexpr_math.h"
+#include "RaychelMath/vector.h"
+
+#include "catch2/catch.hpp"
+
+#include "fastmath_policy.h"
+#include "helpers.h"
+
+#include <cmath>
+#include <limits>
+#include <random>
+
+#define RAYCHEL_CONSTEXPR_MATH_TEST_TYPES float, double
+
+#define RAYCHEL_BEGIN_TEST(test_name, test_tag)                                                                                  \
+    TEMPLATE_TEST_CASE(test_name, test_tag, RAYCHEL_CONSTEXPR_MATH_TEST_TYPES)                                                   \
+    {                                                                                                                            \
+        using namespace Raychel;
+
+#define RAYCHEL_END_TEST }
+
+//clang-format doesn't like these macros
+// clang-format off
+
+namespace {
+
+    using Raychel::test::Error;
+    using Raychel::test::max_error;
+    using Raychel::test::ulp_error;
+
+    //Everything below has to be usable in constant expressions
+    constexpr auto unit_vec = Raychel::normalize(Raychel::basic_vec3<double>{1, 2, 2});
+    static_assert(Raychel::mag(Raychel::basic_vec3<double>{3, 4, 12}) == 13);
+    static_assert(unit_vec[0] > 0.3333333 && unit_vec[0] < 0.3333334);
+
+    constexpr auto rotation = Raychel::rotate_around(Raychel::basic_vec3<float>{0, 0, 2}, Raychel::half_pi<float>);
+    constexpr auto rotated = Raychel::basic_vec3<float>{1, 0, 0} * rotation;
+    static_assert(rotated[1] > 0.999999F && rotated[0] < 1e-6F && rotated[0] > -1e-6F);
+
+    constexpr auto basis = Raychel::get_basis_vectors(Raychel::basic_unit_vec3<double>{Raychel::basic_vec3<double>{0.2, 1, 0.3}});
+    static_assert(Raychel::dot(basis[0], basis[2]) < 1e-15 && Raychel::dot(basis[0], basis[2]) > -1e-15);
+
+    static_assert(Raychel::constexpr_sqrt(2.0) == 1.4142135623730951);
+    static_assert(Raychel::constexpr_sin(Raychel::pi_v<double>) < 1.3e-16);
+
+} // namespace
+
+RAYCHEL_BEGIN_TEST("constexpr square root", "[RaychelMath][ConstexprMath]")
+
+    const auto ref = [](TestType x) { return std::sqrt(x); };
+    REQUIRE(max_error<TestType>([](TestType x) { return constexpr_sqrt(x); }, ref, -120, 120, Error::ulp, true) <= 1);
+
+    REQUIRE(constexpr_sqrt(TestType(0)) == 0);
+    REQUIRE(constexpr_sqrt(TestType(16)) == 4);
+    REQUIRE(constexpr_sqrt(std::numeric_limits<TestType>::infinity()) == std::numeric_limits<TestType>::infinity());
+    REQUIRE(std::isnan(constexpr_sqrt(TestType(-1))));
+    REQUIRE(ulp_error(constexpr_sqrt(std::numeric_limits<TestType>::denorm_min()), std::sqrt(std::numeric_limits<TestType>::denorm_min())) <= 1);
+
+RAYCHEL_END_TEST
+
+RAYCHEL_BEGIN_TEST("constexpr sine and cosine", "[RaychelMath][ConstexprMath]")
+
+    //Errors are absolute around the zeros, so compare against the long double result
+    std::mt19937 rng{42};
+    std::uniform_real_distribution<double> dist{-1000, 1000};
+    for (int i = 0; i < 20'000; ++i) {
+        const auto x = static_cast<TestType>(dist(rng));
+        const auto [s, c] = constexpr_sincos(x);
+        REQUIRE(std::abs(s - std::sin(static_cast<long double>(x))) <= std::numeric_limits<TestType>::epsilon());
+        REQUIRE(std::abs(c - std::cos(static_cast<long double>(x))) <= std::numeric_limits<TestType>::epsilon());
+    }
+
+    REQUIRE(constexpr_sin(TestType(0)) == 0);
+    REQUIRE(constexpr_cos(TestType(0)) == 1);
+    REQUIRE(std::isnan(constexpr_sin(std::numeric_limits<TestType>::infinity())));
+
+RAYCHEL_END_TEST
+
+RAYCHEL_BEGIN_TEST("constexpr exponential, logarithm and power", "[RaychelMath][ConstexprMath]")
+
+    REQUIRE(max_error<TestType>([](TestType x) { return constexpr_exp(x); }, [](TestType x) { return std::exp(x); }, -80, 80, Error::ulp) <= 1);
+    REQUIRE(max_error<TestType>([](TestType x) { return constexpr_log(x); }, [](TestType x) { return std::log(x); }, -120, 120, Error::ulp, true) <= 1);
+    REQUIRE(max_error<TestType>([](TestType x) { return constexpr_pow(x, TestType(2.4)); }, [](TestType x) { return std::pow(x, TestType(2.4)); }, -20, 20, Error::ulp, true) <= 1);
+
+    constexpr auto inf = std::numeric_limits<TestType>::infinity();
+    REQUIRE(constexpr_exp(TestType(1000)) == inf);
+    REQUIRE(constexpr_exp(TestType(-1000)) == 0);
+    REQUIRE(constexpr_exp(TestType(0)) == 1);
+    REQUIRE(constexpr_log(TestType(1)) == 0);
+    REQUIRE(constexpr_log(TestType(0)) == -inf);
+    REQUIRE(std::isnan(constexpr_log(TestType(-1))));
+    REQUIRE(ulp_error(constexpr_log(std::numeric_limits<TestType>::denorm_min()), std::log(std::numeric_limits<TestType>::denorm_min())) <= 1);
+
+    REQUIRE(constexpr_pow(TestType(-2), TestType(3)) == -8);
+    REQUIRE(constexpr_pow(TestType(0), TestType(0)) == 1);
+    REQUIRE(constexpr_pow(TestType(0), TestType(-1)) == inf);
+    REQUIRE(std::isnan(constexpr_pow(TestType(-2), TestType(0.5))));
+
+RAYCHEL_END_TEST
+
+RAYCHEL_BEGIN_TEST("Runtime math is unaffected", "[RaychelMath][ConstexprMath]")
+
+    //Outside of constant evaluation the vector functions still use the std functions. With RAYCHELMATH_FASTMATH they
+    //use the approximations of that tier instead, so the result is only exact with the policy off
+    const basic_vec3<TestType> v{1, 3, 7};
+    REQUIRE(test::policy_equal(mag(v), std::sqrt(TestType(59))));
+
+RAYCHEL_END_TEST
+
+// clang-format on
@@ -0,0 +1,141 @@
+#include "RaychelMath/constants.h"
+#include "RaychelMath/fastmath.h"
+
+#include "catch2/catch.hpp"
+
+#include "helpers.h"
+
+#include <cmath>
+#include <limits>
+
+#define RAYCHEL_FASTMATH_TEST_TYPES float, double
+
+#define RAYCHEL_BEGIN_TEST(test_name, test_tag)                                                                                  \
+    TEMPLATE_TEST_CASE(test_name, test_tag, RAYCHEL_FASTMATH_TEST_TYPES)                                                         \
+    {                                                                                                                            \
+        using namespace Raychel;
+
+#define RAYCHEL_END_TEST }
+
+//clang-format doesn't like these macros
+// clang-format off
+
+namespace {
+
+    using Raychel::test::Error;
+    using Raychel::test::max_error;
+
+    template <typename T>
+    constexpr long double high_tolerance = std::is_same_v<T, float> ? 4e-7L : 4e-9L;
+
+} // namespace
+
+RAYCHEL_BEGIN_TEST("Fast reciprocal square root", "[RaychelMath][FastMath]")
+
+    const auto rsqrt_ref = [](long double x) { return 1.0L / std::sqrt(x); };
+    const auto sqrt_ref = [](long double x) { return std::sqrt(x); };
+
+    REQUIRE(max_error<TestType>([](TestType x) { return fast_rsqrt<FastMathPrecision::low>(x); }, rsqrt_ref, -60, 60, Error::relative, true) < 5e-6L);
+    REQUIRE(max_error<TestType>([](TestType x) { return fast_rsqrt(x); }, rsqrt_ref, -60, 60, Error::relative, true) < 3 * std::numeric_limits<TestType>::epsilon());
+    REQUIRE(max_error<TestType>([](TestType x) { return fast_sqrt<FastMathPrecision::low>(x); }, sqrt_ref, -60, 60, Error::relative, true) < 5e-6L);
+
+    REQUIRE(fast_sqrt<FastMathPrecision::low>(TestType(0)) == 0);
+    REQUIRE(fast_sqrt(TestType(2)) == std::sqrt(TestType(2)));
+
+RAYCHEL_END_TEST
+
+RAYCHEL_BEGIN_TEST("Fast sine and cosine", "[RaychelMath][FastMath]")
+
+    const auto sin_ref = [](long double x) { return std::sin(x); };
+    const auto cos_ref = [](long double x) { return std::cos(x); };
+
+    REQUIRE(max_error<TestType>([](TestType x) { return fast_sin<FastMathPrecision::low>(x); }, sin_ref, -100, 100, Error::absolute) < 4e-5L);
+    REQUIRE(max_error<TestType>([](TestType x) { return fast_cos<FastMathPrecision::low>(x); }, cos_ref, -100, 100, Error::absolute) < 4e-5L);
+    REQUIRE(max_error<TestType>([](TestType x) { return fast_sin(x); }, sin_ref, -100, 100, Error::absolute) < high_tolerance<TestType>);
+    REQUIRE(max_error<TestType>([](TestType x) { return fast_cos(x); }, cos_ref, -100, 100, Error::absolute) < high_tolerance<TestType>);
+
+    //every quadrant has the right sign
+    for (int quadrant = -8; quadrant != 8; ++quadrant) {
+        const auto x = (TestType(quadrant) + TestType(0.5)) * half_pi<TestType>;
+        const auto [s, c] = fast_sincos(x);
+        REQUIRE(std::signbit(s) == std::signbit(std::sin(x)));
+        REQUIRE(std::signbit(c) == std::signbit(std::cos(x)));
+    }
+
+    REQUIRE(fast_sin(TestType(0)) == 0);
+    REQUIRE(fast_cos(TestType(0)) == 1);
+
+RAYCHEL_END_TEST
+
+RAYCHEL_BEGIN_TEST("Fast exponential and logarithm", "[RaychelMath][FastMath]")
+
+    const auto exp_ref = [](long double x) { return std::exp(x); };
+    const auto log_ref = [](long double x) { return std::log(x); };
+
+    REQUIRE(max_error<TestType>([](TestType x) { return fast_exp<FastMathPrecision::low>(x); }, exp_ref, -80, 80, Error::relative) < 6e-5L);
+    REQUIRE(max_error<TestType>([](TestType x) { return fast_exp(x); }, exp_ref, -80, 80, Error::relative) < high_tolerance<TestType>);
+    REQUIRE(max_error<TestType>([](TestType x) { return fast_log<FastMathPrecision::low>(x); }, log_ref, 1, 100, Error::relative, true) < 5e-6L);
+    REQUIRE(max_error<TestType>([](TestType x) { return fast_log(x); }, log_ref, -100, -1, Error::relative, true) < high_tolerance<TestType>);
+
+    constexpr auto inf = std::numeric_limits<TestType>::infinity();
+    REQUIRE(fast_exp(TestType(0)) == 1);
+    REQUIRE(fast_exp(TestType(1000)) == inf);
+    REQUIRE(fast_exp(TestType(-1000)) == 0);
+    REQUIRE(fast_exp(-inf) == 0);
+
+    REQUIRE(fast_log(TestType(1)) == 0);
+    REQUIRE(fast_log(TestType(0)) == -inf);
+    REQUIRE(fast_log(inf) == inf);
+    REQUIRE(std::isnan(fast_log(TestType(-1))));
+
+    //subnormal inputs
+    const auto tiny = std::numeric_limits<TestType>::denorm_min() * 16;
+    REQUIRE(std::abs(fast_log(tiny) / std::log(tiny) - 1) < 1e-6);
+
+RAYCHEL_END_TEST
+
+RAYCHEL_BEGIN_TEST("Fast power", "[RaychelMath][FastMath]")
+
+    REQUIRE(std::abs(fast_pow(TestType(2), TestType(10)) / 1024 - 1) < 1e-5);
+    REQUIRE(std::abs(fast_pow<FastMathPrecision::low>(TestType(81), TestType(0.25)) / 3 - 1) < 1e-4);
+    REQUIRE(fast_pow(TestType(0), TestType(0)) == 1);
+    REQUIRE(fast_pow(TestType(0), TestType(2)) == 0);
+    REQUIRE(fast_pow(TestType(5), TestType(0)) == 1);
+
+RAYCHEL_END_TEST
+
+RAYCHEL_BEGIN_TEST("Fast math on packets", "[RaychelMath][FastMath]")
+
+    using Packet = basic_packet<TestType, 4>;
+
+    const Packet x{TestType(0.1), TestType(1.5), TestType(7), TestType(42)};
+
+    //with -mfma the compiler may contract the packet and scalar kernels into FMAs differently, so allow a few ULP
+    const auto check = [&](const Packet& res, auto scalar) {
+        for (std::size_t i{0}; i != Packet::width; ++i) {
+            const TestType expected = scalar(x[i]);
+            REQUIRE(std::abs(res[i] - expected) <= 4 * std::numeric_limits<TestType>::epsilon() * std::abs(expected));
+        }
+    };
+
+    check(fast_rsqrt(x), [](TestType v) { return fast_rsqrt(v); });
+    check(fast_sqrt<FastMathPrecision::low>(x), [](TestType v) { return fast_sqrt<FastMathPrecision::low>(v); });
+    check(fast_sin(x), [](TestType v) { return fast_sin(v); });
+    check(fast_cos(x), [](TestType v) { return fast_cos(v); });
+    check(fast_exp(x), [](TestType v) { return fast_exp(v); });
+    check(fast_log(x), [](TestType v) { return fast_log(v); });
+    check(fast_pow(x, Packet{TestType(0.5)}), [](TestType v) { return fast_pow(v, TestType(0.5)); });
+
+    const auto [s, c] = fast_sincos(x);
+    check(s, [](TestType v) { return fast_sin(v); });
+    check(c, [](TestType v) { return fast_cos(v); });
+
+RAYCHEL_END_TEST
+
+TEST_CASE("Fast math falls back to std for long double", "[RaychelMath][FastMath]")
+{
+    using namespace Raychel;
+    REQUIRE(fast_sin(1.0L) == std::sin(1.0L));
+    REQUIRE(fast_exp(2.0L) == std::exp(2.0L));
+    REQUIRE(fast_pow(2.0L, 0.5L) == std::pow(2.0L, 0.5L));
+}
@@ -0,0 +1,53 @@
+#ifndef RAYCHELMATH_TEST_FASTMATH_POLICY_H
+#define RAYCHELMATH_TEST_FASTMATH_POLICY_H
+
+#include "RaychelMath/concepts.h"
+#include "RaychelMath/equivalent.h"
+#include "RaychelMath/fastmath.h"
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+
+/*
+* Comparisons that widen to the error of the fast math policy the tests are built with (see RAYCHELMATH_FASTMATH).
+* With the policy off they are exactly the plain comparisons.
+*/
+
+namespace Raychel::test {
+
+    //Results pass through a handful of math_* calls before they are compared, so allow for the errors to add up
+    template <std::floating_point T>
+    constexpr T policy_margin = 16 * details::fastmath_policy_tolerance<T>;
+
+    template <std::floating_point T>
+    bool policy_close(T a, T b) noexcept
+    {
+        return std::abs(a - b) <= policy_margin<T> * std::max<T>({1, std::abs(a), std::abs(b)});
+    }
+
+    //a == b, or within the error of the fast math policy
+    template <Arithmetic T>
+    bool policy_equal(T a, T b) noexcept
+    {
+        if constexpr (std::floating_point<T>) {
+            return a == b || policy_close(a, b);
+        } else {
+            return a == b;
+        }
+    }
+
+    //equivalent(a, b), or within the error of the fast math policy
+    template <Arithmetic T>
+    bool policy_equivalent(T a, T b) noexcept
+    {
+        if constexpr (std::floating_point<T>) {
+            return equivalent(a, b) || policy_close(a, b);
+        } else {
+            return equivalent(a, b);
+        }
+    }
+
+} // namespace Raychel::test
+
+#endif //!RAYCHELMATH_TEST_FASTMATH_POLICY_H
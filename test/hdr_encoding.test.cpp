@@ -0,0 +1,157 @@
+#include "catch2/catch.hpp"
+
+#include "RaychelMath/hdr_encoding.h"
+
+#include "helpers.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+//clang-format doesn't like these macros
+// clang-format off
+
+namespace {
+
+    using Raychel::basic_color;
+    using color = basic_color<float>;
+
+    //spread the channels over many orders of magnitude, like real HDR data
+    std::vector<color> hdr_colors(std::size_t count, std::uint32_t seed)
+    {
+        return Raychel::test::random_colors<float>(count, -13, 15, true, seed);
+    }
+
+    float max_channel(const color& c)
+    {
+        return std::max({c.r(), c.g(), c.b()});
+    }
+
+    //Every channel is within max_error of the input, measured against the largest channel
+    bool shared_exponent_equivalent(const color& a, const color& b, float max_error)
+    {
+        const float tolerance = max_channel(a) * max_error;
+        return std::abs(a.r() - b.r()) <= tolerance && std::abs(a.g() - b.g()) <= tolerance &&
+               std::abs(a.b() - b.b()) <= tolerance;
+    }
+
+    //Within half a unit in the last place of a small float with the given number of mantissa bits, denormals included
+    bool small_float_equivalent(float a, float b, int mantissa_bits)
+    {
+        const float max_error = std::ldexp(1.F, -(mantissa_bits + 1));
+        const float denormal_error = std::ldexp(1.F, -(mantissa_bits + 15));
+        return std::abs(a - b) <= std::max(a * max_error, denormal_error);
+    }
+
+} // namespace
+
+TEST_CASE("RGBE encoding", "[RaychelMath][HDREncoding]")
+{
+    using namespace Raychel;
+
+    STATIC_REQUIRE(decode_rgbe(encode_rgbe(color{0, 0, 0})) == color{0, 0, 0});
+    STATIC_REQUIRE(encode_rgbe(color{1, .5, .25}) == 0x81204080U);
+
+    REQUIRE(encode_rgbe(color{1e-33F, 1e-34F, 0}) == 0U);
+    REQUIRE(decode_rgbe(0U) == color{0, 0, 0});
+    REQUIRE(decode_rgbe(0x00FFFFFFU) == color{0, 0, 0});
+
+    //2^-106 is the smallest value with a nonzero encoding, its exponent byte is 23. Anything below 23 decodes to black
+    const float rgbe_min = std::ldexp(1.F, -106);
+    REQUIRE(encode_rgbe(color{1e-32F, 1e-32F, 1e-32F}) == 0U);
+    REQUIRE(encode_rgbe(color{std::nextafter(rgbe_min, 0.F), 0, 0}) == 0U);
+    REQUIRE(encode_rgbe(color{rgbe_min, 0, 0}) >> 24U == 23U);
+    REQUIRE(shared_exponent_equivalent(color{rgbe_min, 0, 0}, decode_rgbe(encode_rgbe(color{rgbe_min, 0, 0})), 1.F / 256.F));
+    REQUIRE(decode_rgbe(0x16CFCFCFU) == color{0, 0, 0});
+
+    for (const auto& c : hdr_colors(10'000, 1)) {
+        REQUIRE(shared_exponent_equivalent(c, decode_rgbe(encode_rgbe(c)), 1.F / 256.F));
+    }
+
+    //negative and NaN channels are clamped to 0, huge ones to the largest representable value.
+    //Mantissas decode to the center of their interval, so 0 comes back as half a step
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    const float inf = std::numeric_limits<float>::infinity();
+    REQUIRE(decode_rgbe(encode_rgbe(color{-1, nan, 2})) == color{1.F / 128.F, 1.F / 128.F, 2.F + (1.F / 128.F)});
+    REQUIRE(std::isfinite(decode_rgbe(encode_rgbe(color{inf, 1, 1})).r()));
+    REQUIRE(decode_rgbe(encode_rgbe(color{inf, 1, 1})).r() > 1e38F);
+}
+
+TEST_CASE("RGB9E5 encoding", "[RaychelMath][HDREncoding]")
+{
+    using namespace Raychel;
+
+    STATIC_REQUIRE(decode_rgb9e5(encode_rgb9e5(color{1, .5, .25})) == color{1, .5, .25});
+    STATIC_REQUIRE(decode_rgb9e5(encode_rgb9e5(color{0, 0, 0})) == color{0, 0, 0});
+
+    for (const auto& c : hdr_colors(10'000, 2)) {
+        REQUIRE(shared_exponent_equivalent(c, decode_rgb9e5(encode_rgb9e5(c)), 1.F / 512.F));
+    }
+
+    //rounding up to the next exponent must not overflow the mantissa
+    REQUIRE(decode_rgb9e5(encode_rgb9e5(color{.9999F, 0, 0})) == color{1, 0, 0});
+
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    REQUIRE(decode_rgb9e5(encode_rgb9e5(color{1e6F, -3, nan})) == color{65408, 0, 0});
+}
+
+TEST_CASE("R11G11B10F encoding", "[RaychelMath][HDREncoding]")
+{
+    using namespace Raychel;
+
+    STATIC_REQUIRE(decode_r11g11b10f(encode_r11g11b10f(color{1, .5, 1024})) == color{1, .5, 1024});
+    STATIC_REQUIRE(encode_r11g11b10f(color{1, 1, 1}) == ((15U << 27U) | (15U << 17U) | (15U << 6U)));
+
+    for (const auto& c : hdr_colors(10'000, 3)) {
+        const auto decoded = decode_r11g11b10f(encode_r11g11b10f(c));
+        REQUIRE(small_float_equivalent(c.r(), decoded.r(), 6));
+        REQUIRE(small_float_equivalent(c.g(), decoded.g(), 6));
+        REQUIRE(small_float_equivalent(c.b(), decoded.b(), 5));
+    }
+
+    //denormals
+    const float smallest = std::ldexp(1.F, -20);
+    REQUIRE(decode_r11g11b10f(encode_r11g11b10f(color{smallest, 3 * smallest, 0})) == color{smallest, 3 * smallest, 0});
+    REQUIRE(encode_r11g11b10f(color{std::ldexp(1.F, -22), 0, 0}) == 0U);
+
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    const float inf = std::numeric_limits<float>::infinity();
+    REQUIRE(decode_r11g11b10f(encode_r11g11b10f(color{inf, -1, nan})) == color{65024, 0, 0});
+    REQUIRE(decode_r11g11b10f(encode_r11g11b10f(color{0, 0, 1e9F})) == color{0, 0, 64512});
+
+    REQUIRE(std::isinf(decode_r11g11b10f(0x7C0U).r()));
+    REQUIRE(std::isnan(decode_r11g11b10f(0x7C1U).r()));
+}
+
+TEST_CASE("HDR encoding spans", "[RaychelMath][HDREncoding]")
+{
+    using namespace Raychel;
+
+    //not a multiple of the block size to cover the tail
+    const auto colors = hdr_colors(1'000, 4);
+    std::vector<std::uint32_t> encoded(colors.size());
+    std::vector<color> decoded(colors.size());
+
+    encode_rgbe(colors, encoded);
+    decode_rgbe(encoded, decoded);
+    for (std::size_t i{0}; i != colors.size(); ++i) {
+        REQUIRE(encoded[i] == encode_rgbe(colors[i]));
+        REQUIRE(decoded[i] == decode_rgbe(encoded[i]));
+    }
+
+    encode_rgb9e5(colors, encoded);
+    decode_rgb9e5(encoded, decoded);
+    for (std::size_t i{0}; i != colors.size(); ++i) {
+        REQUIRE(encoded[i] == encode_rgb9e5(colors[i]));
+        REQUIRE(decoded[i] == decode_rgb9e5(encoded[i]));
+    }
+
+    encode_r11g11b10f(colors, encoded);
+    decode_r11g11b10f(encoded, decoded);
+    for (std::size_t i{0}; i != colors.size(); ++i) {
+        REQUIRE(encoded[i] == encode_r11g11b10f(colors[i]));
+        REQUIRE(decoded[i] == decode_r11g11b10f(encoded[i]));
+    }
+}
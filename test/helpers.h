@@ -0,0 +1,89 @@
+#ifndef RAYCHELMATH_TEST_HELPERS_H
+#define RAYCHELMATH_TEST_HELPERS_H
+
+#include "RaychelMath/Tuple.h"
+#include "RaychelMath/color.h"
+#include "RaychelMath/concepts.h"
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+/*
+* Helpers shared by several test files
+*/
+
+namespace Raychel::test {
+
+    enum class Error { absolute, relative, ulp };
+
+    //Distance between a and b in units of the last place of b
+    template <std::floating_point T>
+    long double ulp_error(T a, T b)
+    {
+        if (a == b) {
+            return 0;
+        }
+        const T ulp = std::nextafter(std::abs(b), std::numeric_limits<T>::infinity()) - std::abs(b);
+        return std::abs(static_cast<long double>(a) - static_cast<long double>(b)) / ulp;
+    }
+
+    //Maximum error of approximation against reference over samples of x in [min, max], or of x = 2^[min, max] if log_scale is set.
+    //Error::ulp compares the results in T, the other kinds in long double
+    template <typename T, typename F, typename R>
+    long double max_error(F approximation, R reference, double min, double max, Error kind, bool log_scale = false)
+    {
+        std::mt19937 rng{42};
+        std::uniform_real_distribution<double> dist{min, max};
+        long double res{0};
+        for (int i = 0; i < 20'000; ++i) {
+            const auto x = static_cast<T>(log_scale ? std::exp2(dist(rng)) : dist(rng));
+            if (kind == Error::ulp) {
+                res = std::max(res, ulp_error(static_cast<T>(approximation(x)), static_cast<T>(reference(x))));
+                continue;
+            }
+            const long double expected = reference(x);
+            const long double error = std::abs(static_cast<long double>(approximation(x)) - expected);
+            res = std::max(res, kind == Error::relative ? error / std::abs(expected) : error);
+        }
+        return res;
+    }
+
+    //count colors with every channel uniform in [min, max), or in 2^[min, max) if log_scale is set. The same seed gives the same colors
+    template <std::floating_point T>
+    std::vector<basic_color<T>> random_colors(std::size_t count, double min, double max, bool log_scale = false, std::uint32_t seed = 42)
+    {
+        std::mt19937 rng{seed};
+        std::uniform_real_distribution<double> dist{min, max};
+        const auto channel = [&] { return static_cast<T>(log_scale ? std::exp2(dist(rng)) : dist(rng)); };
+
+        std::vector<basic_color<T>> colors(count);
+        for (auto& c : colors) {
+            const T r = channel();
+            const T g = channel();
+            const T b = channel();
+            c = basic_color<T>{r, g, b};
+        }
+        return colors;
+    }
+
+    //Every component of a is less than tolerance away from the one in b
+    template <Arithmetic T, std::size_t N, typename Tag>
+    bool close(const Tuple<T, N, Tag>& a, const Tuple<T, N, Tag>& b, T tolerance)
+    {
+        for (std::size_t i{0}; i != N; ++i) {
+            if (!(std::abs(a[i] - b[i]) < tolerance)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+} // namespace Raychel::test
+
+#endif //!RAYCHELMATH_TEST_HELPERS_H
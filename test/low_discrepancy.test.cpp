@@ -0,0 +1,225 @@
+#include "catch2/catch.hpp"
+
+#include "RaychelMath/low_discrepancy.h"
+#include "RaychelMath/random.h"
+#include "RaychelMath/sampling.h"
+#include "RaychelMath/vector.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+//clang-format doesn't like these macros
+// clang-format off
+
+namespace {
+
+    //The first 2^m points put exactly one coordinate into each interval [k / 2^m, (k + 1) / 2^m)
+    template <typename Sequence>
+    bool stratified_1d(const Sequence& sequence, std::size_t dimension, std::uint32_t m)
+    {
+        const std::uint32_t n = 1U << m;
+        std::vector<int> counts(n);
+        for (std::uint32_t i{0}; i != n; ++i) {
+            ++counts[static_cast<std::size_t>(sequence.template sample<double>(i, dimension) * n)];
+        }
+        return std::all_of(counts.begin(), counts.end(), [](int c) { return c == 1; });
+    }
+
+    //The first 2^m points put exactly 2^t points into each box of area 2^(t - m) whose sides are powers of two: a
+    //(t, m, 2)-net
+    template <typename Sequence>
+    bool is_net_2d(const Sequence& sequence, std::size_t dimension, std::uint32_t m, std::uint32_t t)
+    {
+        const std::uint32_t n = 1U << m;
+        for (std::uint32_t k{0}; k <= m - t; ++k) {
+            const std::uint32_t nx = 1U << k;
+            const std::uint32_t ny = (n >> t) / nx;
+            std::vector<int> counts(nx * ny);
+            for (std::uint32_t i{0}; i != n; ++i) {
+                const auto p = Raychel::sample_2d<double>(sequence, i, dimension);
+                ++counts[(static_cast<std::size_t>(p.x() * nx) * ny) + static_cast<std::size_t>(p.y() * ny)];
+            }
+            if (!std::all_of(counts.begin(), counts.end(), [t](int c) { return c == (1 << t); })) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+} // namespace
+
+TEST_CASE("Sobol sequence", "[RaychelMath][LowDiscrepancy]")
+{
+    using namespace Raychel;
+
+    STATIC_REQUIRE(LowDiscrepancySequence<Sobol>);
+
+    //Joe and Kuo's reference output, which enumerates the points in Gray code order
+    constexpr std::array<std::array<double, 3>, 8> expected{{
+        {0, 0, 0}, {.5, .5, .5}, {.75, .25, .25}, {.25, .75, .75},
+        {.375, .375, .625}, {.875, .875, .125}, {.625, .125, .875}, {.125, .625, .375},
+    }};
+    const Sobol sobol{};
+    for (std::uint32_t i{0}; i != expected.size(); ++i) {
+        const auto gray = i ^ (i >> 1U);
+        for (std::size_t d{0}; d != 3; ++d) {
+            REQUIRE(sobol.sample<double>(gray, d) == expected[i][d]);
+        }
+    }
+    STATIC_REQUIRE(Sobol{}.sample(3, 0) == .75F);
+
+    for (std::size_t d{0}; d != Sobol::max_dimension; ++d) {
+        REQUIRE(stratified_1d(sobol, d, 10));
+    }
+    REQUIRE(is_net_2d(sobol, 0, 10, 0));
+    REQUIRE(is_net_2d(sobol, 2, 10, 1));
+}
+
+TEST_CASE("Owen scrambled Sobol sequence", "[RaychelMath][LowDiscrepancy]")
+{
+    using namespace Raychel;
+
+    STATIC_REQUIRE(LowDiscrepancySequence<OwenScrambledSobol>);
+
+    //scrambling keeps the net properties, including for the padded dimensions
+    for (const std::uint32_t seed : {0U, 1U, 12345U}) {
+        const OwenScrambledSobol sobol{seed};
+        for (std::size_t d{0}; d != 12; ++d) {
+            REQUIRE(stratified_1d(sobol, d, 8));
+        }
+        REQUIRE(is_net_2d(sobol, 0, 8, 0));
+        REQUIRE(is_net_2d(sobol, 2, 8, 1));
+        REQUIRE(is_net_2d(sobol, 4, 8, 0));
+    }
+
+    //seeds give different, reproducible sequences
+    const OwenScrambledSobol a{1};
+    const OwenScrambledSobol b{2};
+    int equal{0};
+    for (std::uint32_t i{0}; i != 64; ++i) {
+        REQUIRE(a.sample(i, 0) == OwenScrambledSobol{1}.sample(i, 0));
+        equal += a.sample(i, 0) == b.sample(i, 0) ? 1 : 0;
+    }
+    REQUIRE(equal < 4);
+    REQUIRE(a.seed() == 1);
+}
+
+TEST_CASE("Halton sequence", "[RaychelMath][LowDiscrepancy]")
+{
+    using namespace Raychel;
+
+    STATIC_REQUIRE(LowDiscrepancySequence<Halton>);
+
+    const Halton halton{};
+    constexpr std::array<double, 5> base_2{0, 1. / 2., 1. / 4., 3. / 4., 1. / 8.};
+    constexpr std::array<double, 5> base_3{0, 1. / 3., 2. / 3., 1. / 9., 4. / 9.};
+    for (std::uint32_t i{0}; i != base_2.size(); ++i) {
+        REQUIRE(halton.sample<double>(i, 0) == Approx(base_2[i]));
+        REQUIRE(halton.sample<double>(i, 1) == Approx(base_3[i]));
+    }
+
+    //base^k points stratify their dimension into base^k intervals
+    for (std::size_t d{0}; d != 4; ++d) {
+        const auto base = details::low_discrepancy::halton_bases[d];
+        const auto n = base * base * base;
+        std::vector<int> counts(n);
+        for (std::uint32_t i{0}; i != n; ++i) {
+            //the radical inverse is only exact up to rounding
+            ++counts[static_cast<std::size_t>((halton.sample<double>(i, d) * n) + 1e-9)];
+        }
+        REQUIRE(std::all_of(counts.begin(), counts.end(), [](int c) { return c == 1; }));
+    }
+
+    //large indices in large bases round to something below 1
+    REQUIRE(halton.sample(~std::uint32_t{0}, Halton::max_dimension - 1) < 1);
+}
+
+TEST_CASE("Kronecker sequence", "[RaychelMath][LowDiscrepancy]")
+{
+    using namespace Raychel;
+
+    STATIC_REQUIRE(LowDiscrepancySequence<R2>);
+
+    //alpha = (1 / g, 1 / g^2) with the plastic number g
+    constexpr double g = 1.32471795724474602596;
+    const R2 r2{};
+    for (std::uint32_t i{0}; i != 1000; ++i) {
+        const auto expected = sample_2d<double>(r2, i);
+        double integer{};
+        REQUIRE(std::abs(expected.x() - std::modf(.5 + (i / g), &integer)) < 1e-6);
+        REQUIRE(std::abs(expected.y() - std::modf(.5 + (i / (g * g)), &integer)) < 1e-6);
+    }
+
+    //the 1D golden ratio sequence
+    const Kronecker<1> golden{};
+    REQUIRE(std::abs(golden.sample<double>(1, 0) - (.5 + (2 / (1 + std::sqrt(5.))) - 1)) < 1e-9);
+}
+
+TEMPLATE_TEST_CASE("Low discrepancy batch fill", "[RaychelMath][LowDiscrepancy]", Raychel::Sobol, Raychel::OwenScrambledSobol, Raychel::Halton, Raychel::R2)
+{
+    using namespace Raychel;
+
+    const TestType sequence{};
+    constexpr std::uint32_t first = 37;
+
+    std::vector<float> values(100);
+    fill(sequence, first, 1, std::span<float>{values});
+    std::vector<basic_vec2<float>> points(100);
+    fill(sequence, first, 0, std::span<basic_vec2<float>>{points});
+    for (std::uint32_t i{0}; i != points.size(); ++i) {
+        REQUIRE(values[i] == sequence.sample(first + i, 1));
+        REQUIRE(points[i] == sample_2d(sequence, first + i));
+        REQUIRE((points[i].x() >= 0 && points[i].x() < 1));
+        REQUIRE((points[i].y() >= 0 && points[i].y() < 1));
+    }
+
+    if constexpr (TestType::max_dimension >= 3) {
+        std::vector<basic_vec3<double>> points_3d(100);
+        fill(sequence, first, 0, std::span<basic_vec3<double>>{points_3d});
+        for (std::uint32_t i{0}; i != points_3d.size(); ++i) {
+            REQUIRE(points_3d[i] == sample_3d<double>(sequence, first + i));
+        }
+    }
+
+    //the generator walks through the dimensions of one point
+    const DimensionGenerator<float, TestType> rng{sequence, 5};
+    REQUIRE(rng() == sequence.sample(5, 0));
+    REQUIRE(rng() == sequence.sample(5, 1));
+
+    //get_random_direction_on_hemisphere draws three dimensions
+    if constexpr (TestType::max_dimension >= 3) {
+        const basic_vec3<float> normal{0, 1, 0};
+        REQUIRE(dot(get_random_direction_on_hemisphere(normal, DimensionGenerator<float, TestType>{sequence, 9}), normal) >= 0);
+    }
+}
+
+TEST_CASE("Low discrepancy sampling converges faster", "[RaychelMath][LowDiscrepancy]")
+{
+    using namespace Raychel;
+
+    //Irradiance from a sky that gets brighter towards the horizon in +x: the integral of (1 + x) cos(theta) over
+    //the hemisphere is pi
+    const auto estimate = [](auto&& next_point) {
+        constexpr int samples = 256;
+        double sum{0};
+        for (int i = 0; i != samples; ++i) {
+            const auto v = sample_cosine_hemisphere(next_point(i));
+            sum += (1 + v.x()) * v.y() / cosine_hemisphere_pdf(v.y());
+        }
+        return sum / samples;
+    };
+
+    double random_error{0};
+    double sobol_error{0};
+    Xoshiro256PlusPlus engine{3};
+    for (std::uint32_t seed{0}; seed != 16; ++seed) {
+        const auto random = estimate([&](int) { return basic_vec2<double>{uniform_real<double>(engine), uniform_real<double>(engine)}; });
+        const OwenScrambledSobol sobol{seed};
+        const auto scrambled = estimate([&](int i) { return sample_2d<double>(sobol, static_cast<std::uint32_t>(i)); });
+        random_error += (random - pi_v<double>) * (random - pi_v<double>);
+        sobol_error += (scrambled - pi_v<double>) * (scrambled - pi_v<double>);
+    }
+    REQUIRE(sobol_error < random_error / 100);
+}
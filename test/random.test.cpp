@@ -0,0 +1,178 @@
+#include "catch2/catch.hpp"
+
+#include "RaychelMath/random.h"
+#include "RaychelMath/vector.h"
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <sstream>
+
+//clang-format doesn't like these macros
+// clang-format off
+
+#define RAYCHEL_ENGINE_TEST_TYPES Raychel::SplitMix64, Raychel::Xoshiro256PlusPlus, Raychel::Xoroshiro128Plus, Raychel::PCG32
+
+TEMPLATE_TEST_CASE("Random engine requirements", "[RaychelMath][Random]", RAYCHEL_ENGINE_TEST_TYPES)
+{
+    using namespace Raychel;
+    using engine = TestType;
+
+    STATIC_REQUIRE(StdRandomNumberEngine<engine>);
+    STATIC_REQUIRE(sizeof(engine) <= 32);
+
+    engine a{};
+    engine b{42U};
+    REQUIRE(a != b);
+    REQUIRE(a == engine{});
+
+    b.seed();
+    REQUIRE(a == b);
+
+    //discard skips exactly as many outputs as calling the engine
+    engine c{7U};
+    engine d{7U};
+    for (int i = 0; i != 1000; ++i) {
+        c();
+    }
+    d.discard(1000);
+    REQUIRE(c == d);
+    REQUIRE(c() == d());
+
+    //the state survives a round trip through a stream
+    a();
+    std::stringstream stream;
+    stream << a;
+    engine e{3U};
+    stream >> e;
+    REQUIRE(a == e);
+    REQUIRE(a() == e());
+
+    //failed reads leave the engine untouched
+    std::stringstream garbage{"not a number"};
+    const engine before = e;
+    garbage >> e;
+    REQUIRE(e == before);
+
+    //sanity check that the output is not constant
+    engine f{};
+    REQUIRE(f() != f());
+}
+
+TEST_CASE("SplitMix64 reference output", "[RaychelMath][Random]")
+{
+    using namespace Raychel;
+
+    SplitMix64 rng{0};
+    REQUIRE(rng() == 0xE220A8397B1DCDAFU);
+    REQUIRE(rng() == 0x6E789E6AA1B965F4U);
+    REQUIRE(rng() == 0x06C45D188009454FU);
+    REQUIRE(rng() == 0xF88BB8A8724C81ECU);
+
+    STATIC_REQUIRE(SplitMix64{}() == 0xE220A8397B1DCDAFU);
+}
+
+TEST_CASE("Xoshiro256PlusPlus reference output", "[RaychelMath][Random]")
+{
+    using namespace Raychel;
+    using state = Xoshiro256PlusPlus::state_type;
+
+    Xoshiro256PlusPlus rng{state{1, 2, 3, 4}};
+    REQUIRE(rng() == 0x0000000002800001U);
+    REQUIRE(rng() == 0x0000000003800067U);
+    REQUIRE(rng() == 0x000CC00003800067U);
+    REQUIRE(rng() == 0x000CC201994400B2U);
+
+    Xoshiro256PlusPlus jumped{state{1, 2, 3, 4}};
+    jumped.jump();
+    REQUIRE(jumped() == 0xEC879073673DF437U);
+
+    Xoshiro256PlusPlus long_jumped{state{1, 2, 3, 4}};
+    long_jumped.long_jump();
+    REQUIRE(long_jumped() == 0xB5C4EA370B330BF5U);
+
+    //seeding runs SplitMix64
+    REQUIRE(Xoshiro256PlusPlus{0}.state() == state{0xE220A8397B1DCDAFU, 0x6E789E6AA1B965F4U, 0x06C45D188009454FU, 0xF88BB8A8724C81ECU});
+}
+
+TEST_CASE("Xoroshiro128Plus reference output", "[RaychelMath][Random]")
+{
+    using namespace Raychel;
+    using state = Xoroshiro128Plus::state_type;
+
+    Xoroshiro128Plus rng{state{1, 2}};
+    REQUIRE(rng() == 0x0000000000000003U);
+    REQUIRE(rng() == 0x0000006001030003U);
+    REQUIRE(rng() == 0x20C102C302000C03U);
+    REQUIRE(rng() == 0x810180670D23AD61U);
+
+    Xoroshiro128Plus jumped{state{1, 2}};
+    jumped.jump();
+    REQUIRE(jumped() == 0xEA081299D29AD927U);
+
+    Xoroshiro128Plus long_jumped{state{1, 2}};
+    long_jumped.long_jump();
+    REQUIRE(long_jumped() == 0x6786A13DAA9B187DU);
+}
+
+TEST_CASE("PCG32 reference output", "[RaychelMath][Random]")
+{
+    using namespace Raychel;
+
+    //from the pcg32-demo of the reference implementation
+    PCG32 rng{42, 54};
+    const std::array<std::uint32_t, 6> expected{0xA15C02B7U, 0x7B47F409U, 0xBA1D3330U, 0x83D2F293U, 0xBFA4784BU, 0xCBED606EU};
+    for (const auto value : expected) {
+        REQUIRE(rng() == value);
+    }
+
+    //different streams give different sequences for the same seed
+    PCG32 other_stream{42, 55};
+    PCG32 same_stream{42, 54};
+    REQUIRE(other_stream() != same_stream());
+
+    //skipping back by wrapping around the period
+    PCG32 back{42, 54};
+    back.discard(6);
+    back.advance(~std::uint64_t{0} - 5);
+    REQUIRE(back() == expected[0]);
+}
+
+TEMPLATE_TEST_CASE("Uniform reals", "[RaychelMath][Random]", float, double, long double)
+{
+    using namespace Raychel;
+
+    //the largest engine output must not round up to 1
+    struct AllOnes
+    {
+        using result_type = std::uint64_t;
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return ~result_type{0}; }
+        result_type operator()() { return max(); }
+    };
+    AllOnes all_ones{};
+    REQUIRE(uniform_real<TestType>(all_ones) < 1);
+
+    Xoshiro256PlusPlus xoshiro{1};
+    PCG32 pcg{1};
+    TestType xoshiro_sum{0};
+    TestType pcg_sum{0};
+    constexpr int samples = 100'000;
+    for (int i = 0; i != samples; ++i) {
+        const auto x = uniform_real<TestType>(xoshiro);
+        const auto y = uniform_real<TestType>(pcg);
+        REQUIRE((x >= 0 && x < 1));
+        REQUIRE((y >= 0 && y < 1));
+        xoshiro_sum += x;
+        pcg_sum += y;
+    }
+    REQUIRE(std::abs((xoshiro_sum / samples) - TestType(.5)) < TestType(.01));
+    REQUIRE(std::abs((pcg_sum / samples) - TestType(.5)) < TestType(.01));
+
+    //the generator plugs into the functions taking a const rng
+    const auto rng = uniform_real_generator<TestType>(xoshiro);
+    const basic_vec3<TestType> normal{0, 1, 0};
+    for (int i = 0; i != 100; ++i) {
+        REQUIRE(dot(get_random_direction_on_hemisphere(normal, rng), normal) >= 0);
+    }
+}
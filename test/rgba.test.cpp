@@ -0,0 +1,128 @@
+#include "catch2/catch.hpp"
+
+#include "RaychelMath/equivalent.h"
+#include "RaychelMath/rgba.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+//clang-format doesn't like these macros
+// clang-format off
+
+#define RAYCHEL_RGBA_TEST_TYPES float, double
+
+#define RAYCHEL_BEGIN_TEST(test_name, test_tag)                                \
+    TEMPLATE_TEST_CASE(test_name, test_tag, RAYCHEL_RGBA_TEST_TYPES)           \
+    {                                                                          \
+        using namespace Raychel;                                               \
+        using rgba = basic_rgba<TestType>;
+
+#define RAYCHEL_END_TEST }
+
+RAYCHEL_BEGIN_TEST("RGBA layout", "[RaychelMath][RGBA]")
+
+    STATIC_REQUIRE(sizeof(rgba) == 4 * sizeof(TestType));
+    STATIC_REQUIRE(alignof(basic_rgba<float>) == 16);
+
+    constexpr rgba c{.1, .2, .3, .5};
+    STATIC_REQUIRE(c.r() == TestType(.1));
+    STATIC_REQUIRE(c.g() == TestType(.2));
+    STATIC_REQUIRE(c.b() == TestType(.3));
+    STATIC_REQUIRE(c.a() == TestType(.5));
+
+    constexpr rgba transparent{};
+    STATIC_REQUIRE(transparent == rgba{0, 0, 0, 0});
+
+RAYCHEL_END_TEST
+
+RAYCHEL_BEGIN_TEST("Premultiplying colors", "[RaychelMath][RGBA]")
+
+    using color = basic_color<TestType>;
+
+    const color c{1, .5, .25};
+
+    REQUIRE(premultiply(c) == rgba{1, .5, .25, 1});
+    REQUIRE(premultiply(c, TestType(.5)) == rgba{.5, .25, .125, .5});
+    REQUIRE(color_from_rgba(premultiply(c, TestType(.5))) == c);
+    REQUIRE(color_from_rgba(premultiply(c, TestType(0))) == color{0, 0, 0});
+
+    STATIC_REQUIRE(color_from_rgba(premultiply(color{.5, .5, .5}, TestType(.25))) == color{.5, .5, .5});
+
+RAYCHEL_END_TEST
+
+RAYCHEL_BEGIN_TEST("Compositing", "[RaychelMath][RGBA]")
+
+    using color = basic_color<TestType>;
+
+    const rgba red = premultiply(color{1, 0, 0}, TestType(.5));
+    const rgba blue = premultiply(color{0, 0, 1});
+    const rgba transparent{};
+
+    REQUIRE(over(red, blue) == rgba{.5, 0, .5, 1});
+    REQUIRE(over(blue, red) == blue);
+    REQUIRE(over(transparent, red) == red);
+    REQUIRE(over(red, transparent) == red);
+    REQUIRE(over(red, red) == rgba{.75, 0, 0, .75});
+
+    REQUIRE(over(red, color{0, 1, 0}) == color{.5, .5, 0});
+    REQUIRE(over(transparent, color{0, 1, 0}) == color{0, 1, 0});
+
+    //over is associative, so layers can be merged in any grouping
+    const rgba green = premultiply(color{0, 1, 0}, TestType(.25));
+    const auto left = over(over(red, green), blue);
+    const auto right = over(red, over(green, blue));
+    for (std::size_t i{0}; i != 4; ++i) {
+        REQUIRE(equivalent<TestType>(left[i], right[i]));
+    }
+
+    //premultiplied colors accumulate like any other tuple
+    rgba sum{};
+    sum += red;
+    sum += blue;
+    REQUIRE(sum / TestType(2) == rgba{.25, 0, .5, .75});
+
+    STATIC_REQUIRE(over(rgba{0, 0, .5, .5}, rgba{1, 0, 0, 1}) == rgba{.5, 0, .5, 1});
+
+RAYCHEL_END_TEST
+
+RAYCHEL_BEGIN_TEST("Compositing spans", "[RaychelMath][RGBA]")
+
+    using color = basic_color<TestType>;
+
+    std::vector<rgba> src;
+    std::vector<rgba> dst;
+    for (std::size_t i{0}; i != 67; ++i) {
+        const auto t = static_cast<TestType>(i) / 67;
+        src.push_back(premultiply(color{t, 1 - t, .5}, t));
+        dst.push_back(premultiply(color{.25, t, 1}, 1 - t));
+    }
+    const auto expected = [&] {
+        std::vector<rgba> res;
+        for (std::size_t i{0}; i != src.size(); ++i) {
+            res.push_back(over(src[i], dst[i]));
+        }
+        return res;
+    }();
+
+    composite_over<TestType>(src, dst);
+    REQUIRE(dst == expected);
+
+    std::vector<std::uint8_t> bytes(src.size() * 4);
+    pack_rgba8<TestType>(src, bytes);
+    for (std::size_t i{0}; i != src.size(); ++i) {
+        const auto straight = convert_color<std::uint8_t>(color_from_rgba(src[i]));
+        const auto t = static_cast<TestType>(i) / 67;
+        //pack_rgba8 rounds to nearest while convert_color truncates
+        for (std::size_t c{0}; c != 3; ++c) {
+            REQUIRE(bytes[(i * 4) + c] - straight[c] <= 1);
+        }
+        REQUIRE(bytes[(i * 4) + 3] == static_cast<std::uint8_t>((t * 255) + TestType(.5)));
+    }
+
+    const std::array<rgba, 1> transparent{};
+    std::array<std::uint8_t, 4> transparent_bytes{1, 1, 1, 1};
+    pack_rgba8<TestType>(transparent, transparent_bytes);
+    REQUIRE(transparent_bytes == std::array<std::uint8_t, 4>{0, 0, 0, 0});
+
+RAYCHEL_END_TEST
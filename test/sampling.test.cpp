@@ -0,0 +1,247 @@
+#include "catch2/catch.hpp"
+
+#include "RaychelMath/random.h"
+#include "RaychelMath/sampling.h"
+
+#include "fastmath_policy.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+//clang-format doesn't like these macros
+// clang-format off
+
+namespace {
+
+    //Points on a jittered grid, so the estimates below converge much faster than with plain random points
+    template <typename T>
+    std::vector<Raychel::basic_vec2<T>> jittered_points(std::size_t n)
+    {
+        Raychel::Xoshiro256PlusPlus rng{11};
+        std::vector<Raychel::basic_vec2<T>> points;
+        points.reserve(n * n);
+        for (std::size_t i{0}; i != n; ++i) {
+            for (std::size_t j{0}; j != n; ++j) {
+                points.emplace_back(
+                    (static_cast<T>(i) + Raychel::uniform_real<T>(rng)) / static_cast<T>(n),
+                    (static_cast<T>(j) + Raychel::uniform_real<T>(rng)) / static_cast<T>(n));
+            }
+        }
+        return points;
+    }
+
+    template <typename T>
+    constexpr T default_margin = std::numeric_limits<T>::epsilon() * 64 + Raychel::test::policy_margin<T>;
+
+    //The batch overloads use fast_sincos where single samples use math_sincos
+    template <typename T>
+    constexpr T batch_margin = default_margin<T> + (std::is_same_v<T, float> ? T(1e-6) : T(5e-9));
+
+    template <typename T>
+    bool vec_equivalent(const Raychel::basic_vec3<T>& a, const Raychel::basic_vec3<T>& b, T margin = default_margin<T>)
+    {
+        for (std::size_t i{0}; i != 3; ++i) {
+            if (std::abs(a[i] - b[i]) > margin * std::max<T>(1, std::abs(b[i]))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //y = sqrt(1 - x^2 - z^2) of the cosine sampler magnifies the fast_sincos error near the rim, so compare y^2 there
+    template <typename T>
+    bool cosine_equivalent(const Raychel::SamplingFrame<T>& frame, const Raychel::basic_vec3<T>& a, const Raychel::basic_vec3<T>& b)
+    {
+        const auto la = frame.to_local(a);
+        const auto lb = frame.to_local(b);
+        return std::abs(la.x() - lb.x()) <= batch_margin<T> && std::abs(la.z() - lb.z()) <= batch_margin<T> &&
+               std::abs((la.y() * la.y()) - (lb.y() * lb.y())) <= 4 * batch_margin<T>;
+    }
+
+    template <typename T>
+    constexpr T tolerance = (std::is_same_v<T, float> ? T(2e-6) : T(1e-8)) + Raychel::test::policy_margin<T>;
+
+} // namespace
+
+TEMPLATE_TEST_CASE("Sampling frame", "[RaychelMath][Sampling]", float, double)
+{
+    using namespace Raychel;
+    using vec3 = basic_vec3<TestType>;
+
+    for (const auto& n : {vec3{0, 1, 0}, vec3{0, 0, -1}, vec3{1, 2, 3}, vec3{-4, .5, -.1}}) {
+        const SamplingFrame<TestType> frame{n};
+        REQUIRE(vec_equivalent(frame.normal, normalize(n)));
+        REQUIRE(std::abs(dot(frame.tangent, frame.normal)) < tolerance<TestType>);
+        REQUIRE(std::abs(dot(frame.bitangent, frame.normal)) < tolerance<TestType>);
+        REQUIRE(std::abs(dot(frame.tangent, frame.bitangent)) < tolerance<TestType>);
+
+        const vec3 v{.3, -.2, .9};
+        REQUIRE(vec_equivalent(frame.to_local(frame.to_world(v)), v));
+        REQUIRE(vec_equivalent(frame.to_world(vec3{0, 1, 0}), frame.normal));
+    }
+}
+
+TEMPLATE_TEST_CASE("Concentric disk", "[RaychelMath][Sampling]", float, double)
+{
+    using namespace Raychel;
+
+    const auto points = jittered_points<TestType>(64);
+    std::size_t inner{0};
+    for (const auto& u : points) {
+        const auto d = sample_concentric_disk(u);
+        const auto r_sq = (d.x() * d.x()) + (d.y() * d.y());
+        REQUIRE(r_sq <= 1 + tolerance<TestType>);
+        inner += r_sq < TestType(.25) ? 1 : 0;
+    }
+    //area preserving, so a quarter of the points land within radius 1/2
+    REQUIRE(std::abs((static_cast<TestType>(inner) / static_cast<TestType>(points.size())) - TestType(.25)) < TestType(.005));
+
+    //the centre and the edge midpoints of the square
+    const auto centre = sample_concentric_disk(basic_vec2<TestType>{.5, .5});
+    REQUIRE(centre.x() == 0);
+    REQUIRE(centre.y() == 0);
+    const auto right = sample_concentric_disk(basic_vec2<TestType>{1, .5});
+    REQUIRE(std::abs(right.x() - 1) < tolerance<TestType>);
+    REQUIRE(std::abs(right.y()) < tolerance<TestType>);
+    const auto top = sample_concentric_disk(basic_vec2<TestType>{.5, 1});
+    REQUIRE(std::abs(top.x()) < tolerance<TestType>);
+    REQUIRE(std::abs(top.y() - 1) < tolerance<TestType>);
+
+    REQUIRE(concentric_disk_pdf<TestType>() == Approx(1 / pi_v<TestType>));
+}
+
+TEMPLATE_TEST_CASE("Direction samplers", "[RaychelMath][Sampling]", float, double)
+{
+    using namespace Raychel;
+
+    const auto points = jittered_points<TestType>(64);
+    const auto count = static_cast<TestType>(points.size());
+    constexpr TestType cos_theta_max = .8;
+
+    //E[y] and E[y^2] of each distribution
+    TestType sphere_y{0};
+    TestType sphere_y_sq{0};
+    TestType hemisphere_y{0};
+    TestType cosine_y{0};
+    TestType cone_y{0};
+    for (const auto& u : points) {
+        const auto sphere = sample_uniform_sphere(u);
+        const auto hemisphere = sample_uniform_hemisphere(u);
+        const auto cosine = sample_cosine_hemisphere(u);
+        const auto cone = sample_uniform_cone(u, cos_theta_max);
+        for (const auto& v : {sphere, hemisphere, cosine, cone}) {
+            REQUIRE(std::abs(mag(v) - 1) < tolerance<TestType>);
+        }
+        REQUIRE(hemisphere.y() > 0);
+        REQUIRE(cosine.y() >= 0);
+        REQUIRE(cone.y() >= cos_theta_max);
+
+        sphere_y += sphere.y();
+        sphere_y_sq += sphere.y() * sphere.y();
+        hemisphere_y += hemisphere.y();
+        cosine_y += cosine.y();
+        cone_y += cone.y();
+    }
+    REQUIRE(std::abs(sphere_y / count) < TestType(.001));
+    REQUIRE(std::abs((sphere_y_sq / count) - TestType(1. / 3.)) < TestType(.001));
+    REQUIRE(std::abs((hemisphere_y / count) - TestType(.5)) < TestType(.001));
+    REQUIRE(std::abs((cosine_y / count) - TestType(2. / 3.)) < TestType(.001));
+    REQUIRE(std::abs((cone_y / count) - ((1 + cos_theta_max) / 2)) < TestType(.001));
+}
+
+TEMPLATE_TEST_CASE("Sampling PDFs", "[RaychelMath][Sampling]", float, double)
+{
+    using namespace Raychel;
+    using vec3 = basic_vec3<TestType>;
+
+    const SamplingFrame<TestType> frame{vec3{1, -2, .5}};
+    constexpr TestType cos_theta_max = .6;
+
+    //integrating each pdf over the sphere with uniform sphere samples gives 1
+    const auto points = jittered_points<TestType>(128);
+    TestType hemisphere{0};
+    TestType cosine{0};
+    TestType cone{0};
+    for (const auto& u : points) {
+        const auto v = sample_uniform_sphere(u);
+        hemisphere += uniform_hemisphere_pdf(frame, v);
+        cosine += cosine_hemisphere_pdf(frame, v);
+        cone += uniform_cone_pdf(frame, v, cos_theta_max);
+    }
+    const auto scale = 1 / (static_cast<TestType>(points.size()) * uniform_sphere_pdf<TestType>());
+    REQUIRE(std::abs((hemisphere * scale) - 1) < TestType(.002));
+    REQUIRE(std::abs((cosine * scale) - 1) < TestType(.002));
+    REQUIRE(std::abs((cone * scale) - 1) < TestType(.01));
+
+    REQUIRE(uniform_hemisphere_pdf(frame, -frame.normal) == 0);
+    REQUIRE(cosine_hemisphere_pdf(frame, -frame.normal) == 0);
+    REQUIRE(cosine_hemisphere_pdf(frame, frame.normal) == Approx(1 / pi_v<TestType>));
+    REQUIRE(uniform_cone_pdf(frame, frame.tangent, cos_theta_max) == 0);
+    REQUIRE(uniform_cone_pdf(frame, frame.normal, cos_theta_max) == Approx(uniform_cone_pdf(cos_theta_max)));
+}
+
+TEMPLATE_TEST_CASE("Batch samplers", "[RaychelMath][Sampling]", float, double)
+{
+    using namespace Raychel;
+    using vec3 = basic_vec3<TestType>;
+
+    const SamplingFrame<TestType> frame{vec3{-1, 3, 2}};
+    constexpr TestType cos_theta_max = .9;
+
+    //not a multiple of the block size
+    auto points = jittered_points<TestType>(20);
+    points.resize(397);
+    const std::span<const basic_vec2<TestType>> u{points};
+    std::vector<vec3> out(points.size());
+
+    sample_uniform_sphere(u, std::span<vec3>{out});
+    for (std::size_t i{0}; i != points.size(); ++i) {
+        REQUIRE(vec_equivalent(out[i], sample_uniform_sphere(points[i]), batch_margin<TestType>));
+    }
+
+    sample_uniform_hemisphere(frame, u, std::span<vec3>{out});
+    for (std::size_t i{0}; i != points.size(); ++i) {
+        REQUIRE(vec_equivalent(out[i], sample_uniform_hemisphere(frame, points[i]), batch_margin<TestType>));
+    }
+
+    sample_uniform_cone(frame, u, cos_theta_max, std::span<vec3>{out});
+    for (std::size_t i{0}; i != points.size(); ++i) {
+        REQUIRE(vec_equivalent(out[i], sample_uniform_cone(frame, points[i], cos_theta_max), batch_margin<TestType>));
+        REQUIRE(dot(out[i], frame.normal) >= cos_theta_max - tolerance<TestType>);
+    }
+
+    sample_cosine_hemisphere(frame, u, std::span<vec3>{out});
+    std::vector<TestType> pdfs(points.size());
+    cosine_hemisphere_pdf(frame, std::span<const vec3>{out}, std::span<TestType>{pdfs});
+    for (std::size_t i{0}; i != points.size(); ++i) {
+        REQUIRE(cosine_equivalent(frame, out[i], sample_cosine_hemisphere(frame, points[i])));
+        REQUIRE(pdfs[i] == Approx(cosine_hemisphere_pdf(frame, out[i])));
+    }
+}
+
+TEMPLATE_TEST_CASE("Random directions on a rotated hemisphere", "[RaychelMath][Sampling]", float, double)
+{
+    using namespace Raychel;
+    using vec3 = basic_vec3<TestType>;
+
+    Xoshiro256PlusPlus engine{5};
+    const auto rng = uniform_real_generator<TestType>(engine);
+    const auto n = normalize(vec3{2, -1, 1});
+    const SamplingFrame<TestType> frame{n};
+
+    //uniform in solid angle, so the mean cosine to the normal is 1/2 and the mean direction is n/2
+    constexpr int samples = 100'000;
+    TestType cos_sum{0};
+    vec3 mean{};
+    for (int i = 0; i != samples; ++i) {
+        const auto v = sample_uniform_hemisphere(frame, basic_vec2<TestType>{rng(), rng()});
+        REQUIRE(std::abs(mag(v) - 1) < TestType(1e-5) + test::policy_margin<TestType>);
+        REQUIRE(dot(v, n) >= 0);
+        cos_sum += dot(v, n);
+        mean += v;
+    }
+    REQUIRE(std::abs((cos_sum / samples) - TestType(.5)) < TestType(.005));
+    REQUIRE(mag((mean / TestType(samples)) - (n / 2)) < TestType(.01));
+}
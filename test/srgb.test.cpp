@@ -0,0 +1,188 @@
+#include "RaychelMath/srgb.h"
+
+#include "catch2/catch.hpp"
+
+#include "fastmath_policy.h"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+#define RAYCHEL_SRGB_TEST_TYPES float, double, long double
+
+#define RAYCHEL_BEGIN_TEST(test_name, test_tag)                                                                                  \
+    TEMPLATE_TEST_CASE(test_name, test_tag, RAYCHEL_SRGB_TEST_TYPES)                                                             \
+    {                                                                                                                            \
+        using namespace Raychel;
+
+#define RAYCHEL_END_TEST }
+
+//clang-format doesn't like these macros
+// clang-format off
+
+namespace {
+
+    //The curve from IEC 61966-2-1, evaluated in long double. The thresholds are the double constants srgb.h uses, because
+    //the two parts of the curve do not quite meet
+    long double encode_reference(long double x)
+    {
+        return x <= static_cast<long double>(0.0031308) ? x * 12.92L : (1.055L * std::pow(x, 1.L / 2.4L)) - 0.055L;
+    }
+
+    long double decode_reference(long double x)
+    {
+        return x <= static_cast<long double>(0.04045) ? x / 12.92L : std::pow((x + 0.055L) / 1.055L, 2.4L);
+    }
+
+    std::uint8_t encode8_reference(long double x)
+    {
+        return static_cast<std::uint8_t>((encode_reference(std::clamp(x, 0.L, 1.L)) * 255.L) + .5L);
+    }
+
+    template <typename T>
+    std::vector<T> unit_samples()
+    {
+        std::vector<T> samples;
+        for (int i = 0; i <= 100'000; ++i) {
+            samples.push_back(static_cast<T>(i) / T(100'000));
+        }
+        //small values exercise the linear part and every segment of the curve
+        for (int i = -30; i <= 0; ++i) {
+            samples.push_back(static_cast<T>(std::exp2(static_cast<double>(i) * .5)));
+        }
+        return samples;
+    }
+
+    template <typename T>
+    constexpr long double tolerance = (std::is_same_v<T, long double> ? 1e-15L : std::numeric_limits<T>::epsilon() * 4) + Raychel::test::policy_margin<T>;
+
+} // namespace
+
+RAYCHEL_BEGIN_TEST("sRGB transfer functions", "[RaychelMath][sRGB]")
+
+    for (const auto x : unit_samples<TestType>()) {
+        REQUIRE(std::abs(static_cast<long double>(linear_to_srgb(x)) - encode_reference(x)) < tolerance<TestType>);
+        REQUIRE(std::abs(static_cast<long double>(srgb_to_linear(x)) - decode_reference(x)) < tolerance<TestType>);
+        REQUIRE(std::abs(srgb_to_linear(linear_to_srgb(x)) - x) < tolerance<TestType> * 8);
+    }
+
+    REQUIRE(linear_to_srgb(TestType(0)) == 0);
+    REQUIRE(srgb_to_linear(TestType(0)) == 0);
+    REQUIRE(linear_to_srgb(TestType(1)) == Approx(1));
+    REQUIRE(srgb_to_linear(TestType(1)) == Approx(1));
+
+    //out of range values follow the curve
+    REQUIRE(linear_to_srgb(TestType(-.5)) == TestType(-.5) * TestType(12.92));
+    REQUIRE(linear_to_srgb(TestType(4)) > TestType(1));
+
+    const basic_color<TestType> c{.5, .2, .01};
+    const auto encoded = linear_to_srgb(c);
+    //with -mfma the color and scalar overloads may be contracted into FMAs differently, so they can differ in the last bits
+    for (std::size_t i{0}; i != 3; ++i) {
+        REQUIRE(std::abs(encoded[i] - linear_to_srgb(c[i])) <= tolerance<TestType>);
+        REQUIRE(std::abs(srgb_to_linear(encoded)[i] - srgb_to_linear(encoded[i])) <= tolerance<TestType>);
+    }
+
+    static_assert(linear_to_srgb(TestType(0)) == 0);
+    static_assert(srgb_to_linear(TestType(.04045)) == TestType(.04045) / TestType(12.92));
+    static_assert(linear_to_srgb(TestType(.5)) > TestType(.7353) && linear_to_srgb(TestType(.5)) < TestType(.7354));
+    static_assert(srgb_to_linear(linear_to_srgb(TestType(.25))) > TestType(.249999) && srgb_to_linear(linear_to_srgb(TestType(.25))) < TestType(.250001));
+
+RAYCHEL_END_TEST
+
+RAYCHEL_BEGIN_TEST("Fast sRGB transfer functions", "[RaychelMath][sRGB]")
+
+    //long double uses the exact functions
+    const long double encode_bound = std::is_same_v<TestType, long double> ? tolerance<TestType> : 5e-7L;
+    const long double decode_bound = std::is_same_v<TestType, long double> ? tolerance<TestType> : 1.5e-6L;
+
+    for (const auto x : unit_samples<TestType>()) {
+        REQUIRE(std::abs(static_cast<long double>(fast_linear_to_srgb(x)) - encode_reference(x)) < encode_bound);
+        REQUIRE(std::abs(static_cast<long double>(fast_srgb_to_linear(x)) - decode_reference(x)) < decode_bound);
+    }
+
+    //inputs are clamped to [0, 1] with NaN mapped to 0
+    REQUIRE(fast_linear_to_srgb(TestType(-1)) == 0);
+    REQUIRE(fast_linear_to_srgb(TestType(0)) == 0);
+    REQUIRE(fast_linear_to_srgb(TestType(7)) == fast_linear_to_srgb(TestType(1)));
+    REQUIRE(fast_linear_to_srgb(std::numeric_limits<TestType>::quiet_NaN()) == 0);
+    REQUIRE(fast_linear_to_srgb(std::numeric_limits<TestType>::infinity()) == fast_linear_to_srgb(TestType(1)));
+    REQUIRE(fast_srgb_to_linear(TestType(-1)) == 0);
+    REQUIRE(fast_srgb_to_linear(TestType(2)) == fast_srgb_to_linear(TestType(1)));
+    REQUIRE(fast_srgb_to_linear(std::numeric_limits<TestType>::quiet_NaN()) == 0);
+
+    std::mt19937 rng{42};
+    std::uniform_real_distribution<double> dist{-.1, 1.1};
+    std::vector<basic_color<TestType>> colors;
+    for (int i = 0; i < 1'000; ++i) {
+        colors.emplace_back(static_cast<TestType>(dist(rng)), static_cast<TestType>(dist(rng)), static_cast<TestType>(dist(rng)));
+    }
+    std::vector<basic_color<TestType>> encoded(colors.size());
+    std::vector<basic_color<TestType>> decoded(colors.size());
+    fast_linear_to_srgb<TestType>(colors, encoded);
+    fast_srgb_to_linear<TestType>(colors, decoded);
+    for (std::size_t i{0}; i != colors.size(); ++i) {
+        REQUIRE(encoded[i] == fast_linear_to_srgb(colors[i]));
+        REQUIRE(decoded[i] == fast_srgb_to_linear(colors[i]));
+    }
+
+RAYCHEL_END_TEST
+
+RAYCHEL_BEGIN_TEST("8 bit sRGB", "[RaychelMath][sRGB]")
+
+    //the table matches the exact decoding and encoding every entry again gives back its code
+    for (int code = 0; code != 256; ++code) {
+        const auto u = static_cast<std::uint8_t>(code);
+        REQUIRE(std::abs(static_cast<long double>(srgb8_to_linear<TestType>(u)) - decode_reference(code / 255.L)) < tolerance<TestType>);
+        REQUIRE(linear_to_srgb8(srgb8_to_linear<TestType>(u)) == u);
+    }
+    static_assert(srgb8_to_linear<TestType>(0) == 0);
+    static_assert(srgb8_to_linear<TestType>(255) > TestType(.999999));
+
+    //rounding only differs from the exact encoding right at the rounding boundaries
+    std::size_t mismatches{0};
+    for (const auto x : unit_samples<TestType>()) {
+        const auto expected = encode8_reference(x);
+        const auto actual = linear_to_srgb8(x);
+        REQUIRE(std::abs(static_cast<int>(actual) - static_cast<int>(expected)) <= 1);
+        mismatches += static_cast<std::size_t>(actual != expected);
+    }
+    REQUIRE(mismatches < 10);
+
+    REQUIRE(linear_to_srgb8(TestType(-1)) == 0);
+    REQUIRE(linear_to_srgb8(TestType(2)) == 255);
+    REQUIRE(linear_to_srgb8(std::numeric_limits<TestType>::quiet_NaN()) == 0);
+    REQUIRE(linear_to_srgb8(std::numeric_limits<TestType>::infinity()) == 255);
+
+    std::mt19937 rng{42};
+    std::uniform_real_distribution<double> dist{-.1, 1.1};
+    std::vector<basic_color<TestType>> colors;
+    std::vector<basic_color<std::uint8_t>> codes;
+    for (std::size_t i = 0; i < 1'000; ++i) {
+        colors.emplace_back(static_cast<TestType>(dist(rng)), static_cast<TestType>(dist(rng)), static_cast<TestType>(dist(rng)));
+        codes.emplace_back(static_cast<std::uint8_t>(i), static_cast<std::uint8_t>(i * 7), static_cast<std::uint8_t>(i * 13));
+    }
+
+    std::vector<basic_color<TestType>> decoded(codes.size());
+    srgb8_to_linear<TestType>(codes, decoded);
+    std::vector<basic_color<std::uint8_t>> encoded(colors.size());
+    linear_to_srgb8<TestType>(colors, encoded);
+    std::vector<std::uint8_t> rgb(colors.size() * 3);
+    pack_srgb8<TestType>(colors, rgb);
+    std::vector<std::uint8_t> rgba(colors.size() * 4);
+    pack_srgba8<TestType>(colors, rgba, 17);
+
+    for (std::size_t i{0}; i != colors.size(); ++i) {
+        REQUIRE(decoded[i] == srgb8_to_linear<TestType>(codes[i]));
+        const auto expected = linear_to_srgb8(colors[i]);
+        for (std::size_t c{0}; c != 3; ++c) {
+            REQUIRE(encoded[i][c] == expected[c]);
+            REQUIRE(rgb[(i * 3) + c] == expected[c]);
+            REQUIRE(rgba[(i * 4) + c] == expected[c]);
+        }
+        REQUIRE(rgba[(i * 4) + 3] == 17);
+    }
+
+RAYCHEL_END_TEST
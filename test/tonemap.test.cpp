@@ -0,0 +1,138 @@
+#include "RaychelMath/tonemap.h"
+
+#include "catch2/catch.hpp"
+
+#include "helpers.h"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#define RAYCHEL_TONEMAP_TEST_TYPES float, double
+
+#define RAYCHEL_BEGIN_TEST(test_name, test_tag)                                                                                  \
+    TEMPLATE_TEST_CASE(test_name, test_tag, RAYCHEL_TONEMAP_TEST_TYPES)                                                          \
+    {                                                                                                                            \
+        using namespace Raychel;                                                                                                 \
+        using color = basic_color<TestType>;
+
+#define RAYCHEL_END_TEST }
+
+//clang-format doesn't like these macros
+// clang-format off
+
+namespace {
+
+    //Packets may be contracted to FMAs differently than scalars. AgX passes the difference through log2 and pow, which
+    //amplify it to about 2e-5 for float under the AVX2 backend
+    template <typename Operator, typename T>
+    constexpr T tolerance = std::is_same_v<T, float> ? T(std::is_same_v<Operator, Raychel::basic_agx<T>> ? 1e-4 : 1e-5) : T(1e-12);
+
+    //A grey ramp over [0, max_input] must stay grey, be non-decreasing and stay within [0, max]
+    template <typename T, typename Operator>
+    bool is_monotonic(const Operator& op, T max, T max_input = 100, T grey_tolerance = 0)
+    {
+        T previous{0};
+        for (int i = 0; i <= 2'000; ++i) {
+            const auto x = (static_cast<T>(i) * max_input) / T(2'000);
+            const auto y = op(Raychel::basic_color<T>{x, x, x});
+            if (y[0] < previous || y[0] < 0 || y[0] > max || std::abs(y[1] - y[0]) > grey_tolerance || std::abs(y[2] - y[0]) > grey_tolerance) {
+                return false;
+            }
+            previous = y[0];
+        }
+        return true;
+    }
+
+    template <typename T, typename Operator>
+    bool maps_invalid_to_zero(const Operator& op)
+    {
+        const auto y = op(Raychel::basic_color<T>{T(-1), std::numeric_limits<T>::quiet_NaN(), T(0)});
+        const auto zero = op(Raychel::basic_color<T>{T(0), T(0), T(0)});
+        return y[0] == zero[0] && y[1] == zero[1] && y[2] == zero[2];
+    }
+
+} // namespace
+
+RAYCHEL_BEGIN_TEST("Tone mapping operators", "[RaychelMath][ToneMap]")
+
+    REQUIRE(basic_reinhard<TestType>{}(color{1, 3, 0}) == color{.5, .75, 0});
+    REQUIRE(basic_reinhard<TestType>{.exposure = 2}(color{.5, .5, .5}) == color{.5, .5, .5});
+    REQUIRE(is_monotonic<TestType>(basic_reinhard<TestType>{}, 1));
+
+    const basic_reinhard_extended<TestType> extended{.exposure = 2, .white = 6};
+    REQUIRE(extended(color{3, 3, 3})[0] == Approx(1));
+    REQUIRE(extended(color{.1, .1, .1})[0] == Approx(basic_reinhard<TestType>{2}(color{.1, .1, .1})[0]).epsilon(.01));
+    REQUIRE(is_monotonic<TestType>(basic_reinhard_extended<TestType>{}, 100));
+
+    const basic_aces<TestType> aces{};
+    REQUIRE(aces(color{0, 0, 0}) == color{0, 0, 0});
+    REQUIRE(aces(color{1e6, 1e6, 1e6}) == color{1, 1, 1});
+    REQUIRE(aces(color{1, 1, 1})[0] == Approx(.8037975));
+    REQUIRE(is_monotonic<TestType>(aces, 1));
+
+    const basic_uncharted2<TestType> uncharted2{.exposure = 2, .white = 8};
+    REQUIRE(uncharted2(color{4, 4, 4})[0] == Approx(1));
+    REQUIRE(uncharted2(color{0, 0, 0})[0] == Approx(0).margin(1e-6));
+    REQUIRE(is_monotonic<TestType>(uncharted2, 2));
+
+    const basic_agx<TestType> agx{};
+    REQUIRE(agx(color{0, 0, 0}) == color{0, 0, 0});
+    REQUIRE(agx(color{.18, .18, .18})[0] == Approx(.2145).epsilon(.001));
+    REQUIRE(agx(color{agx.white, agx.white, agx.white})[0] == Approx(1).epsilon(.01));
+    //the sigmoid polynomial overshoots slightly just below white, and the outset matrix rows do not quite sum to 1
+    REQUIRE(is_monotonic<TestType>(agx, TestType(1.01), agx.white * TestType(.9), TestType(2e-3)));
+
+    //AgX pulls bright saturated colors towards white
+    const auto saturated = agx(color{64, .1, .1});
+    REQUIRE(saturated[0] > saturated[1]);
+    REQUIRE(saturated[1] > .5);
+    REQUIRE(aces(color{64, .1, .1})[1] < .2);
+
+    REQUIRE(maps_invalid_to_zero<TestType>(basic_reinhard<TestType>{}));
+    REQUIRE(maps_invalid_to_zero<TestType>(extended));
+    REQUIRE(maps_invalid_to_zero<TestType>(aces));
+    REQUIRE(maps_invalid_to_zero<TestType>(uncharted2));
+    REQUIRE(maps_invalid_to_zero<TestType>(agx));
+
+    static_assert(basic_reinhard<TestType>{}(color{1, 1, 1})[0] == TestType(.5));
+    static_assert(basic_aces<TestType>{}(color{0, 0, 0})[0] == 0);
+    static_assert(basic_uncharted2<TestType>{}(color{5.6, 5.6, 5.6})[0] > TestType(.999));
+    static_assert(basic_agx<TestType>{}(color{.18, .18, .18})[0] > TestType(.19));
+
+RAYCHEL_END_TEST
+
+TEMPLATE_PRODUCT_TEST_CASE("Tone mapping packets and spans", "[RaychelMath][ToneMap]", (Raychel::basic_reinhard, Raychel::basic_reinhard_extended, Raychel::basic_aces, Raychel::basic_uncharted2, Raychel::basic_agx), (float, double))
+{
+    using namespace Raychel;
+    using T = decltype(TestType::exposure);
+
+    const TestType op{};
+    const auto colors = test::random_colors<T>(1'001, -.5, 20.);
+
+    const auto packet = op(load_packet<4>(std::span<const basic_color<T>, 4>{colors.data(), 4}));
+    for (std::size_t lane{0}; lane != 4; ++lane) {
+        REQUIRE(test::close(extract(packet, lane), op(colors[lane]), tolerance<TestType, T>));
+    }
+
+    std::vector<basic_color<T>> mapped(colors.size());
+    tonemap<T>(op, colors, mapped);
+    for (std::size_t i{0}; i != colors.size(); ++i) {
+        REQUIRE(test::close(mapped[i], op(colors[i]), tolerance<TestType, T>));
+    }
+
+    //the fused pipelines encode the tone mapped colors exactly like linear_to_srgb8
+    std::vector<basic_color<std::uint8_t>> encoded(colors.size());
+    tonemap_srgb8<T>(op, colors, encoded);
+    std::vector<std::uint8_t> rgba(colors.size() * 4);
+    tonemap_pack_srgba8<T>(op, colors, rgba, 7);
+    for (std::size_t i{0}; i != colors.size(); ++i) {
+        const auto expected = linear_to_srgb8(mapped[i]);
+        for (std::size_t c{0}; c != 3; ++c) {
+            REQUIRE(encoded[i][c] == expected[c]);
+            REQUIRE(rgba[(i * 4) + c] == expected[c]);
+        }
+        REQUIRE(rgba[(i * 4) + 3] == 7);
+    }
+}
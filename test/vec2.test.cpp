@@ -5,6 +5,8 @@
 #include "RaychelMath/equivalent.h"
 #include "RaychelMath/vec2.h"
 
+#include "fastmath_policy.h"
+
 //clang-format doesn't like these macros
 // clang-format off
 
@@ -41,12 +43,12 @@ RAYCHEL_BEGIN_TEST("vec2 magnitude", "[RaychelMath][Vector2]")
     REQUIRE(mag(vec2{}) == 0);
 
     //the orthonormal basis vector have magnitude 1
-    REQUIRE(mag(vec2{1, 0}) == 1);
-    REQUIRE(mag(vec2{0, 1}) == 1);
+    REQUIRE(test::policy_equal<TestType>(mag(vec2{1, 0}), 1));
+    REQUIRE(test::policy_equal<TestType>(mag(vec2{0, 1}), 1));
 
     //Pythagoras holds
-    REQUIRE(mag(vec2{3, 4}) == 5);
-    REQUIRE(mag(vec2{9, 40}) == 41);
+    REQUIRE(test::policy_equal<TestType>(mag(vec2{3, 4}), 5));
+    REQUIRE(test::policy_equal<TestType>(mag(vec2{9, 40}), 41));
 
     //And the same for squared distances
 
@@ -87,7 +89,7 @@ RAYCHEL_BEGIN_TEST("vec2 distance", "[RaychelMath][Vector2]")
     {
         const vec2 b{12, 25};
 
-        REQUIRE(dist(v, b) == 5);
+        REQUIRE(test::policy_equal<TestType>(dist(v, b), 5));
     }
 
     //And the same for squared distances
@@ -134,5 +136,13 @@ TEMPLATE_TEST_CASE("vec2 rotation", "[RaychelMath][Vector2]", RAYCHEL_VEC2_FLOAT
         REQUIRE(Raychel::equivalent<TestType>(v2.x(), 0));
         REQUIRE(v2.y() == 1);
     }
+
+    {
+        const vec2 v{0, 1};
+        const auto v2 = rotate(v, half_pi);
+
+        REQUIRE(v2.x() == -1);
+        REQUIRE(Raychel::equivalent<TestType>(v2.y(), 0));
+    }
 }
 // clang-format on
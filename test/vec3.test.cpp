@@ -5,6 +5,8 @@
 #include "RaychelMath/vec3.h"
 #include "RaychelMath/vector.h"
 
+#include "fastmath_policy.h"
+
 //clang-format doesn't like these macros
 // clang-format off
 
@@ -78,21 +80,21 @@ RAYCHEL_BEGIN_TEST("Vector magnitude", "[RaychelMath][Vector3]")
     REQUIRE(mag(vec3{}) == 0);
 
     //the orthonormal basis vectors have magnitude 1
-    REQUIRE(mag(vec3{1, 0, 0}) == 1);
-    REQUIRE(mag(vec3{0, 1, 0}) == 1);
-    REQUIRE(mag(vec3{0, 0, 1}) == 1);
+    REQUIRE(test::policy_equal<TestType>(mag(vec3{1, 0, 0}), 1));
+    REQUIRE(test::policy_equal<TestType>(mag(vec3{0, 1, 0}), 1));
+    REQUIRE(test::policy_equal<TestType>(mag(vec3{0, 0, 1}), 1));
 
     //Pythagoras holds
-    REQUIRE(mag(vec3{1, 2, 2}) == 3);
-    REQUIRE(mag(vec3{12, 15, 16}) == 25);
+    REQUIRE(test::policy_equal<TestType>(mag(vec3{1, 2, 2}), 3));
+    REQUIRE(test::policy_equal<TestType>(mag(vec3{12, 15, 16}), 25));
 
     if constexpr (std::is_floating_point_v<TestType>)
     {
-        REQUIRE(mag(vec3{1, 0, 1}) == std::sqrt(TestType(2.0)));
+        REQUIRE(test::policy_equal(mag(vec3{1, 0, 1}), std::sqrt(TestType(2.0))));
 
         const vec3 v{std::sqrt(TestType(2)), 0, std::sqrt(TestType(2))};
         const auto m = mag(v);
-        REQUIRE(equivalent<TestType>(m, 2));
+        REQUIRE(test::policy_equivalent<TestType>(m, 2));
     }
 
 
@@ -117,17 +119,17 @@ TEMPLATE_TEST_CASE("Vector normalization", "[RaychelMath][Vector3]", RAYCHEL_VEC
     {
         const vec3 v = normalize(vec3{1, 0, 1});
 
-        REQUIRE(equivalent<TestType>(v.x(), inv_sqrt_2));
-        REQUIRE(equivalent<TestType>(v.y(), 0));
-        REQUIRE(equivalent<TestType>(v.z(), inv_sqrt_2));
+        REQUIRE(test::policy_equivalent<TestType>(v.x(), inv_sqrt_2));
+        REQUIRE(test::policy_equivalent<TestType>(v.y(), 0));
+        REQUIRE(test::policy_equivalent<TestType>(v.z(), inv_sqrt_2));
     }
 
     {
         const vec3 v = normalize(vec3{12, 0, 12});
 
-        REQUIRE(equivalent(v.x(), inv_sqrt_2));
-        REQUIRE(equivalent<TestType>(v.y(), 0));
-        REQUIRE(equivalent(v.z(), inv_sqrt_2));
+        REQUIRE(test::policy_equivalent<TestType>(v.x(), inv_sqrt_2));
+        REQUIRE(test::policy_equivalent<TestType>(v.y(), 0));
+        REQUIRE(test::policy_equivalent<TestType>(v.z(), inv_sqrt_2));
     }
 
 }
@@ -150,7 +152,7 @@ RAYCHEL_BEGIN_TEST("Vector distance", "[RaychelMath][Vector3]")
 
         const auto d = dist(a, b);
 
-        REQUIRE(d == 7);
+        REQUIRE(test::policy_equal<TestType>(d, 7));
     }
 
     if constexpr (std::is_signed_v<TestType>)
@@ -159,7 +161,7 @@ RAYCHEL_BEGIN_TEST("Vector distance", "[RaychelMath][Vector3]")
 
         const auto d = dist(a, b);
 
-        REQUIRE(d == 29);
+        REQUIRE(test::policy_equal<TestType>(d, 29));
     }
 
     if constexpr(std::is_floating_point_v<TestType>)
@@ -168,7 +170,7 @@ RAYCHEL_BEGIN_TEST("Vector distance", "[RaychelMath][Vector3]")
 
         const auto d = dist(a, b);
 
-        REQUIRE(equivalent<TestType>(d, std::sqrt(TestType(229))));
+        REQUIRE(test::policy_equivalent<TestType>(d, std::sqrt(TestType(229))));
     }
 
 RAYCHEL_END_TEST
@@ -0,0 +1,141 @@
+#include "catch2/catch.hpp"
+
+#include "RaychelMath/equivalent.h"
+#include "RaychelMath/vec3a.h"
+
+#include "fastmath_policy.h"
+
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+//clang-format doesn't like these macros
+// clang-format off
+
+#ifdef _MSC_VER
+    #pragma warning( push )
+    #pragma warning (disable : 4244 4305) //MSVC's warnings about narrowing conversion are nice to have, but not this time
+#endif
+
+#define RAYCHEL_VEC3A_TEST_TYPES int, float, double, long double
+
+#define RAYCHEL_BEGIN_TEST(test_name, test_tag)                                \
+    TEMPLATE_TEST_CASE(test_name, test_tag, RAYCHEL_VEC3A_TEST_TYPES)          \
+    {                                                                          \
+        using namespace Raychel;                                               \
+        using vec3a = basic_vec3a<TestType>;
+
+#define RAYCHEL_END_TEST }
+
+RAYCHEL_BEGIN_TEST("Padded vector layout", "[RaychelMath][Vector3a]")
+
+    STATIC_REQUIRE(sizeof(vec3a) == 4 * sizeof(TestType));
+    STATIC_REQUIRE(alignof(vec3a) == std::min<std::size_t>(4 * sizeof(TestType), 32));
+
+    constexpr vec3a a{1, 2, 3};
+    STATIC_REQUIRE(a.x() == 1);
+    STATIC_REQUIRE(a.y() == 2);
+    STATIC_REQUIRE(a.z() == 3);
+    STATIC_REQUIRE(a[3] == 0);
+
+    constexpr vec3a b{};
+    STATIC_REQUIRE(b == vec3a{0, 0, 0});
+
+RAYCHEL_END_TEST
+
+RAYCHEL_BEGIN_TEST("Converting between vec3 and vec3a", "[RaychelMath][Vector3a]")
+
+    using vec3 = basic_vec3<TestType>;
+
+    const vec3 v{4, -5, 6};
+    const auto a = vec3a_from_vec3(v);
+    REQUIRE(a == vec3a{4, -5, 6});
+    REQUIRE(a[3] == 0);
+    REQUIRE(vec3_from_vec3a(a) == v);
+    REQUIRE(static_cast<vec3>(a) == v);
+
+RAYCHEL_END_TEST
+
+RAYCHEL_BEGIN_TEST("Padded vector arithmetic", "[RaychelMath][Vector3a]")
+
+    using vec3 = basic_vec3<TestType>;
+
+    const vec3a a{1, 2, 3};
+    const vec3a b{4, -5, 6};
+
+    REQUIRE(a + b == vec3a{5, -3, 9});
+    REQUIRE(b - a == vec3a{3, -7, 3});
+    REQUIRE(a * 2 == vec3a{2, 4, 6});
+    REQUIRE((a * 4) / 2 == vec3a{2, 4, 6});
+    REQUIRE((a + b)[3] == 0);
+
+    REQUIRE(dot(a, b) == dot(vec3{1, 2, 3}, vec3{4, -5, 6}));
+    REQUIRE(mag_sq(a) == 14);
+    REQUIRE(dist_sq(a, b) == dist_sq(vec3{1, 2, 3}, vec3{4, -5, 6}));
+
+    const auto c = cross(a, b);
+    REQUIRE(vec3_from_vec3a(c) == cross(vec3{1, 2, 3}, vec3{4, -5, 6}));
+    REQUIRE(c[3] == 0);
+
+    constexpr auto cc = cross(vec3a{1, 0, 0}, vec3a{0, 1, 0});
+    STATIC_REQUIRE(cc == vec3a{0, 0, 1});
+    STATIC_REQUIRE(dot(vec3a{1, 2, 3}, vec3a{1, 2, 3}) == 14);
+
+RAYCHEL_END_TEST
+
+TEMPLATE_TEST_CASE("Padded vector normalization", "[RaychelMath][Vector3a]", float, double, long double)
+{
+    using namespace Raychel;
+    using vec3a = basic_vec3a<TestType>;
+
+    const vec3a a{3, 0, 4};
+    REQUIRE(test::policy_equivalent<TestType>(mag(a), 5));
+
+    const auto n = normalize(a);
+    REQUIRE(test::policy_equivalent<TestType>(mag(n), 1));
+    REQUIRE(test::policy_equivalent<TestType>(n.x(), TestType(3) / 5));
+    REQUIRE(n[3] == 0);
+
+    REQUIRE(test::policy_equivalent<TestType>(dist(a, vec3a{0, 0, 0}), 5));
+    REQUIRE(lerp(vec3a{0, 0, 0}, vec3a{2, 4, 6}, TestType(0.5)) == vec3a{1, 2, 3});
+}
+
+TEMPLATE_TEST_CASE("Padded vector with NaN padding", "[RaychelMath][Vector3a]", float, double, long double)
+{
+    using namespace Raychel;
+    using vec3a = basic_vec3a<TestType>;
+
+    //0 / 0 puts NaN into the padding lane, which the dot and cross products must not pick up
+    const auto v = vec3a{1, 2, 2} / TestType(0);
+    REQUIRE(std::isnan(v[3]));
+
+    const auto inf = std::numeric_limits<TestType>::infinity();
+    REQUIRE(dot(v, vec3a{1, 1, 1}) == inf);
+    REQUIRE(mag(v) == inf);
+    REQUIRE(cross(v, vec3a{1, 0, 0})[3] == 0);
+
+    //neither do the comparisons
+    auto w = vec3a{1, 2, 3};
+    w[3] = std::numeric_limits<TestType>::quiet_NaN();
+    REQUIRE(w == w);
+    REQUIRE_FALSE(w != w);
+    REQUIRE(w == vec3a{1, 2, 3});
+    REQUIRE(w != vec3a{1, 2, 4});
+}
+
+RAYCHEL_BEGIN_TEST("Padded vector stream operators", "[RaychelMath][Vector3a]")
+
+    const vec3a a{1, 2, 3};
+    std::stringstream ss;
+    ss << a;
+    REQUIRE(ss.str() == "{1 2 3}");
+
+    vec3a b;
+    ss >> b;
+    REQUIRE(b == a);
+
+RAYCHEL_END_TEST
+
+#ifdef _MSC_VER
+    #pragma warning( pop )
+#endif